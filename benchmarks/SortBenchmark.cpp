@@ -0,0 +1,206 @@
+// Counts the comparisons, swaps, moves and copies each DSASort strategy (6 is AdaptiveSort) performs on Vector,
+// SList, DList and CList over several input distributions, and prints one row per (container, strategy, input).
+//
+// usage: sort_benchmark [size] [--csv]
+#include "../include/Containers/CList/CList.hpp"
+#include "../include/Containers/DList/DList.hpp"
+#include "../include/Containers/SList/SList.hpp"
+#include "../include/Containers/Vector/Vector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+namespace
+{
+struct SortCounters
+{
+    std::uint64_t Comparisons = 0;
+    std::uint64_t Swaps = 0;
+    std::uint64_t Moves = 0;
+    std::uint64_t Copies = 0;
+};
+
+SortCounters counters;
+
+/**
+ * @brief Element that counts its copies and moves; swap is found by ADL and counted as one swap.
+ */
+struct CountedElement
+{
+    int Value = 0;
+
+    CountedElement() = default;
+
+    CountedElement(int value) : Value(value)
+    {
+    }
+
+    CountedElement(const CountedElement &other) : Value(other.Value)
+    {
+        ++counters.Copies;
+    }
+
+    CountedElement(CountedElement &&other) noexcept : Value(other.Value)
+    {
+        ++counters.Moves;
+    }
+
+    CountedElement &operator=(const CountedElement &other)
+    {
+        Value = other.Value;
+        ++counters.Copies;
+        return *this;
+    }
+
+    CountedElement &operator=(CountedElement &&other) noexcept
+    {
+        Value = other.Value;
+        ++counters.Moves;
+        return *this;
+    }
+
+    friend void swap(CountedElement &lhs, CountedElement &rhs) noexcept
+    {
+        std::swap(lhs.Value, rhs.Value);
+        ++counters.Swaps;
+    }
+};
+
+struct CountingLess
+{
+    bool operator()(const CountedElement &lhs, const CountedElement &rhs) const
+    {
+        ++counters.Comparisons;
+        return lhs.Value < rhs.Value;
+    }
+};
+
+constexpr const char *StrategyNames[] = {"merge", "insertion", "selection", "bubble", "quick", "heap", "adaptive"};
+
+constexpr const char *DistributionNames[] = {"random", "sorted", "reversed", "organ-pipe", "few-unique", "sawtooth"};
+
+std::vector<int> MakeInput(std::size_t distribution, std::size_t size)
+{
+    std::vector<int> input(size);
+    std::mt19937 engine(42);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const int n = static_cast<int>(size);
+        const int k = static_cast<int>(i);
+        switch (distribution)
+        {
+        case 0:
+            input[i] = static_cast<int>(engine() % size);
+            break;
+        case 1:
+            input[i] = k;
+            break;
+        case 2:
+            input[i] = n - k;
+            break;
+        case 3:
+            input[i] = k < n / 2 ? k : n - k;
+            break;
+        case 4:
+            input[i] = static_cast<int>(engine() % 8);
+            break;
+        default:
+            input[i] = k % std::max(1, n / 8);
+            break;
+        }
+    }
+    return input;
+}
+
+template <typename TContainer> void Fill(TContainer &container, const std::vector<int> &input)
+{
+    if constexpr (std::is_same_v<TContainer, DSALibraries::Containers::Vector<CountedElement>>)
+    {
+        container.Reverse(input.size());
+        for (int value : input)
+        {
+            container.EmplaceBack(value);
+        }
+    }
+    else
+    {
+        for (auto it = input.rbegin(); it != input.rend(); ++it)
+        {
+            container.PushFront(CountedElement(*it));
+        }
+    }
+}
+
+template <typename TContainer> bool IsSorted(TContainer &container)
+{
+    bool isFirst = true;
+    int previous = 0;
+    for (auto it = container.GetBegin(); it != container.GetEnd(); ++it)
+    {
+        const CountedElement &element = *it;
+        if (!isFirst && element.Value < previous)
+        {
+            return false;
+        }
+        previous = element.Value;
+        isFirst = false;
+    }
+    return true;
+}
+
+template <typename TContainer> void Run(const char *containerName, std::size_t size, bool isCsv)
+{
+    for (unsigned strategy = 0; strategy < std::size(StrategyNames); ++strategy)
+    {
+        for (std::size_t distribution = 0; distribution < std::size(DistributionNames); ++distribution)
+        {
+            TContainer container;
+            Fill(container, MakeInput(distribution, size));
+            counters = SortCounters();
+            container.DSASort(strategy, CountingLess());
+            const SortCounters result = counters;
+            const char *status = IsSorted(container) ? "ok" : "UNSORTED";
+
+            std::printf(isCsv ? "%s,%s,%s,%zu,%llu,%llu,%llu,%llu,%s\n"
+                              : "%-7s %-10s %-11s %8zu %14llu %12llu %12llu %12llu  %s\n",
+                        containerName, StrategyNames[strategy], DistributionNames[distribution], size,
+                        static_cast<unsigned long long>(result.Comparisons),
+                        static_cast<unsigned long long>(result.Swaps), static_cast<unsigned long long>(result.Moves),
+                        static_cast<unsigned long long>(result.Copies), status);
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t size = 2000;
+    bool isCsv = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--csv") == 0)
+        {
+            isCsv = true;
+        }
+        else
+        {
+            size = static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10));
+        }
+    }
+
+    std::printf(isCsv ? "%s,%s,%s,%s,%s,%s,%s,%s,%s\n" : "%-7s %-10s %-11s %8s %14s %12s %12s %12s  %s\n",
+                "container", "strategy", "input", "size", "comparisons", "swaps", "moves", "copies", "status");
+
+    using namespace DSALibraries::Containers;
+    Run<Vector<CountedElement>>("Vector", size, isCsv);
+    Run<SList<CountedElement>>("SList", size, isCsv);
+    Run<DList<CountedElement>>("DList", size, isCsv);
+    Run<CList<CountedElement>>("CList", size, isCsv);
+    return 0;
+}
@@ -0,0 +1,259 @@
+#ifndef DSA_LIBRARIES_BITSET_HPP
+#define DSA_LIBRARIES_BITSET_HPP
+#include "BitsetExceptions.hpp"
+#include "BitsetWords.hpp"
+#include <cstddef>
+#include <cstdint>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Fixed-size set of N bits stored in 64-bit words.
+ * @tparam N Number of bits.
+ */
+template <std::size_t N> class Bitset
+{
+  public:
+    using WordTypeAlias = BitsetWords::WordTypeAlias;
+    using SizeTypeAlias = std::size_t;
+
+    // Adaptive alias
+    using size_type = SizeTypeAlias;
+
+    static constexpr SizeTypeAlias WordCount = BitsetWords::GetWordCount(N);
+    static constexpr SizeTypeAlias NotFound = BitsetWords::NotFound;
+
+  private:
+    WordTypeAlias _words[WordCount == 0 ? 1 : WordCount] = {};
+
+  public:
+    constexpr Bitset() noexcept = default;
+
+    /**
+     * @brief Initialise the low 64 bits from value.
+     */
+    constexpr explicit Bitset(WordTypeAlias value) noexcept
+    {
+        _words[0] = value;
+        this->TrimInternal();
+    }
+
+    [[nodiscard]] static constexpr SizeTypeAlias GetSize() noexcept
+    {
+        return N;
+    }
+
+    [[nodiscard]] constexpr WordTypeAlias *GetData() noexcept
+    {
+        return _words;
+    }
+
+    [[nodiscard]] constexpr const WordTypeAlias *GetData() const noexcept
+    {
+        return _words;
+    }
+
+    [[nodiscard]] constexpr bool operator[](SizeTypeAlias position) const noexcept
+    {
+        return (_words[BitsetWords::GetWordIndex(position)] & BitsetWords::GetBitMask(position)) != 0;
+    }
+
+    [[nodiscard]] constexpr bool Test(SizeTypeAlias position) const
+    {
+        this->CheckPositionInternal(position);
+        return (*this)[position];
+    }
+
+    constexpr Bitset &Set(SizeTypeAlias position, bool value = true)
+    {
+        this->CheckPositionInternal(position);
+        WordTypeAlias &word = _words[BitsetWords::GetWordIndex(position)];
+        if (value)
+        {
+            word |= BitsetWords::GetBitMask(position);
+        }
+        else
+        {
+            word &= ~BitsetWords::GetBitMask(position);
+        }
+        return *this;
+    }
+
+    constexpr Bitset &Set() noexcept
+    {
+        BitsetWords::FillWords(_words, WordCount, ~WordTypeAlias(0));
+        this->TrimInternal();
+        return *this;
+    }
+
+    constexpr Bitset &Reset(SizeTypeAlias position)
+    {
+        return this->Set(position, false);
+    }
+
+    constexpr Bitset &Reset() noexcept
+    {
+        BitsetWords::FillWords(_words, WordCount, 0);
+        return *this;
+    }
+
+    constexpr Bitset &Flip(SizeTypeAlias position)
+    {
+        this->CheckPositionInternal(position);
+        _words[BitsetWords::GetWordIndex(position)] ^= BitsetWords::GetBitMask(position);
+        return *this;
+    }
+
+    constexpr Bitset &Flip() noexcept
+    {
+        BitsetWords::FlipWords(_words, WordCount);
+        this->TrimInternal();
+        return *this;
+    }
+
+    [[nodiscard]] SizeTypeAlias Count() const noexcept
+    {
+        return BitsetWords::PopCount(_words, WordCount);
+    }
+
+    [[nodiscard]] bool Any() const noexcept
+    {
+        return BitsetWords::AnyWords(_words, WordCount);
+    }
+
+    [[nodiscard]] bool None() const noexcept
+    {
+        return !this->Any();
+    }
+
+    [[nodiscard]] bool All() const noexcept
+    {
+        return this->Count() == N;
+    }
+
+    /**
+     * @brief Position of the lowest set bit, NotFound if the set is empty.
+     */
+    [[nodiscard]] SizeTypeAlias FindFirst() const noexcept
+    {
+        return BitsetWords::FindNextWords(_words, WordCount, 0);
+    }
+
+    /**
+     * @brief Position of the lowest set bit strictly after position, NotFound if there is none.
+     */
+    [[nodiscard]] SizeTypeAlias FindNext(SizeTypeAlias position) const noexcept
+    {
+        return position + 1 >= N ? NotFound : BitsetWords::FindNextWords(_words, WordCount, position + 1);
+    }
+
+    /**
+     * @brief Number of set bits in [0, position).
+     */
+    [[nodiscard]] SizeTypeAlias Rank(SizeTypeAlias position) const
+    {
+        if (position > N)
+        {
+            throw BitsetOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return BitsetWords::RankWords(_words, position);
+    }
+
+    /**
+     * @brief Position of the k-th (0-based) set bit, NotFound if fewer than k + 1 bits are set.
+     */
+    [[nodiscard]] SizeTypeAlias Select(SizeTypeAlias k) const noexcept
+    {
+        return BitsetWords::SelectWords(_words, WordCount, k);
+    }
+
+    /**
+     * @brief Size of the intersection with other, without building it.
+     */
+    [[nodiscard]] SizeTypeAlias IntersectionCount(const Bitset &other) const noexcept
+    {
+        return BitsetWords::AndPopCount(_words, other._words, WordCount);
+    }
+
+    Bitset &operator&=(const Bitset &other) noexcept
+    {
+        BitsetWords::AndWords(_words, other._words, WordCount);
+        return *this;
+    }
+
+    Bitset &operator|=(const Bitset &other) noexcept
+    {
+        BitsetWords::OrWords(_words, other._words, WordCount);
+        return *this;
+    }
+
+    Bitset &operator^=(const Bitset &other) noexcept
+    {
+        BitsetWords::XorWords(_words, other._words, WordCount);
+        return *this;
+    }
+
+    /**
+     * @brief Remove every bit that is set in other (set difference).
+     */
+    Bitset &AndNot(const Bitset &other) noexcept
+    {
+        BitsetWords::AndNotWords(_words, other._words, WordCount);
+        return *this;
+    }
+
+    Bitset operator~() const noexcept
+    {
+        Bitset result(*this);
+        result.Flip();
+        return result;
+    }
+
+    friend Bitset operator&(Bitset lhs, const Bitset &rhs) noexcept
+    {
+        return lhs &= rhs;
+    }
+
+    friend Bitset operator|(Bitset lhs, const Bitset &rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    friend Bitset operator^(Bitset lhs, const Bitset &rhs) noexcept
+    {
+        return lhs ^= rhs;
+    }
+
+    friend bool operator==(const Bitset &lhs, const Bitset &rhs) noexcept
+    {
+        return BitsetWords::EqualWords(lhs._words, rhs._words, WordCount);
+    }
+
+    friend bool operator!=(const Bitset &lhs, const Bitset &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+  private:
+    constexpr void CheckPositionInternal(SizeTypeAlias position) const
+    {
+        if (position >= N)
+        {
+            throw BitsetOutOfBoundsException(__FILE__, __LINE__);
+        }
+    }
+
+    /** Clear the bits at and past N, including the spare word that backs a Bitset<0>. */
+    constexpr void TrimInternal() noexcept
+    {
+        if constexpr (WordCount > 0)
+        {
+            _words[WordCount - 1] &= BitsetWords::GetTailMask(N);
+        }
+        else
+        {
+            _words[0] = 0;
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_BITSET_HPP
@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_BITSET_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_BITSET_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class BitsetException : public Utilities::Exception
+{
+  public:
+    BitsetException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class BitsetOutOfBoundsException : public BitsetException
+{
+  public:
+    BitsetOutOfBoundsException(string_type fileText, numeric_type line)
+        : BitsetException("Bit position out of bounds", std::move(fileText), line)
+    {
+    }
+};
+class BitsetSizeMismatchException : public BitsetException
+{
+  public:
+    BitsetSizeMismatchException(string_type fileText, numeric_type line)
+        : BitsetException("Bitsets have different sizes", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,353 @@
+#ifndef DSA_LIBRARIES_BITSET_WORDS_HPP
+#define DSA_LIBRARIES_BITSET_WORDS_HPP
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#if defined(__AVX2__) || defined(__SSSE3__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+namespace DSALibraries::Containers::BitsetWords
+{
+/*
+ * Word-level kernels shared by Bitset and DynamicBitset. Every routine works on whole 64-bit words; callers keep the
+ * unused high bits of the last word cleared so that counts and searches never see them.
+ */
+using WordTypeAlias = std::uint64_t;
+using SizeTypeAlias = std::size_t;
+
+inline constexpr SizeTypeAlias WordBits = 64;
+inline constexpr SizeTypeAlias NotFound = ~SizeTypeAlias(0);
+
+constexpr SizeTypeAlias GetWordCount(SizeTypeAlias bits) noexcept
+{
+    return (bits + WordBits - 1) / WordBits;
+}
+
+constexpr SizeTypeAlias GetWordIndex(SizeTypeAlias position) noexcept
+{
+    return position / WordBits;
+}
+
+constexpr WordTypeAlias GetBitMask(SizeTypeAlias position) noexcept
+{
+    return WordTypeAlias(1) << (position % WordBits);
+}
+
+/**
+ * @brief Mask of the valid bits of the last word of a bitset with the given length.
+ */
+constexpr WordTypeAlias GetTailMask(SizeTypeAlias bits) noexcept
+{
+    return bits % WordBits == 0 ? ~WordTypeAlias(0) : (WordTypeAlias(1) << (bits % WordBits)) - 1;
+}
+
+#if defined(__AVX2__)
+/* Nibble lookup popcount (Mula): vpshufb counts the bits of every nibble, vpsadbw sums the bytes of each lane. */
+inline __m256i PopCountLanesInternal(__m256i value) noexcept
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1,
+                                            2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowMask = _mm256_set1_epi8(0x0f);
+    const __m256i low = _mm256_and_si256(value, lowMask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(value, 4), lowMask);
+    const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+inline SizeTypeAlias HorizontalSumInternal(__m256i value) noexcept
+{
+    return static_cast<SizeTypeAlias>(_mm256_extract_epi64(value, 0) + _mm256_extract_epi64(value, 1) +
+                                      _mm256_extract_epi64(value, 2) + _mm256_extract_epi64(value, 3));
+}
+#elif defined(__SSSE3__)
+inline __m128i PopCountLanesInternal(__m128i value) noexcept
+{
+    const __m128i lookup = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i lowMask = _mm_set1_epi8(0x0f);
+    const __m128i low = _mm_and_si128(value, lowMask);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), lowMask);
+    const __m128i counts = _mm_add_epi8(_mm_shuffle_epi8(lookup, low), _mm_shuffle_epi8(lookup, high));
+    return _mm_sad_epu8(counts, _mm_setzero_si128());
+}
+
+inline SizeTypeAlias HorizontalSumInternal(__m128i value) noexcept
+{
+    return static_cast<SizeTypeAlias>(_mm_cvtsi128_si64(value) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(value, value)));
+}
+#endif
+
+inline SizeTypeAlias PopCount(const WordTypeAlias *words, SizeTypeAlias count) noexcept
+{
+    SizeTypeAlias index = 0;
+    SizeTypeAlias total = 0;
+#if defined(__AVX2__)
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; index + 4 <= count; index += 4)
+    {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + index));
+        accumulator = _mm256_add_epi64(accumulator, PopCountLanesInternal(value));
+    }
+    total = HorizontalSumInternal(accumulator);
+#elif defined(__SSSE3__)
+    __m128i accumulator = _mm_setzero_si128();
+    for (; index + 2 <= count; index += 2)
+    {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + index));
+        accumulator = _mm_add_epi64(accumulator, PopCountLanesInternal(value));
+    }
+    total = HorizontalSumInternal(accumulator);
+#endif
+    for (; index < count; ++index)
+    {
+        total += static_cast<SizeTypeAlias>(std::popcount(words[index]));
+    }
+    return total;
+}
+
+/**
+ * @brief Size of the intersection of two word ranges, without materialising it.
+ */
+inline SizeTypeAlias AndPopCount(const WordTypeAlias *lhs, const WordTypeAlias *rhs, SizeTypeAlias count) noexcept
+{
+    SizeTypeAlias index = 0;
+    SizeTypeAlias total = 0;
+#if defined(__AVX2__)
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; index + 4 <= count; index += 4)
+    {
+        const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + index));
+        const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + index));
+        accumulator = _mm256_add_epi64(accumulator, PopCountLanesInternal(_mm256_and_si256(left, right)));
+    }
+    total = HorizontalSumInternal(accumulator);
+#elif defined(__SSSE3__)
+    __m128i accumulator = _mm_setzero_si128();
+    for (; index + 2 <= count; index += 2)
+    {
+        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + index));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + index));
+        accumulator = _mm_add_epi64(accumulator, PopCountLanesInternal(_mm_and_si128(left, right)));
+    }
+    total = HorizontalSumInternal(accumulator);
+#endif
+    for (; index < count; ++index)
+    {
+        total += static_cast<SizeTypeAlias>(std::popcount(lhs[index] & rhs[index]));
+    }
+    return total;
+}
+
+/*
+ * Bulk binary operations. Each operation type provides a scalar overload and, when AVX2 is enabled, a 256-bit overload
+ * used for the bulk of the range.
+ */
+struct AndOperation
+{
+    WordTypeAlias operator()(WordTypeAlias lhs, WordTypeAlias rhs) const noexcept
+    {
+        return lhs & rhs;
+    }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i lhs, __m256i rhs) const noexcept
+    {
+        return _mm256_and_si256(lhs, rhs);
+    }
+#endif
+};
+
+struct OrOperation
+{
+    WordTypeAlias operator()(WordTypeAlias lhs, WordTypeAlias rhs) const noexcept
+    {
+        return lhs | rhs;
+    }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i lhs, __m256i rhs) const noexcept
+    {
+        return _mm256_or_si256(lhs, rhs);
+    }
+#endif
+};
+
+struct XorOperation
+{
+    WordTypeAlias operator()(WordTypeAlias lhs, WordTypeAlias rhs) const noexcept
+    {
+        return lhs ^ rhs;
+    }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i lhs, __m256i rhs) const noexcept
+    {
+        return _mm256_xor_si256(lhs, rhs);
+    }
+#endif
+};
+
+struct AndNotOperation
+{
+    WordTypeAlias operator()(WordTypeAlias lhs, WordTypeAlias rhs) const noexcept
+    {
+        return lhs & ~rhs;
+    }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i lhs, __m256i rhs) const noexcept
+    {
+        // _mm256_andnot_si256 computes ~first & second
+        return _mm256_andnot_si256(rhs, lhs);
+    }
+#endif
+};
+
+template <typename TOperation>
+inline void TransformWords(WordTypeAlias *destination, const WordTypeAlias *source, SizeTypeAlias count,
+                           TOperation operation) noexcept
+{
+    SizeTypeAlias index = 0;
+#if defined(__AVX2__)
+    for (; index + 4 <= count; index += 4)
+    {
+        const __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(destination + index));
+        const __m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + index));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index), operation(lhs, rhs));
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        destination[index] = operation(destination[index], source[index]);
+    }
+}
+
+inline void AndWords(WordTypeAlias *destination, const WordTypeAlias *source, SizeTypeAlias count) noexcept
+{
+    TransformWords(destination, source, count, AndOperation());
+}
+
+inline void OrWords(WordTypeAlias *destination, const WordTypeAlias *source, SizeTypeAlias count) noexcept
+{
+    TransformWords(destination, source, count, OrOperation());
+}
+
+inline void XorWords(WordTypeAlias *destination, const WordTypeAlias *source, SizeTypeAlias count) noexcept
+{
+    TransformWords(destination, source, count, XorOperation());
+}
+
+inline void AndNotWords(WordTypeAlias *destination, const WordTypeAlias *source, SizeTypeAlias count) noexcept
+{
+    TransformWords(destination, source, count, AndNotOperation());
+}
+
+constexpr void FillWords(WordTypeAlias *destination, SizeTypeAlias count, WordTypeAlias value) noexcept
+{
+    for (SizeTypeAlias index = 0; index < count; ++index)
+    {
+        destination[index] = value;
+    }
+}
+
+constexpr void FlipWords(WordTypeAlias *destination, SizeTypeAlias count) noexcept
+{
+    for (SizeTypeAlias index = 0; index < count; ++index)
+    {
+        destination[index] = ~destination[index];
+    }
+}
+
+inline bool EqualWords(const WordTypeAlias *lhs, const WordTypeAlias *rhs, SizeTypeAlias count) noexcept
+{
+    for (SizeTypeAlias index = 0; index < count; ++index)
+    {
+        if (lhs[index] != rhs[index])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool AnyWords(const WordTypeAlias *words, SizeTypeAlias count) noexcept
+{
+    for (SizeTypeAlias index = 0; index < count; ++index)
+    {
+        if (words[index])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Position of the first set bit at or after position, NotFound if there is none.
+ */
+inline SizeTypeAlias FindNextWords(const WordTypeAlias *words, SizeTypeAlias count, SizeTypeAlias position) noexcept
+{
+    SizeTypeAlias index = GetWordIndex(position);
+    if (index >= count)
+    {
+        return NotFound;
+    }
+
+    WordTypeAlias word = words[index] & (~WordTypeAlias(0) << (position % WordBits));
+    while (true)
+    {
+        if (word)
+        {
+            return index * WordBits + static_cast<SizeTypeAlias>(std::countr_zero(word));
+        }
+        if (++index == count)
+        {
+            return NotFound;
+        }
+        word = words[index];
+    }
+}
+
+/**
+ * @brief Position of the k-th (0-based) set bit of a word. The word must hold more than k set bits.
+ */
+inline SizeTypeAlias SelectInWord(WordTypeAlias word, SizeTypeAlias k) noexcept
+{
+#if defined(__BMI2__)
+    return static_cast<SizeTypeAlias>(std::countr_zero(_pdep_u64(WordTypeAlias(1) << k, word)));
+#else
+    for (; k > 0; --k)
+    {
+        word &= word - 1;
+    }
+    return static_cast<SizeTypeAlias>(std::countr_zero(word));
+#endif
+}
+
+/**
+ * @brief Number of set bits in [0, position).
+ */
+inline SizeTypeAlias RankWords(const WordTypeAlias *words, SizeTypeAlias position) noexcept
+{
+    const SizeTypeAlias index = GetWordIndex(position);
+    SizeTypeAlias total = PopCount(words, index);
+    if (position % WordBits)
+    {
+        total += static_cast<SizeTypeAlias>(std::popcount(words[index] & (GetBitMask(position) - 1)));
+    }
+    return total;
+}
+
+/**
+ * @brief Position of the k-th (0-based) set bit, NotFound if fewer bits are set.
+ */
+inline SizeTypeAlias SelectWords(const WordTypeAlias *words, SizeTypeAlias count, SizeTypeAlias k) noexcept
+{
+    for (SizeTypeAlias index = 0; index < count; ++index)
+    {
+        const auto ones = static_cast<SizeTypeAlias>(std::popcount(words[index]));
+        if (k < ones)
+        {
+            return index * WordBits + SelectInWord(words[index], k);
+        }
+        k -= ones;
+    }
+    return NotFound;
+}
+} // namespace DSALibraries::Containers::BitsetWords
+#endif // DSA_LIBRARIES_BITSET_WORDS_HPP
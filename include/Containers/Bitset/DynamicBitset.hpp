@@ -0,0 +1,406 @@
+#ifndef DSA_LIBRARIES_DYNAMIC_BITSET_HPP
+#define DSA_LIBRARIES_DYNAMIC_BITSET_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../Vector/Vector.hpp"
+#include "BitsetExceptions.hpp"
+#include "BitsetWords.hpp"
+#include <cstddef>
+#include <cstdint>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Resizable set of bits stored in a Vector of 64-bit words.
+ *
+ * Rank and Select scan the words by default. BuildRankIndex records the number of set bits before every 512-bit
+ * block, after which Rank is O(1) and Select is a binary search over blocks. Any mutation drops the index.
+ *
+ * @tparam Alloc Allocator of the 64-bit words.
+ */
+template <typename Alloc = Utilities::Allocator<std::uint64_t>> class DynamicBitset
+{
+  public:
+    using WordTypeAlias = BitsetWords::WordTypeAlias;
+    using SizeTypeAlias = std::size_t;
+    using AllocatorTypeAlias = Alloc;
+    using WordVectorAlias = Vector<WordTypeAlias, Alloc>;
+
+    // Adaptive alias
+    using size_type = SizeTypeAlias;
+    using allocator_type = AllocatorTypeAlias;
+
+    static constexpr SizeTypeAlias NotFound = BitsetWords::NotFound;
+    static constexpr SizeTypeAlias WordsPerRankBlock = 8;
+
+  private:
+    WordVectorAlias _words;
+    WordVectorAlias _rankBlocks;
+    SizeTypeAlias _size = 0;
+
+  public:
+    DynamicBitset() = default;
+
+    explicit DynamicBitset(const AllocatorTypeAlias &alloc) : _words(alloc), _rankBlocks(alloc)
+    {
+    }
+
+    explicit DynamicBitset(SizeTypeAlias size, bool value = false,
+                           const AllocatorTypeAlias &alloc = AllocatorTypeAlias())
+        : _words(BitsetWords::GetWordCount(size), alloc), _rankBlocks(alloc), _size(size)
+    {
+        if (value)
+        {
+            this->Set();
+        }
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetWordCount() const noexcept
+    {
+        return _words.GetSize();
+    }
+
+    [[nodiscard]] WordTypeAlias *GetData() noexcept
+    {
+        return _words.GetData();
+    }
+
+    [[nodiscard]] const WordTypeAlias *GetData() const noexcept
+    {
+        return _words.GetData();
+    }
+
+    void Resize(SizeTypeAlias size, bool value = false)
+    {
+        const SizeTypeAlias oldSize = _size;
+        _words.Resize(BitsetWords::GetWordCount(size));
+        _size = size;
+        this->InvalidateRankIndexInternal();
+
+        if (size > oldSize)
+        {
+            // bits above the old size are zero because the last word is always trimmed
+            if (value)
+            {
+                for (SizeTypeAlias position = oldSize; position < size && position % BitsetWords::WordBits != 0;
+                     ++position)
+                {
+                    _words[BitsetWords::GetWordIndex(position)] |= BitsetWords::GetBitMask(position);
+                }
+                const SizeTypeAlias firstFullWord = BitsetWords::GetWordCount(oldSize);
+                BitsetWords::FillWords(_words.GetData() + firstFullWord, _words.GetSize() - firstFullWord,
+                                       ~WordTypeAlias(0));
+            }
+        }
+        this->TrimInternal();
+    }
+
+    void PushBack(bool value)
+    {
+        this->Resize(_size + 1);
+        if (value)
+        {
+            _words[BitsetWords::GetWordIndex(_size - 1)] |= BitsetWords::GetBitMask(_size - 1);
+        }
+    }
+
+    void Clear() noexcept
+    {
+        _words.Clear();
+        _size = 0;
+        this->InvalidateRankIndexInternal();
+    }
+
+    [[nodiscard]] bool operator[](SizeTypeAlias position) const noexcept
+    {
+        return (_words[BitsetWords::GetWordIndex(position)] & BitsetWords::GetBitMask(position)) != 0;
+    }
+
+    [[nodiscard]] bool Test(SizeTypeAlias position) const
+    {
+        this->CheckPositionInternal(position);
+        return (*this)[position];
+    }
+
+    DynamicBitset &Set(SizeTypeAlias position, bool value = true)
+    {
+        this->CheckPositionInternal(position);
+        WordTypeAlias &word = _words[BitsetWords::GetWordIndex(position)];
+        if (value)
+        {
+            word |= BitsetWords::GetBitMask(position);
+        }
+        else
+        {
+            word &= ~BitsetWords::GetBitMask(position);
+        }
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &Set() noexcept
+    {
+        BitsetWords::FillWords(_words.GetData(), _words.GetSize(), ~WordTypeAlias(0));
+        this->TrimInternal();
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &Reset(SizeTypeAlias position)
+    {
+        return this->Set(position, false);
+    }
+
+    DynamicBitset &Reset() noexcept
+    {
+        BitsetWords::FillWords(_words.GetData(), _words.GetSize(), 0);
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &Flip(SizeTypeAlias position)
+    {
+        this->CheckPositionInternal(position);
+        _words[BitsetWords::GetWordIndex(position)] ^= BitsetWords::GetBitMask(position);
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &Flip() noexcept
+    {
+        BitsetWords::FlipWords(_words.GetData(), _words.GetSize());
+        this->TrimInternal();
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    [[nodiscard]] SizeTypeAlias Count() const noexcept
+    {
+        return BitsetWords::PopCount(_words.GetData(), _words.GetSize());
+    }
+
+    [[nodiscard]] bool Any() const noexcept
+    {
+        return BitsetWords::AnyWords(_words.GetData(), _words.GetSize());
+    }
+
+    [[nodiscard]] bool None() const noexcept
+    {
+        return !this->Any();
+    }
+
+    [[nodiscard]] bool All() const noexcept
+    {
+        return this->Count() == _size;
+    }
+
+    [[nodiscard]] SizeTypeAlias FindFirst() const noexcept
+    {
+        return BitsetWords::FindNextWords(_words.GetData(), _words.GetSize(), 0);
+    }
+
+    /**
+     * @brief Position of the lowest set bit strictly after position, NotFound if there is none.
+     */
+    [[nodiscard]] SizeTypeAlias FindNext(SizeTypeAlias position) const noexcept
+    {
+        return position + 1 >= _size ? NotFound
+                                     : BitsetWords::FindNextWords(_words.GetData(), _words.GetSize(), position + 1);
+    }
+
+    /**
+     * @brief Precompute the per-block counts used by Rank and Select.
+     */
+    void BuildRankIndex()
+    {
+        const SizeTypeAlias blockCount = (_words.GetSize() + WordsPerRankBlock - 1) / WordsPerRankBlock;
+        _rankBlocks.Clear();
+        _rankBlocks.Reverse(blockCount + 1);
+
+        WordTypeAlias total = 0;
+        for (SizeTypeAlias block = 0; block < blockCount; ++block)
+        {
+            _rankBlocks.PushBack(total);
+            const SizeTypeAlias first = block * WordsPerRankBlock;
+            const SizeTypeAlias count =
+                first + WordsPerRankBlock <= _words.GetSize() ? WordsPerRankBlock : _words.GetSize() - first;
+            total += BitsetWords::PopCount(_words.GetData() + first, count);
+        }
+        _rankBlocks.PushBack(total);
+    }
+
+    [[nodiscard]] bool HasRankIndex() const noexcept
+    {
+        return !_rankBlocks.IsEmpty();
+    }
+
+    /**
+     * @brief Number of set bits in [0, position).
+     */
+    [[nodiscard]] SizeTypeAlias Rank(SizeTypeAlias position) const
+    {
+        if (position > _size)
+        {
+            throw BitsetOutOfBoundsException(__FILE__, __LINE__);
+        }
+
+        if (!this->HasRankIndex())
+        {
+            return BitsetWords::RankWords(_words.GetData(), position);
+        }
+
+        const SizeTypeAlias word = BitsetWords::GetWordIndex(position);
+        const SizeTypeAlias block = word / WordsPerRankBlock;
+        const SizeTypeAlias blockStart = block * WordsPerRankBlock;
+        SizeTypeAlias total = static_cast<SizeTypeAlias>(_rankBlocks[block]) +
+                              BitsetWords::PopCount(_words.GetData() + blockStart, word - blockStart);
+        if (position % BitsetWords::WordBits)
+        {
+            total += static_cast<SizeTypeAlias>(
+                std::popcount(_words[word] & (BitsetWords::GetBitMask(position) - 1)));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Position of the k-th (0-based) set bit, NotFound if fewer than k + 1 bits are set.
+     */
+    [[nodiscard]] SizeTypeAlias Select(SizeTypeAlias k) const noexcept
+    {
+        if (!this->HasRankIndex())
+        {
+            return BitsetWords::SelectWords(_words.GetData(), _words.GetSize(), k);
+        }
+
+        const SizeTypeAlias blockCount = _rankBlocks.GetSize() - 1;
+        if (k >= _rankBlocks[blockCount])
+        {
+            return NotFound;
+        }
+
+        // last block whose prefix count is <= k
+        SizeTypeAlias low = 0;
+        SizeTypeAlias high = blockCount;
+        while (high - low > 1)
+        {
+            const SizeTypeAlias middle = low + (high - low) / 2;
+            if (_rankBlocks[middle] <= k)
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        const SizeTypeAlias first = low * WordsPerRankBlock;
+        const SizeTypeAlias found = BitsetWords::SelectWords(_words.GetData() + first, _words.GetSize() - first,
+                                                             k - static_cast<SizeTypeAlias>(_rankBlocks[low]));
+        return first * BitsetWords::WordBits + found;
+    }
+
+    [[nodiscard]] SizeTypeAlias IntersectionCount(const DynamicBitset &other) const
+    {
+        this->CheckSizeInternal(other);
+        return BitsetWords::AndPopCount(_words.GetData(), other._words.GetData(), _words.GetSize());
+    }
+
+    DynamicBitset &operator&=(const DynamicBitset &other)
+    {
+        this->CheckSizeInternal(other);
+        BitsetWords::AndWords(_words.GetData(), other._words.GetData(), _words.GetSize());
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &operator|=(const DynamicBitset &other)
+    {
+        this->CheckSizeInternal(other);
+        BitsetWords::OrWords(_words.GetData(), other._words.GetData(), _words.GetSize());
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &operator^=(const DynamicBitset &other)
+    {
+        this->CheckSizeInternal(other);
+        BitsetWords::XorWords(_words.GetData(), other._words.GetData(), _words.GetSize());
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    DynamicBitset &AndNot(const DynamicBitset &other)
+    {
+        this->CheckSizeInternal(other);
+        BitsetWords::AndNotWords(_words.GetData(), other._words.GetData(), _words.GetSize());
+        this->InvalidateRankIndexInternal();
+        return *this;
+    }
+
+    friend DynamicBitset operator&(DynamicBitset lhs, const DynamicBitset &rhs)
+    {
+        return lhs &= rhs;
+    }
+
+    friend DynamicBitset operator|(DynamicBitset lhs, const DynamicBitset &rhs)
+    {
+        return lhs |= rhs;
+    }
+
+    friend DynamicBitset operator^(DynamicBitset lhs, const DynamicBitset &rhs)
+    {
+        return lhs ^= rhs;
+    }
+
+    friend bool operator==(const DynamicBitset &lhs, const DynamicBitset &rhs) noexcept
+    {
+        return lhs._size == rhs._size &&
+               BitsetWords::EqualWords(lhs._words.GetData(), rhs._words.GetData(), lhs._words.GetSize());
+    }
+
+    friend bool operator!=(const DynamicBitset &lhs, const DynamicBitset &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+  private:
+    void CheckPositionInternal(SizeTypeAlias position) const
+    {
+        if (position >= _size)
+        {
+            throw BitsetOutOfBoundsException(__FILE__, __LINE__);
+        }
+    }
+
+    void CheckSizeInternal(const DynamicBitset &other) const
+    {
+        if (_size != other._size)
+        {
+            throw BitsetSizeMismatchException(__FILE__, __LINE__);
+        }
+    }
+
+    void TrimInternal() noexcept
+    {
+        if (!_words.IsEmpty())
+        {
+            _words.GetItemBack() &= BitsetWords::GetTailMask(_size);
+        }
+    }
+
+    void InvalidateRankIndexInternal() noexcept
+    {
+        _rankBlocks.Clear();
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_DYNAMIC_BITSET_HPP
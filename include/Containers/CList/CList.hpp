@@ -1,10 +1,16 @@
 #ifndef DSA_LIBRARIES_CLIST_HPP
 #define DSA_LIBRARIES_CLIST_HPP
 #include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Instrumentation.hpp"
+#include "../../Utilities/NodePool.hpp"
+#include "../../Utilities/NodeSlabs.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "../LoserTree/LoserTree.hpp"
 #include "CListIterator.hpp"
 #include "CListNode.hpp"
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -12,16 +18,20 @@
 using namespace DSALibraries::Utilities;
 namespace DSALibraries::Containers
 {
+template <typename T, typename Alloc> class CList;
+
 template <typename T, typename Alloc> class CListBase
 {
   protected:
     using TypeAllocatorTraitsAlias = std::allocator_traits<Alloc>;
     using NodeAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<CListNode<T>>;
     using TpAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<T>;
+    using NodeSlabsAlias = Utilities::NodeSlabs<CListNode<T>, NodeAllocatorTypeAlias>;
 
     struct CListCore : public NodeAllocatorTypeAlias
     {
         CListNodeBase NodeHead;
+        Utilities::NodePool<CListNode<T>, NodeAllocatorTypeAlias> Pool;
 
         CListCore() : NodeAllocatorTypeAlias(), NodeHead()
         {
@@ -97,6 +107,7 @@ template <typename T, typename Alloc> class CListBase
     ~CListBase() noexcept
     {
         this->EraseAfterInternal(&this->LinkedListCore.NodeHead, &this->LinkedListCore.NodeHead);
+        this->ReleaseNodePoolInternal();
     }
 
   protected:
@@ -154,12 +165,117 @@ template <typename T, typename Alloc> class CListBase
 
     NodeAlias* GetNode()
     {
-        return static_cast<NodeAlias*>(this->LinkedListCore.NodeAllocatorTypeAlias::allocate(1));
+        if (NodeAlias* node = this->LinkedListCore.Pool.Pop())
+        {
+            return node;
+        }
+        NodeAlias* node = NodeSlabsAlias::AllocateOne(this->GetNodeAllocator());
+        Utilities::InstrumentationHooks<CList<T, Alloc>>::OnAllocation(sizeof(NodeAlias));
+        return node;
     }
 
     void PutNode(CListNode<T>* node)
     {
-        this->LinkedListCore.NodeAllocatorTypeAlias::deallocate(node, 1);
+        if (this->LinkedListCore.Pool.Push(node))
+        {
+            return;
+        }
+        ReportNodesFreedInternal(NodeSlabsAlias::Deallocate(this->GetNodeAllocator(), node));
+    }
+
+    void ReserveNodesInternal(std::size_t count)
+    {
+        if (const std::size_t bytes = this->LinkedListCore.Pool.Reserve(this->GetNodeAllocator(), count))
+        {
+            Utilities::InstrumentationHooks<CList<T, Alloc>>::OnAllocation(bytes);
+        }
+    }
+
+    void SetNodePoolLimitInternal(std::size_t limit) noexcept
+    {
+        this->LinkedListCore.Pool.SetLimit(this->GetNodeAllocator(), limit, &ReportNodesFreedInternal);
+    }
+
+    void ReleaseNodePoolInternal() noexcept
+    {
+        this->LinkedListCore.Pool.Release(this->GetNodeAllocator(), &ReportNodesFreedInternal);
+    }
+
+    /** Report one allocator call per lone node or slab given back; bytes is 0 while a node's slab is in use. */
+    static void ReportNodesFreedInternal(std::size_t bytes) noexcept
+    {
+        if (bytes != 0)
+        {
+            Utilities::InstrumentationHooks<CList<T, Alloc>>::OnDeallocation(bytes);
+        }
+    }
+
+    /** Allocate size contiguous nodes: one slab, or a single, possibly cached, node when size is 1. */
+    NodeAlias* AllocateNodesInternal(std::size_t size)
+    {
+        if (size == 1)
+        {
+            return this->GetNode();
+        }
+        NodeAlias* slab = NodeSlabsAlias::Allocate(this->GetNodeAllocator(), size);
+        Utilities::InstrumentationHooks<CList<T, Alloc>>::OnAllocation(NodeSlabsAlias::GetSlabBytes(size));
+        return slab;
+    }
+
+    /**
+     * Allocate size contiguous nodes and construct their elements in order by calling construct with each element's
+     * storage. The nodes are returned unlinked. On exception the built elements are destroyed and every node is
+     * released, so the list is left as it was.
+     */
+    template <typename TConstruct> NodeAlias* CreateNodesInternal(std::size_t size, TConstruct construct)
+    {
+        NodeAlias* nodes = this->AllocateNodesInternal(size);
+        std::size_t built = 0;
+        try
+        {
+            for (; built < size; ++built)
+            {
+                construct(nodes[built].GetData());
+            }
+        }
+        catch (...)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (i < built)
+                {
+                    this->GetTAllocator().destroy(nodes[i].GetData());
+                }
+                this->PutNode(nodes + i);
+            }
+            throw;
+        }
+        return nodes;
+    }
+
+    /** Link size contiguous nodes behind pos in order and return the last one. */
+    NodeBaseAlias* LinkNodesAfterInternal(NodeBaseAlias* pos, NodeAlias* nodes, std::size_t size) noexcept
+    {
+        for (std::size_t i = 0; i + 1 < size; ++i)
+        {
+            this->JoinTwoNodes(nodes + i, nodes + i + 1);
+        }
+        NodeAlias* last = nodes + size - 1;
+        this->JoinTwoNodes(last, pos->PointerNext);
+        this->JoinTwoNodes(pos, nodes);
+        return last;
+    }
+
+    /**
+     * Move the size elements starting at first into new contiguous nodes, in order, and return them unlinked. On
+     * exception the nodes are released and the source elements are left as move_if_noexcept left them.
+     */
+    NodeAlias* MoveToSlabInternal(NodeBaseAlias* first, std::size_t size)
+    {
+        return this->CreateNodesInternal(size, [this, &first](T* data) {
+            this->GetTAllocator().construct(data, std::move_if_noexcept(*static_cast<NodeAlias*>(first)->GetData()));
+            first = first->PointerNext;
+        });
     }
 
     template <typename... Args> NodeAlias* CreateNodeInternal(Args&&... args)
@@ -173,6 +289,7 @@ template <typename T, typename Alloc> class CListBase
         catch (...)
         {
             this->PutNode(node);
+            throw;
         }
         return node;
     }
@@ -188,6 +305,7 @@ template <typename T, typename Alloc> class CListBase
         catch (...)
         {
             this->PutNode(node);
+            throw;
         }
         return node;
     }
@@ -445,31 +563,29 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
 
     IteratorAlias InsertAfter(ConstIteratorAlias pos, SizeTypeAlias size, const T& value)
     {
-        if (size)
-        {
-            CList temp(size, value, this->GetNodeAllocator());
-            return this->SpliceAfterInternal(pos, ConstIteratorAlias(&this->LinkedListCore.NodeHead),
-                                             temp.GetConstEnd());
-        }
-        else
-        {
-            return IteratorAlias(const_cast<NodeBaseAlias*>(pos.NodeBase));
-        }
+        return IteratorAlias(this->FillInsertAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase), size, value));
     }
 
     template <typename InputIterator>
     IteratorAlias InsertAfter(ConstIteratorAlias pos, InputIterator first, InputIterator last)
     {
-        CList temp(first, last, this->GetNodeAllocator());
-
-        if (!temp.IsEmpty())
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            return this->SpliceAfterInternal(pos, ConstIteratorAlias(&this->LinkedListCore.NodeHead),
-                                             temp.GetConstEnd());
+            return IteratorAlias(this->RangeInsertAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase), first, last));
         }
         else
         {
-            return IteratorAlias(const_cast<NodeBaseAlias*>(pos.NodeBase));
+            CList temp(first, last, this->GetNodeAllocator());
+
+            if (!temp.IsEmpty())
+            {
+                return this->SpliceAfterInternal(pos, ConstIteratorAlias(&temp.LinkedListCore.NodeHead),
+                                                 temp.GetConstEnd());
+            }
+            else
+            {
+                return IteratorAlias(const_cast<NodeBaseAlias*>(pos.NodeBase));
+            }
         }
     }
 
@@ -661,8 +777,41 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         this->Merge(std::move(sll), std::less<T>());
     }
 
-    template <typename TCompare> void Sort(TCompare compare)
+    /**
+     * @brief Merge the sorted lists into this sorted list in one relinking pass, with a LoserTree over the list fronts:
+     * O(n log k) comparisons for k lists and no node allocation. Equal elements come from this list first, then from
+     * the lists in argument order. The lists are left empty and must use an allocator equal to this one.
+     */
+    template <typename TCompare, typename... TLists>
+        requires(!std::is_same_v<std::remove_cvref_t<TCompare>, CList> && (std::is_same_v<TLists, CList> && ...))
+    void MergeAll(TCompare compare, TLists&... lists)
+    {
+        CList* sources[] = {this, std::addressof(lists)...};
+        this->MergeAllInternal([&sources](SizeTypeAlias i) { return sources[i]; }, sizeof...(TLists) + 1, compare);
+    }
+
+    template <typename... TLists>
+        requires(std::is_same_v<TLists, CList> && ...)
+    void MergeAll(TLists&... lists)
+    {
+        this->MergeAll(std::less<T>(), lists...);
+    }
+
+    /** @brief MergeAll over the count lists stored from lists on, such as the shards kept in a Vector. */
+    template <typename TCompare> void MergeAll(CList* lists, SizeTypeAlias count, TCompare compare)
+    {
+        this->MergeAllInternal([this, lists](SizeTypeAlias i) { return i == 0 ? this : lists + i - 1; }, count + 1,
+                               compare);
+    }
+
+    void MergeAll(CList* lists, SizeTypeAlias count)
+    {
+        this->MergeAll(lists, count, std::less<T>());
+    }
+
+    template <typename TCompare> void Sort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         // MergeHelper sort for circular single linked list
 
         IteratorAlias pLeft;
@@ -675,6 +824,7 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         SizeTypeAlias numberOfMerge;
         SizeTypeAlias leftSize;
         SizeTypeAlias rightSize;
+        SizeTypeAlias nodeWalks = 0;
 
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -699,6 +849,7 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
                 {
                     ++leftSize;
                     ++pRight;
+                    ++nodeWalks;
                     if (pRight == this->GetEnd())
                     {
                         break;
@@ -747,10 +898,13 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
                     }
 
                     pTail.NodeBase->PointerNext = this->GetEnd().NodeBase;
+                    ++nodeWalks;
                 }
                 pLeft = pRight;
             }
 
+            Utilities::InstrumentationHooks<CList>::OnNodeWalks(nodeWalks);
+            nodeWalks = 0;
             if (numberOfMerge <= 1)
             {
                 return;
@@ -799,45 +953,115 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         this->LinkedListCore.NodeHead.ReverseAfter();
     }
 
-  private:
-    void FillInitializeInternal(SizeTypeAlias size, const T& value)
+    /**
+     * @brief Move every element into one slab of nodes laid out in iteration order and relink them, so later scans
+     * walk memory front to back. Invalidates iterators; if an element's move throws, the list is unchanged.
+     */
+    void Compact()
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-        while (size)
+        const SizeTypeAlias size = this->GetSize();
+        if (size == 0)
         {
-            temp->PointerNext = this->CreateNodeInternal(value);
-            temp = temp->PointerNext;
-            --size;
+            return;
         }
-        this->JoinTwoNodes(temp, &this->LinkedListCore.NodeHead);
+        NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        NodeAlias* slab = this->MoveToSlabInternal(head.PointerNext, size);
+        this->EraseAfterInternal(&head, &head);
+        this->LinkNodesAfterInternal(&head, slab, size);
     }
 
-    void DefaultInitializeInternal(SizeTypeAlias size)
+    /** @brief Fraction of links that jump elsewhere in memory instead of to the adjacent node; 0 after Compact. */
+    [[nodiscard]] double GetScatter() const noexcept
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-        while (size)
+        const NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        Utilities::NodeScatter<NodeAlias> scatter;
+        for (const NodeBaseAlias* node = head.PointerNext; node != &head; node = node->PointerNext)
         {
-            temp->PointerNext = this->CreateNodeInternal();
-            temp = temp->PointerNext;
-            --size;
+            scatter.Visit(static_cast<const NodeAlias*>(node));
         }
-        this->JoinTwoNodes(temp, &this->LinkedListCore.NodeHead);
+        return scatter.GetScatter();
     }
 
-    void DefaultInsertAfterInternal(ConstIteratorAlias pos, SizeTypeAlias size)
+    /**
+     * @brief Keep up to limit erased nodes for reuse by later inserts instead of freeing them. 0, the default, turns
+     * recycling off; lowering the limit frees the surplus.
+     */
+    void SetNodeCacheLimit(SizeTypeAlias limit) noexcept
     {
-        ConstIteratorAlias savePos = pos;
-        try
+        this->SetNodePoolLimitInternal(limit);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetNodeCacheLimit() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetLimit();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCachedNodeCount() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetCount();
+    }
+
+    /**
+     * @brief Cache at least count spare nodes, allocated together in one call, so the next count inserts do not
+     * allocate. Raises the cache limit to count if it is lower.
+     */
+    void Reserve(SizeTypeAlias count)
+    {
+        this->ReserveNodesInternal(count);
+    }
+
+    /** @brief Free every cached node. The cache limit is kept. */
+    void ShrinkToFit() noexcept
+    {
+        this->ReleaseNodePoolInternal();
+    }
+
+  private:
+    /** Insert size copies of value behind pos from one slab and return the last one, or pos when size is 0. */
+    NodeBaseAlias* FillInsertAfterInternal(NodeBaseAlias* pos, SizeTypeAlias size, const T& value)
+    {
+        if (size == 0)
         {
-            for (; size; --size)
-            {
-                pos = this->EmplaceAfter(pos);
-            }
+            return pos;
         }
-        catch (...)
+        NodeAlias* nodes =
+            this->CreateNodesInternal(size, [this, &value](T* data) { this->GetTAllocator().construct(data, value); });
+        return this->LinkNodesAfterInternal(pos, nodes, size);
+    }
+
+    /** Forward range counterpart of FillInsertAfterInternal: count the range, then build it in one slab. */
+    template <typename ForwardIterator>
+    NodeBaseAlias* RangeInsertAfterInternal(NodeBaseAlias* pos, ForwardIterator first, ForwardIterator last)
+    {
+        const auto size = static_cast<SizeTypeAlias>(std::distance(first, last));
+        if (size == 0)
         {
-            this->EraseAfter(savePos, pos);
-            throw;
+            return pos;
+        }
+        NodeAlias* nodes = this->CreateNodesInternal(size, [this, &first](T* data) {
+            this->GetTAllocator().construct(data, *first);
+            ++first;
+        });
+        return this->LinkNodesAfterInternal(pos, nodes, size);
+    }
+
+    void FillInitializeInternal(SizeTypeAlias size, const T& value)
+    {
+        this->FillInsertAfterInternal(&this->LinkedListCore.NodeHead, size, value);
+    }
+
+    void DefaultInitializeInternal(SizeTypeAlias size)
+    {
+        this->DefaultInsertAfterInternal(ConstIteratorAlias(&this->LinkedListCore.NodeHead), size);
+    }
+
+    void DefaultInsertAfterInternal(ConstIteratorAlias pos, SizeTypeAlias size)
+    {
+        if (size != 0)
+        {
+            NodeAlias* nodes =
+                this->CreateNodesInternal(size, [this](T* data) { this->GetTAllocator().construct(data); });
+            this->LinkNodesAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase), nodes, size);
         }
     }
 
@@ -864,16 +1088,88 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         }
     }
 
+    /** Forward ranges are built in one slab; input ranges, which cannot be counted first, go node by node. */
     template <typename InputIterator> void RangeInitializeInternal(InputIterator first, InputIterator last)
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-        while (first != last)
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            temp->PointerNext = this->CreateNodeInternal(*first);
-            temp = temp->PointerNext;
-            ++first;
+            this->RangeInsertAfterInternal(&this->LinkedListCore.NodeHead, first, last);
+        }
+        else
+        {
+            // Close the ring after every node so a throwing element leaves a list the destructor can walk.
+            NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
+            while (first != last)
+            {
+                temp->PointerNext = this->CreateNodeInternal(*first);
+                temp = temp->PointerNext;
+                this->JoinTwoNodes(temp, &this->LinkedListCore.NodeHead);
+                ++first;
+            }
         }
-        this->JoinTwoNodes(temp, &this->LinkedListCore.NodeHead);
+    }
+
+    /**
+     * Relink the nodes of the count sorted lists given by sources(i) into this list, which is sources(0). Each chain
+     * ends where it links back to its own head. A list given twice is merged once. If compare throws, the nodes not
+     * merged yet are appended unsorted, so none is lost.
+     */
+    template <typename TSources, typename TCompare>
+    void MergeAllInternal(TSources sources, SizeTypeAlias count, TCompare compare)
+    {
+        auto byValue = [&compare](const NodeBaseAlias* lhs, const NodeBaseAlias* rhs) {
+            return compare(*static_cast<const NodeAlias*>(lhs)->GetData(),
+                           *static_cast<const NodeAlias*>(rhs)->GetData());
+        };
+        LoserTree<NodeBaseAlias*, decltype(byValue)> tree(count, byValue);
+        Vector<NodeBaseAlias*> heads(count, nullptr);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            NodeBaseAlias* head = &sources(i)->LinkedListCore.NodeHead;
+            if (head->PointerNext != head)
+            {
+                heads[i] = std::exchange(head->PointerNext, head);
+                tree.SetSource(i, heads[i]);
+            }
+        }
+
+        NodeBaseAlias* tail = &this->LinkedListCore.NodeHead;
+        try
+        {
+            tree.Build();
+            while (!tree.IsEmpty())
+            {
+                const SizeTypeAlias winner = tree.GetWinner();
+                NodeBaseAlias* node = heads[winner];
+                this->JoinTwoNodes(tail, node);
+                tail = node;
+                heads[winner] = node->PointerNext;
+                if (heads[winner] != &sources(winner)->LinkedListCore.NodeHead)
+                {
+                    tree.ReplaceTop(heads[winner]);
+                }
+                else
+                {
+                    heads[winner] = nullptr;
+                    tree.PopTop();
+                }
+            }
+        }
+        catch (...)
+        {
+            for (SizeTypeAlias i = 0; i < count; ++i)
+            {
+                NodeBaseAlias* end = &sources(i)->LinkedListCore.NodeHead;
+                for (NodeBaseAlias* node = heads[i]; node != nullptr && node != end; node = node->PointerNext)
+                {
+                    this->JoinTwoNodes(tail, node);
+                    tail = node;
+                }
+            }
+            this->JoinTwoNodes(tail, &this->LinkedListCore.NodeHead);
+            throw;
+        }
+        this->JoinTwoNodes(tail, &this->LinkedListCore.NodeHead);
     }
 
     void AssignInternal(SizeTypeAlias size, const T& value, std::true_type)
@@ -908,8 +1204,9 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
 
   public:
     // Zone of DSA
-    template <typename TCompare> void BubbleSort(TCompare compare)
+    template <typename TCompare> void BubbleSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
             return;
@@ -942,8 +1239,9 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         }
     }
 
-    template <typename TCompare> void SelectionSort(TCompare compare)
+    template <typename TCompare> void SelectionSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
             return;
@@ -980,8 +1278,9 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         }
     }
 
-    template <typename TCompare> void InsertionSort(TCompare compare)
+    template <typename TCompare> void InsertionSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
             return;
@@ -993,16 +1292,19 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         while (sorted->PointerNext != &this->LinkedListCore.NodeHead)
         {
             bool isInsert = false;
-            for (NodeBaseAlias* temp = &this->LinkedListCore.NodeHead; temp->PointerNext != sorted;
-                 temp = temp->PointerNext)
+            // sorted ends the sorted prefix, so a node not less than it is already in place
+            if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(), *static_cast<NodeAlias*>(sorted)->GetData()))
             {
-                if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(),
-                            *static_cast<NodeAlias*>(temp->PointerNext)->GetData()))
+                for (NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;; temp = temp->PointerNext)
                 {
-                    temp->TransferAfter(sorted, unsorted);
-                    unsorted = sorted->PointerNext;
-                    isInsert = true;
-                    break;
+                    if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(),
+                                *static_cast<NodeAlias*>(temp->PointerNext)->GetData()))
+                    {
+                        temp->TransferAfter(sorted, unsorted);
+                        unsorted = sorted->PointerNext;
+                        isInsert = true;
+                        break;
+                    }
                 }
             }
 
@@ -1033,6 +1335,7 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
     template <typename TCompare>
     IteratorAlias PartitionForQuickSortHelper(TCompare compare, IteratorAlias begin, IteratorAlias end)
     {
+        using std::swap;
         IteratorAlias pivot = begin;
         IteratorAlias i = begin;
         IteratorAlias j = begin.PointerNext();
@@ -1042,12 +1345,12 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
             if (compare(*j, *pivot))
             {
                 ++i;
-                std::swap(*i, *j);
+                swap(*i, *j);
             }
             ++j;
         }
 
-        std::swap(*i, *pivot);
+        swap(*i, *pivot);
 
         return i;
     }
@@ -1077,6 +1380,7 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
 
     void SwapForHeapSort(SizeTypeAlias root, SizeTypeAlias left)
     {
+        using std::swap;
         IteratorAlias rootIter = this->GetBegin();
         IteratorAlias leftIter = this->GetBegin();
 
@@ -1090,22 +1394,25 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
             ++leftIter;
         }
 
-        std::swap(*rootIter, *leftIter);
+        swap(*rootIter, *leftIter);
     }
 
     IteratorAlias FindForHeapSortHelper(SizeTypeAlias index)
     {
         IteratorAlias iter = this->GetBegin();
-        for (SizeTypeAlias i = 0; i < index && iter != this->GetEnd(); i++)
+        SizeTypeAlias i = 0;
+        for (; i < index && iter != this->GetEnd(); i++)
         {
             ++iter;
         }
+        Utilities::InstrumentationHooks<CList>::OnNodeWalks(i);
         return iter;
     }
 
   public:
-    template <typename TCompare> void QuickSort(TCompare compare)
+    template <typename TCompare> void QuickSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
             return;
@@ -1114,8 +1421,9 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         QuickSortHelper(compare, this->GetBegin(), this->GetEnd());
     }
 
-    template <typename TCompare> void HeapSort(TCompare compare)
+    template <typename TCompare> void HeapSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
             return;
@@ -1139,8 +1447,18 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         }
     }
 
-    template <typename TCompare> void DSASort(unsigned choice, TCompare compare)
+    /**
+     * @brief Sort with the strategy that suits the input; see Utilities::AdaptiveSortList. Not stable.
+     * @return The strategy used.
+     */
+    template <typename TCompare> Utilities::SortStrategy AdaptiveSort(TCompare userCompare)
     {
+        return Utilities::AdaptiveSortList(*this, userCompare, Utilities::InstrumentCompare<CList>(userCompare));
+    }
+
+    template <typename TCompare> void DSASort(unsigned choice, TCompare userCompare)
+    {
+        auto compare = Utilities::InstrumentCompare<CList>(userCompare);
         switch (choice)
         {
         case 1:
@@ -1158,6 +1476,9 @@ template <typename T, typename Alloc = Allocator<T>> class CList : private CList
         case 5:
             this->HeapSort(compare);
             break;
+        case 6:
+            this->AdaptiveSort(userCompare);
+            break;
         default:
             this->Sort(compare);
             break;
@@ -2,6 +2,7 @@
 #ifndef DSA_LIBRARIES_CLIST_NODE_HPP
 #define DSA_LIBRARIES_CLIST_NODE_HPP
 #include "../../Utilities/AlignedBuffer.hpp"
+#include <cstdint>
 #include <utility>
 namespace DSALibraries::Containers
 {
@@ -82,6 +83,8 @@ template <typename T> struct CListNode : public CListNodeBase
 {
     CListNode() = default;
 
+    /** 1-based position in the NodeSlabs slab the node was allocated from; 0 when it was allocated on its own. */
+    std::uint32_t SlabIndex = 0;
     Utilities::AlignedBuffer<T> data;
 
     T *GetData() noexcept
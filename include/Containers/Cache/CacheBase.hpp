@@ -0,0 +1,318 @@
+#ifndef DSA_LIBRARIES_CACHE_BASE_HPP
+#define DSA_LIBRARIES_CACHE_BASE_HPP
+#include "../../Utilities/AlignedBuffer.hpp"
+#include "../Vector/Vector.hpp"
+#include "CacheExceptions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Slot of a cache pool. Key and value are constructed in place only while the slot is in use; Prev and Next
+ * are slot indices, so the recency list costs eight bytes per entry and no allocation.
+ */
+template <typename K, typename V> struct CacheEntry
+{
+    using IndexTypeAlias = std::uint32_t;
+
+    Utilities::AlignedBuffer<K> key;
+    Utilities::AlignedBuffer<V> data;
+    IndexTypeAlias Prev;
+    IndexTypeAlias Next;
+    bool Visited;
+
+    K *GetKey() noexcept
+    {
+        return key.Pointer();
+    }
+
+    const K *GetKey() const noexcept
+    {
+        return key.Pointer();
+    }
+
+    V *GetData() noexcept
+    {
+        return data.Pointer();
+    }
+
+    const V *GetData() const noexcept
+    {
+        return data.Pointer();
+    }
+};
+
+/**
+ * @brief Storage shared by the fixed-capacity caches.
+ *
+ * All entries live in one Vector allocated up front, linked into a doubly linked list by index. Keys are found
+ * through an open-addressing table of slot indices (linear probing, at most half full, backward-shift deletion), so a
+ * cache does no allocation at all after construction.
+ */
+template <typename K, typename V, typename THash, typename TEqual> class CacheBase
+{
+  public:
+    using KeyTypeAlias = K;
+    using ValueTypeAlias = V;
+    using SizeTypeAlias = std::size_t;
+    using HasherAlias = THash;
+    using KeyEqualAlias = TEqual;
+    using EntryAlias = CacheEntry<K, V>;
+    using IndexTypeAlias = typename EntryAlias::IndexTypeAlias;
+    using EvictionCallbackAlias = std::function<void(const K &, V &)>;
+
+    // Adaptive alias
+    using key_type = KeyTypeAlias;
+    using mapped_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+    using hasher = HasherAlias;
+    using key_equal = KeyEqualAlias;
+
+    static constexpr IndexTypeAlias NullIndex = std::numeric_limits<IndexTypeAlias>::max();
+
+  protected:
+    Vector<EntryAlias> _entries;
+    Vector<IndexTypeAlias> _table;
+    IndexTypeAlias _head = NullIndex;
+    IndexTypeAlias _tail = NullIndex;
+    IndexTypeAlias _free = NullIndex;
+    SizeTypeAlias _size = 0;
+    unsigned _tableShift = 0;
+    HasherAlias _hash;
+    KeyEqualAlias _equal;
+    EvictionCallbackAlias _onEvict;
+
+  public:
+    CacheBase(const CacheBase &) = delete;
+    CacheBase &operator=(const CacheBase &) = delete;
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCapacity() const noexcept
+    {
+        return _entries.GetSize();
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] bool IsFull() const noexcept
+    {
+        return _size == _entries.GetSize();
+    }
+
+    [[nodiscard]] bool Contains(const K &key) const
+    {
+        return this->FindSlotInternal(key) != NullIndex;
+    }
+
+    /**
+     * @brief Called with the key and value of every entry evicted to make room; not called by Erase or Clear.
+     */
+    void SetEvictionCallback(EvictionCallbackAlias callback)
+    {
+        _onEvict = std::move(callback);
+    }
+
+  protected:
+    CacheBase(SizeTypeAlias capacity, const THash &hash, const TEqual &equal)
+        : _entries(capacity), _hash(hash), _equal(equal)
+    {
+        if (capacity == 0 || capacity >= static_cast<SizeTypeAlias>(NullIndex) / 2)
+        {
+            throw CacheInvalidCapacityException(__FILE__, __LINE__);
+        }
+
+        SizeTypeAlias tableSize = 2;
+        unsigned tableBits = 1;
+        while (tableSize < capacity * 2)
+        {
+            tableSize *= 2;
+            ++tableBits;
+        }
+        _tableShift = 64 - tableBits;
+        _table = Vector<IndexTypeAlias>(tableSize, NullIndex);
+
+        for (SizeTypeAlias slot = 0; slot < capacity; ++slot)
+        {
+            _entries[slot].Next = slot + 1 < capacity ? static_cast<IndexTypeAlias>(slot + 1) : NullIndex;
+        }
+        _free = 0;
+    }
+
+    ~CacheBase()
+    {
+        this->DestroyAllInternal();
+    }
+
+    IndexTypeAlias FindSlotInternal(const K &key) const
+    {
+        const SizeTypeAlias mask = _table.GetSize() - 1;
+        for (SizeTypeAlias position = this->HomeInternal(key);; position = (position + 1) & mask)
+        {
+            const IndexTypeAlias slot = _table[position];
+            if (slot == NullIndex || _equal(*_entries[slot].GetKey(), key))
+            {
+                return slot;
+            }
+        }
+    }
+
+    /**
+     * @brief Take a free slot, construct the entry in it and index it. The caller must have made room and linked the
+     * slot into its list.
+     */
+    IndexTypeAlias ConstructSlotInternal(K &&key, V &&value)
+    {
+        const IndexTypeAlias slot = _free;
+        EntryAlias &entry = _entries[slot];
+        ::new (entry.key.Address()) K(std::move(key));
+        try
+        {
+            ::new (entry.data.Address()) V(std::move(value));
+        }
+        catch (...)
+        {
+            entry.GetKey()->~K();
+            throw;
+        }
+        _free = entry.Next;
+        entry.Prev = NullIndex;
+        entry.Next = NullIndex;
+        entry.Visited = false;
+
+        const SizeTypeAlias mask = _table.GetSize() - 1;
+        SizeTypeAlias position = this->HomeInternal(*entry.GetKey());
+        while (_table[position] != NullIndex)
+        {
+            position = (position + 1) & mask;
+        }
+        _table[position] = slot;
+        ++_size;
+        return slot;
+    }
+
+    /**
+     * @brief Unindex, unlink and destroy the entry of slot and return the slot to the free list.
+     */
+    void ReleaseSlotInternal(IndexTypeAlias slot, bool isEviction)
+    {
+        EntryAlias &entry = _entries[slot];
+        if (isEviction && _onEvict)
+        {
+            _onEvict(*entry.GetKey(), *entry.GetData());
+        }
+
+        this->EraseIndexInternal(slot);
+        this->UnlinkInternal(slot);
+        entry.GetKey()->~K();
+        entry.GetData()->~V();
+        entry.Next = _free;
+        _free = slot;
+        --_size;
+    }
+
+    void LinkFrontInternal(IndexTypeAlias slot) noexcept
+    {
+        EntryAlias &entry = _entries[slot];
+        entry.Prev = NullIndex;
+        entry.Next = _head;
+        if (_head != NullIndex)
+        {
+            _entries[_head].Prev = slot;
+        }
+        else
+        {
+            _tail = slot;
+        }
+        _head = slot;
+    }
+
+    void UnlinkInternal(IndexTypeAlias slot) noexcept
+    {
+        EntryAlias &entry = _entries[slot];
+        if (entry.Prev != NullIndex)
+        {
+            _entries[entry.Prev].Next = entry.Next;
+        }
+        else
+        {
+            _head = entry.Next;
+        }
+        if (entry.Next != NullIndex)
+        {
+            _entries[entry.Next].Prev = entry.Prev;
+        }
+        else
+        {
+            _tail = entry.Prev;
+        }
+    }
+
+    void ClearInternal() noexcept
+    {
+        this->DestroyAllInternal();
+        for (SizeTypeAlias position = 0; position < _table.GetSize(); ++position)
+        {
+            _table[position] = NullIndex;
+        }
+        const SizeTypeAlias capacity = _entries.GetSize();
+        for (SizeTypeAlias slot = 0; slot < capacity; ++slot)
+        {
+            _entries[slot].Next = slot + 1 < capacity ? static_cast<IndexTypeAlias>(slot + 1) : NullIndex;
+        }
+        _head = NullIndex;
+        _tail = NullIndex;
+        _free = 0;
+        _size = 0;
+    }
+
+  private:
+    SizeTypeAlias HomeInternal(const K &key) const
+    {
+        // Fibonacci hashing spreads weak hashes such as the identity std::hash of integers over the whole table.
+        return static_cast<SizeTypeAlias>((static_cast<std::uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ULL) >>
+                                          _tableShift);
+    }
+
+    void EraseIndexInternal(IndexTypeAlias slot)
+    {
+        const SizeTypeAlias mask = _table.GetSize() - 1;
+        SizeTypeAlias position = this->HomeInternal(*_entries[slot].GetKey());
+        while (_table[position] != slot)
+        {
+            position = (position + 1) & mask;
+        }
+
+        for (SizeTypeAlias next = (position + 1) & mask; _table[next] != NullIndex; next = (next + 1) & mask)
+        {
+            const SizeTypeAlias home = this->HomeInternal(*_entries[_table[next]].GetKey());
+            if (((next - home) & mask) >= ((next - position) & mask))
+            {
+                _table[position] = _table[next];
+                position = next;
+            }
+        }
+        _table[position] = NullIndex;
+    }
+
+    void DestroyAllInternal() noexcept
+    {
+        for (IndexTypeAlias slot = _head; slot != NullIndex; slot = _entries[slot].Next)
+        {
+            _entries[slot].GetKey()->~K();
+            _entries[slot].GetData()->~V();
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_CACHE_BASE_HPP
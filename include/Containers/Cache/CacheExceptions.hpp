@@ -0,0 +1,23 @@
+#ifndef DSA_LIBRARIES_CACHE_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_CACHE_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class CacheException : public Utilities::Exception
+{
+  public:
+    CacheException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class CacheInvalidCapacityException : public CacheException
+{
+  public:
+    CacheInvalidCapacityException(string_type fileText, numeric_type line)
+        : CacheException("Cache capacity must be positive and fit the slot index type", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,108 @@
+#ifndef DSA_LIBRARIES_LRU_CACHE_HPP
+#define DSA_LIBRARIES_LRU_CACHE_HPP
+#include "CacheBase.hpp"
+#include <functional>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Fixed-capacity cache that evicts the least recently used entry.
+ *
+ * Entries sit in a pooled array ordered by recency through index links: Find and Put move the entry to the front and
+ * eviction takes the back, all in O(1) and without allocating.
+ */
+template <typename K, typename V, typename THash = std::hash<K>, typename TEqual = std::equal_to<K>>
+class LruCache : public CacheBase<K, V, THash, TEqual>
+{
+  private:
+    using Base = CacheBase<K, V, THash, TEqual>;
+
+  public:
+    using typename Base::IndexTypeAlias;
+    using typename Base::SizeTypeAlias;
+    using Base::NullIndex;
+
+    explicit LruCache(SizeTypeAlias capacity, const THash &hash = THash(), const TEqual &equal = TEqual())
+        : Base(capacity, hash, equal)
+    {
+    }
+
+    /**
+     * @brief Value of key, or nullptr if absent. A hit makes the entry the most recently used.
+     */
+    V *Find(const K &key)
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        if (slot == NullIndex)
+        {
+            return nullptr;
+        }
+        if (slot != this->_head)
+        {
+            this->UnlinkInternal(slot);
+            this->LinkFrontInternal(slot);
+        }
+        return this->_entries[slot].GetData();
+    }
+
+    /**
+     * @brief Value of key without touching its recency, or nullptr if absent.
+     */
+    const V *Peek(const K &key) const
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        return slot == NullIndex ? nullptr : this->_entries[slot].GetData();
+    }
+
+    /**
+     * @brief Insert or overwrite key, evicting the least recently used entry when full.
+     * @return true if key was not present.
+     */
+    bool Put(K key, V value)
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        if (slot != NullIndex)
+        {
+            *this->_entries[slot].GetData() = std::move(value);
+            if (slot != this->_head)
+            {
+                this->UnlinkInternal(slot);
+                this->LinkFrontInternal(slot);
+            }
+            return false;
+        }
+
+        if (this->IsFull())
+        {
+            this->ReleaseSlotInternal(this->_tail, true);
+        }
+        this->LinkFrontInternal(this->ConstructSlotInternal(std::move(key), std::move(value)));
+        return true;
+    }
+
+    bool Erase(const K &key)
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        if (slot == NullIndex)
+        {
+            return false;
+        }
+        this->ReleaseSlotInternal(slot, false);
+        return true;
+    }
+
+    /**
+     * @brief Key that the next insertion into a full cache would evict.
+     */
+    [[nodiscard]] const K *GetLeastRecent() const noexcept
+    {
+        return this->_tail == NullIndex ? nullptr : this->_entries[this->_tail].GetKey();
+    }
+
+    void Clear() noexcept
+    {
+        this->ClearInternal();
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_LRU_CACHE_HPP
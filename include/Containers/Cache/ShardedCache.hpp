@@ -0,0 +1,184 @@
+#ifndef DSA_LIBRARIES_SHARDED_CACHE_HPP
+#define DSA_LIBRARIES_SHARDED_CACHE_HPP
+#include "../Vector/Vector.hpp"
+#include "CacheExceptions.hpp"
+#include "LruCache.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Thread-safe cache made of independent shards, each a TCache behind its own mutex.
+ *
+ * A key always maps to the same shard, so threads that touch different shards never contend. Eviction is per shard:
+ * each holds capacity / shardCount entries and evicts by its own policy.
+ *
+ * @tparam TCache LruCache or SieveCache.
+ */
+template <typename TCache> class ShardedCache
+{
+  public:
+    using CacheAlias = TCache;
+    using KeyTypeAlias = typename TCache::KeyTypeAlias;
+    using ValueTypeAlias = typename TCache::ValueTypeAlias;
+    using SizeTypeAlias = std::size_t;
+    using HasherAlias = typename TCache::HasherAlias;
+    using KeyEqualAlias = typename TCache::KeyEqualAlias;
+    using EvictionCallbackAlias = typename TCache::EvictionCallbackAlias;
+
+    // Adaptive alias
+    using key_type = KeyTypeAlias;
+    using mapped_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+
+  private:
+    struct alignas(64) Shard
+    {
+        std::mutex Mutex;
+        CacheAlias Cache;
+
+        Shard(SizeTypeAlias capacity, const HasherAlias &hash, const KeyEqualAlias &equal)
+            : Cache(capacity, hash, equal)
+        {
+        }
+    };
+
+    Vector<std::unique_ptr<Shard>> _shards;
+    HasherAlias _hash;
+    unsigned _shardShift = 64;
+
+  public:
+    /**
+     * @param capacity Total capacity, split evenly over the shards.
+     * @param shardCount Number of shards, rounded up to a power of two.
+     */
+    ShardedCache(SizeTypeAlias capacity, SizeTypeAlias shardCount, const HasherAlias &hash = HasherAlias(),
+                 const KeyEqualAlias &equal = KeyEqualAlias())
+        : _hash(hash)
+    {
+        SizeTypeAlias shards = 1;
+        while (shards < shardCount)
+        {
+            shards *= 2;
+            --_shardShift;
+        }
+        if (capacity < shards)
+        {
+            throw CacheInvalidCapacityException(__FILE__, __LINE__);
+        }
+
+        _shards.Reverse(shards);
+        for (SizeTypeAlias i = 0; i < shards; ++i)
+        {
+            _shards.EmplaceBack(std::make_unique<Shard>((capacity + shards - 1 - i) / shards, hash, equal));
+        }
+    }
+
+    ShardedCache(const ShardedCache &) = delete;
+    ShardedCache &operator=(const ShardedCache &) = delete;
+
+    [[nodiscard]] SizeTypeAlias GetShardCount() const noexcept
+    {
+        return _shards.GetSize();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const
+    {
+        SizeTypeAlias size = 0;
+        for (SizeTypeAlias i = 0; i < _shards.GetSize(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(_shards[i]->Mutex);
+            size += _shards[i]->Cache.GetSize();
+        }
+        return size;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCapacity() const noexcept
+    {
+        SizeTypeAlias capacity = 0;
+        for (SizeTypeAlias i = 0; i < _shards.GetSize(); ++i)
+        {
+            capacity += _shards[i]->Cache.GetCapacity();
+        }
+        return capacity;
+    }
+
+    /**
+     * @brief Copy the value of key into value.
+     * @return false if key is absent.
+     */
+    bool Find(const KeyTypeAlias &key, ValueTypeAlias &value)
+    {
+        Shard &shard = this->GetShardInternal(key);
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        if (ValueTypeAlias *found = shard.Cache.Find(key))
+        {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    bool Contains(const KeyTypeAlias &key)
+    {
+        Shard &shard = this->GetShardInternal(key);
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        return shard.Cache.Contains(key);
+    }
+
+    bool Put(KeyTypeAlias key, ValueTypeAlias value)
+    {
+        Shard &shard = this->GetShardInternal(key);
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        return shard.Cache.Put(std::move(key), std::move(value));
+    }
+
+    bool Erase(const KeyTypeAlias &key)
+    {
+        Shard &shard = this->GetShardInternal(key);
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        return shard.Cache.Erase(key);
+    }
+
+    void Clear()
+    {
+        for (SizeTypeAlias i = 0; i < _shards.GetSize(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(_shards[i]->Mutex);
+            _shards[i]->Cache.Clear();
+        }
+    }
+
+    /**
+     * @brief Install callback on every shard. It runs while the evicting shard is locked and must not call back into
+     * the cache.
+     */
+    void SetEvictionCallback(const EvictionCallbackAlias &callback)
+    {
+        for (SizeTypeAlias i = 0; i < _shards.GetSize(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(_shards[i]->Mutex);
+            _shards[i]->Cache.SetEvictionCallback(callback);
+        }
+    }
+
+  private:
+    Shard &GetShardInternal(const KeyTypeAlias &key) const
+    {
+        if (_shardShift == 64)
+        {
+            return *_shards[0];
+        }
+        // A different multiplier than the shard tables use, so the keys of one shard still spread over its table.
+        const auto mixed = static_cast<std::uint64_t>(_hash(key)) * 0xFF51AFD7ED558CCDULL;
+        return *_shards[static_cast<SizeTypeAlias>(mixed >> _shardShift)];
+    }
+};
+
+template <typename K, typename V, typename THash = std::hash<K>, typename TEqual = std::equal_to<K>>
+using ShardedLruCache = ShardedCache<LruCache<K, V, THash, TEqual>>;
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_SHARDED_CACHE_HPP
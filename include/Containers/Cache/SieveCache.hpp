@@ -0,0 +1,115 @@
+#ifndef DSA_LIBRARIES_SIEVE_CACHE_HPP
+#define DSA_LIBRARIES_SIEVE_CACHE_HPP
+#include "CacheBase.hpp"
+#include <functional>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Fixed-capacity cache with SIEVE eviction, a CLOCK variant.
+ *
+ * New entries go to the front of a FIFO list and a hit only sets the entry's visited bit, so reads never relink the
+ * list. To evict, a hand walks from the back toward the front, clearing visited bits, and removes the first entry it
+ * finds unvisited; the hand then stays where it stopped, which lets new entries that were never reused leave early.
+ */
+template <typename K, typename V, typename THash = std::hash<K>, typename TEqual = std::equal_to<K>>
+class SieveCache : public CacheBase<K, V, THash, TEqual>
+{
+  private:
+    using Base = CacheBase<K, V, THash, TEqual>;
+
+  public:
+    using typename Base::IndexTypeAlias;
+    using typename Base::SizeTypeAlias;
+    using Base::NullIndex;
+
+  private:
+    IndexTypeAlias _hand = NullIndex;
+
+  public:
+    explicit SieveCache(SizeTypeAlias capacity, const THash &hash = THash(), const TEqual &equal = TEqual())
+        : Base(capacity, hash, equal)
+    {
+    }
+
+    /**
+     * @brief Value of key, or nullptr if absent. A hit marks the entry visited.
+     */
+    V *Find(const K &key)
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        if (slot == NullIndex)
+        {
+            return nullptr;
+        }
+        this->_entries[slot].Visited = true;
+        return this->_entries[slot].GetData();
+    }
+
+    /**
+     * @brief Value of key without marking it visited, or nullptr if absent.
+     */
+    const V *Peek(const K &key) const
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        return slot == NullIndex ? nullptr : this->_entries[slot].GetData();
+    }
+
+    /**
+     * @brief Insert or overwrite key, evicting with the SIEVE hand when full.
+     * @return true if key was not present.
+     */
+    bool Put(K key, V value)
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        if (slot != NullIndex)
+        {
+            *this->_entries[slot].GetData() = std::move(value);
+            this->_entries[slot].Visited = true;
+            return false;
+        }
+
+        if (this->IsFull())
+        {
+            this->EvictInternal();
+        }
+        this->LinkFrontInternal(this->ConstructSlotInternal(std::move(key), std::move(value)));
+        return true;
+    }
+
+    bool Erase(const K &key)
+    {
+        const IndexTypeAlias slot = this->FindSlotInternal(key);
+        if (slot == NullIndex)
+        {
+            return false;
+        }
+        if (slot == _hand)
+        {
+            _hand = this->_entries[slot].Prev;
+        }
+        this->ReleaseSlotInternal(slot, false);
+        return true;
+    }
+
+    void Clear() noexcept
+    {
+        this->ClearInternal();
+        _hand = NullIndex;
+    }
+
+  private:
+    void EvictInternal()
+    {
+        IndexTypeAlias slot = _hand != NullIndex ? _hand : this->_tail;
+        while (this->_entries[slot].Visited)
+        {
+            this->_entries[slot].Visited = false;
+            slot = this->_entries[slot].Prev != NullIndex ? this->_entries[slot].Prev : this->_tail;
+        }
+        _hand = this->_entries[slot].Prev;
+        this->ReleaseSlotInternal(slot, true);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_SIEVE_CACHE_HPP
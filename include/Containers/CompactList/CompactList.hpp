@@ -0,0 +1,607 @@
+#ifndef DSA_LIBRARIES_COMPACT_LIST_HPP
+#define DSA_LIBRARIES_COMPACT_LIST_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../Vector/Vector.hpp"
+#include "CompactListExceptions.hpp"
+#include "CompactListIterator.hpp"
+#include "CompactListNode.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Doubly linked list whose nodes live in one contiguous Vector and link to each other by Index, with erased
+ * nodes kept on a free list for the next insert.
+ *
+ * With the default 32-bit Index a node of a small T is half the size of a DList node, and the node array is one
+ * allocation that can be copied or written out as raw bytes. Insert and erase are O(1) amortized. Iterators are
+ * indices, so they survive growth of the array; Compact() renumbers the nodes into traversal order and invalidates
+ * them. Slot 0 is the sentinel and is only allocated with the first element.
+ */
+template <typename T, typename Index = std::uint32_t, typename Alloc = Utilities::Allocator<T>> class CompactList
+{
+    static_assert(std::is_trivially_copyable_v<T>, "CompactList relocates elements as raw bytes when the array grows");
+    static_assert(std::is_unsigned_v<Index>, "CompactList links by an unsigned index");
+
+  public:
+    using NodeAlias = CompactListNode<T, Index>;
+    using NodeAllocatorTypeAlias = typename std::allocator_traits<Alloc>::template rebind_alloc<NodeAlias>;
+    using NodeVectorAlias = Vector<NodeAlias, NodeAllocatorTypeAlias>;
+    using ValueTypeAlias = T;
+    using PointerAlias = T *;
+    using ConstPointerAlias = const T *;
+    using ReferenceTypeAlias = T &;
+    using ConstReferenceTypeAlias = const T &;
+    using IteratorAlias = CompactListIterator<T, Index, NodeVectorAlias>;
+    using ConstIteratorAlias = CompactListConstIterator<T, Index, NodeVectorAlias>;
+    using SizeTypeAlias = std::size_t;
+    using DifferenceTypeAlias = std::ptrdiff_t;
+    using AllocatorTypeAlias = Alloc;
+    using IndexTypeAlias = Index;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using pointer = PointerAlias;
+    using const_pointer = ConstPointerAlias;
+    using reference = ReferenceTypeAlias;
+    using const_reference = ConstReferenceTypeAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+    using size_type = SizeTypeAlias;
+    using difference_type = DifferenceTypeAlias;
+    using allocator_type = AllocatorTypeAlias;
+
+    static constexpr Index HeadIndex = 0;
+    static constexpr Index NullIndex = (std::numeric_limits<Index>::max)();
+
+  private:
+    NodeAllocatorTypeAlias _nodeAllocator;
+    NodeVectorAlias _nodes;
+    Index _free = NullIndex;
+    SizeTypeAlias _size = 0;
+
+    Index AllocateNodeInternal()
+    {
+        if (_nodes.IsEmpty())
+        {
+            _nodes.EmplaceBack();
+            _nodes[HeadIndex].Next = _nodes[HeadIndex].Prev = HeadIndex;
+        }
+        if (_free != NullIndex)
+        {
+            const Index index = _free;
+            _free = _nodes[index].Next;
+            return index;
+        }
+        if (_nodes.GetSize() >= static_cast<SizeTypeAlias>(NullIndex))
+        {
+            throw CompactListFullException(__FILE__, __LINE__);
+        }
+        _nodes.EmplaceBack();
+        return static_cast<Index>(_nodes.GetSize() - 1);
+    }
+
+    void LinkBeforeInternal(Index index, Index position) noexcept
+    {
+        const Index prev = _nodes[position].Prev;
+        _nodes[index].Next = position;
+        _nodes[index].Prev = prev;
+        _nodes[prev].Next = index;
+        _nodes[position].Prev = index;
+    }
+
+    template <typename... Args> IteratorAlias EmplaceBeforeInternal(Index position, Args &&...args)
+    {
+        // Built before the node array can grow, so arguments referring into this list stay valid.
+        ValueTypeAlias value(std::forward<Args>(args)...);
+        const Index index = AllocateNodeInternal();
+        ::new (static_cast<void *>(_nodes[index].Storage)) ValueTypeAlias(value);
+        LinkBeforeInternal(index, position);
+        ++_size;
+        return IteratorAlias(&_nodes, index);
+    }
+
+    Index EraseInternal(Index index) noexcept
+    {
+        const Index next = _nodes[index].Next;
+        const Index prev = _nodes[index].Prev;
+        _nodes[prev].Next = next;
+        _nodes[next].Prev = prev;
+        _nodes[index].Next = _free;
+        _free = index;
+        --_size;
+        return next;
+    }
+
+    Index NextInternal(Index position) const noexcept
+    {
+        return _nodes.IsEmpty() ? HeadIndex : _nodes[position].Next;
+    }
+
+  public:
+    CompactList() noexcept = default;
+
+    explicit CompactList(const AllocatorTypeAlias &allocator) : _nodeAllocator(allocator), _nodes(_nodeAllocator)
+    {
+    }
+
+    explicit CompactList(SizeTypeAlias size, const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : CompactList(size, ValueTypeAlias(), allocator)
+    {
+    }
+
+    CompactList(SizeTypeAlias size, const ValueTypeAlias &value,
+                const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : _nodeAllocator(allocator), _nodes(_nodeAllocator)
+    {
+        Assign(size, value);
+    }
+
+    CompactList(std::initializer_list<ValueTypeAlias> init, const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : _nodeAllocator(allocator), _nodes(_nodeAllocator)
+    {
+        Assign(init.begin(), init.end());
+    }
+
+    template <std::input_iterator InputIterator>
+    CompactList(InputIterator begin, InputIterator end, const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : _nodeAllocator(allocator), _nodes(_nodeAllocator)
+    {
+        Assign(begin, end);
+    }
+
+    CompactList(const CompactList &list) = default;
+
+    CompactList(CompactList &&list) noexcept
+        : _nodeAllocator(list._nodeAllocator), _nodes(std::move(list._nodes)),
+          _free(std::exchange(list._free, NullIndex)), _size(std::exchange(list._size, 0))
+    {
+    }
+
+    CompactList &operator=(const CompactList &list) = default;
+
+    CompactList &operator=(CompactList &&list) noexcept
+    {
+        if (this != &list)
+        {
+            _nodeAllocator = list._nodeAllocator;
+            _nodes = std::move(list._nodes);
+            list._nodes.Clear();
+            _free = std::exchange(list._free, NullIndex);
+            _size = std::exchange(list._size, 0);
+        }
+        return *this;
+    }
+
+    AllocatorTypeAlias GetAllocator() const noexcept
+    {
+        return AllocatorTypeAlias(_nodeAllocator);
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() noexcept
+    {
+        return GetBegin();
+    }
+
+    ConstIteratorAlias begin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cbegin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    IteratorAlias end() noexcept
+    {
+        return GetEnd();
+    }
+
+    ConstIteratorAlias end() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cend() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] IteratorAlias before_begin() noexcept
+    {
+        return GetBeginFromHead();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias before_begin() const noexcept
+    {
+        return GetConstBeginFromHead();
+    }
+    // End Zone Adaptive Iterator
+
+    ConstIteratorAlias GetConstBeginFromHead() const noexcept
+    {
+        return ConstIteratorAlias(&_nodes, HeadIndex);
+    }
+
+    IteratorAlias GetBeginFromHead() noexcept
+    {
+        return IteratorAlias(&_nodes, HeadIndex);
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return ConstIteratorAlias(&_nodes, NextInternal(HeadIndex));
+    }
+
+    IteratorAlias GetBegin() noexcept
+    {
+        return IteratorAlias(&_nodes, NextInternal(HeadIndex));
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return ConstIteratorAlias(&_nodes, HeadIndex);
+    }
+
+    IteratorAlias GetEnd() noexcept
+    {
+        return IteratorAlias(&_nodes, HeadIndex);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** Nodes the array can hold, free ones included, before it has to grow. */
+    [[nodiscard]] SizeTypeAlias GetCapacity() const noexcept
+    {
+        return _nodes.GetCapacity() > 0 ? _nodes.GetCapacity() - 1 : 0;
+    }
+
+    /** The node array, sentinel at HeadIndex and free nodes included; after Compact() node i holds element i - 1. */
+    [[nodiscard]] const NodeVectorAlias &GetNodes() const noexcept
+    {
+        return _nodes;
+    }
+
+    void Reserve(SizeTypeAlias size)
+    {
+        _nodes.Reverse(size + 1);
+    }
+
+    void Resize(SizeTypeAlias newSize)
+    {
+        Resize(newSize, ValueTypeAlias());
+    }
+
+    void Resize(SizeTypeAlias newSize, const ValueTypeAlias &value)
+    {
+        while (_size > newSize)
+        {
+            PopBack();
+        }
+        while (_size < newSize)
+        {
+            PushBack(value);
+        }
+    }
+
+    ReferenceTypeAlias GetItemFront()
+    {
+        if (IsEmpty())
+        {
+            throw CompactListEmptyException(__FILE__, __LINE__);
+        }
+        return *GetBegin();
+    }
+
+    ConstReferenceTypeAlias GetConstItemFront() const
+    {
+        if (IsEmpty())
+        {
+            throw CompactListEmptyException(__FILE__, __LINE__);
+        }
+        return *GetConstBegin();
+    }
+
+    ReferenceTypeAlias GetItemBack()
+    {
+        if (IsEmpty())
+        {
+            throw CompactListEmptyException(__FILE__, __LINE__);
+        }
+        return *_nodes[_nodes[HeadIndex].Prev].GetData();
+    }
+
+    ConstReferenceTypeAlias GetConstItemBack() const
+    {
+        if (IsEmpty())
+        {
+            throw CompactListEmptyException(__FILE__, __LINE__);
+        }
+        return *_nodes[_nodes[HeadIndex].Prev].GetData();
+    }
+
+    void PushFront(const ValueTypeAlias &value)
+    {
+        EmplaceBeforeInternal(NextInternal(HeadIndex), value);
+    }
+
+    template <typename... Args> void EmplaceFront(Args &&...args)
+    {
+        EmplaceBeforeInternal(NextInternal(HeadIndex), std::forward<Args>(args)...);
+    }
+
+    void PushBack(const ValueTypeAlias &value)
+    {
+        EmplaceBeforeInternal(HeadIndex, value);
+    }
+
+    template <typename... Args> void EmplaceBack(Args &&...args)
+    {
+        EmplaceBeforeInternal(HeadIndex, std::forward<Args>(args)...);
+    }
+
+    void PopFront()
+    {
+        if (IsEmpty())
+        {
+            throw CompactListEmptyException(__FILE__, __LINE__);
+        }
+        EraseInternal(_nodes[HeadIndex].Next);
+    }
+
+    void PopBack()
+    {
+        if (IsEmpty())
+        {
+            throw CompactListEmptyException(__FILE__, __LINE__);
+        }
+        EraseInternal(_nodes[HeadIndex].Prev);
+    }
+
+    template <typename... Args> IteratorAlias EmplaceBefore(ConstIteratorAlias position, Args &&...args)
+    {
+        return EmplaceBeforeInternal(position.Position, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> IteratorAlias EmplaceAfter(ConstIteratorAlias position, Args &&...args)
+    {
+        return EmplaceBeforeInternal(NextInternal(position.Position), std::forward<Args>(args)...);
+    }
+
+    IteratorAlias InsertBefore(ConstIteratorAlias position, const ValueTypeAlias &value)
+    {
+        return EmplaceBefore(position, value);
+    }
+
+    IteratorAlias InsertAfter(ConstIteratorAlias position, const ValueTypeAlias &value)
+    {
+        return EmplaceAfter(position, value);
+    }
+
+    /** Insert size copies of value after position and return an iterator to the last one inserted. */
+    IteratorAlias InsertAfter(ConstIteratorAlias position, SizeTypeAlias size, const ValueTypeAlias &value)
+    {
+        IteratorAlias last = position.ConstCast();
+        for (; size > 0; --size)
+        {
+            last = EmplaceAfter(last, value);
+        }
+        return last;
+    }
+
+    template <std::input_iterator InputIterator>
+    IteratorAlias InsertAfter(ConstIteratorAlias position, InputIterator begin, InputIterator end)
+    {
+        IteratorAlias last = position.ConstCast();
+        for (; begin != end; ++begin)
+        {
+            last = EmplaceAfter(last, *begin);
+        }
+        return last;
+    }
+
+    void Assign(SizeTypeAlias size, const ValueTypeAlias &value)
+    {
+        Clear();
+        InsertAfter(GetConstBeginFromHead(), size, value);
+    }
+
+    template <std::input_iterator InputIterator> void Assign(InputIterator begin, InputIterator end)
+    {
+        Clear();
+        InsertAfter(GetConstBeginFromHead(), begin, end);
+    }
+
+    /** Erase the element at position and return an iterator to the one after it. */
+    IteratorAlias Erase(ConstIteratorAlias position) noexcept
+    {
+        return IteratorAlias(&_nodes, EraseInternal(position.Position));
+    }
+
+    IteratorAlias EraseAfter(ConstIteratorAlias position) noexcept
+    {
+        return IteratorAlias(&_nodes, EraseInternal(_nodes[position.Position].Next));
+    }
+
+    /** Erase the elements strictly between begin and end, as DList::EraseAfter does. */
+    IteratorAlias EraseAfter(ConstIteratorAlias begin, ConstIteratorAlias end) noexcept
+    {
+        Index current = _nodes.IsEmpty() ? end.Position : _nodes[begin.Position].Next;
+        while (current != end.Position)
+        {
+            current = EraseInternal(current);
+        }
+        return end.ConstCast();
+    }
+
+    /**
+     * Move the elements of list after position. The node arrays are separate, so this copies list's elements into
+     * this array in O(list.GetSize()) and leaves list empty.
+     */
+    void SpliceAfter(ConstIteratorAlias position, CompactList &&list)
+    {
+        SpliceAfter(position, list);
+    }
+
+    void SpliceAfter(ConstIteratorAlias position, CompactList &list)
+    {
+        if (&list == this || list.IsEmpty())
+        {
+            return;
+        }
+        InsertAfter(position, list.GetConstBegin(), list.GetConstEnd());
+        list.Clear();
+    }
+
+    void Remove(const ValueTypeAlias &value)
+    {
+        RemoveIf([&value](const ValueTypeAlias &item) { return item == value; });
+    }
+
+    template <typename TPredicate> void RemoveIf(TPredicate predicate)
+    {
+        for (Index current = NextInternal(HeadIndex); current != HeadIndex;)
+        {
+            current = predicate(*_nodes[current].GetData()) ? EraseInternal(current) : _nodes[current].Next;
+        }
+    }
+
+    void Merge(CompactList &&list)
+    {
+        Merge(list, std::less<ValueTypeAlias>());
+    }
+
+    void Merge(CompactList &list)
+    {
+        Merge(list, std::less<ValueTypeAlias>());
+    }
+
+    template <typename TCompare> void Merge(CompactList &&list, TCompare compare)
+    {
+        Merge(list, compare);
+    }
+
+    /** Merge the sorted list into this sorted list; equal elements of this list stay first. list is left empty. */
+    template <typename TCompare> void Merge(CompactList &list, TCompare compare)
+    {
+        if (&list == this)
+        {
+            return;
+        }
+        Index current = NextInternal(HeadIndex);
+        for (auto it = list.GetConstBegin(); it != list.GetConstEnd(); ++it)
+        {
+            while (current != HeadIndex && !compare(*it, *_nodes[current].GetData()))
+            {
+                current = _nodes[current].Next;
+            }
+            EmplaceBeforeInternal(current, *it);
+        }
+        list.Clear();
+    }
+
+    void Sort()
+    {
+        Sort(std::less<ValueTypeAlias>());
+    }
+
+    /** Stable sort: the values are gathered into a Vector, merge sorted there and written back in list order. */
+    template <typename TCompare> void Sort(TCompare compare)
+    {
+        if (_size < 2)
+        {
+            return;
+        }
+        Vector<ValueTypeAlias> values;
+        values.Reverse(_size);
+        for (auto it = GetConstBegin(); it != GetConstEnd(); ++it)
+        {
+            values.PushBack(*it);
+        }
+        values.MergeSort(compare);
+        SizeTypeAlias i = 0;
+        for (auto it = GetBegin(); it != GetEnd(); ++it)
+        {
+            *it = values[i++];
+        }
+    }
+
+    void Reverse() noexcept
+    {
+        if (_nodes.IsEmpty())
+        {
+            return;
+        }
+        Index current = HeadIndex;
+        do
+        {
+            NodeAlias &node = _nodes[current];
+            std::swap(node.Next, node.Prev);
+            current = node.Prev;
+        } while (current != HeadIndex);
+    }
+
+    /**
+     * Renumber the nodes so element i sits in node i + 1, in a freshly allocated array with no free nodes. A scan
+     * then walks the array front to back. Invalidates all iterators.
+     */
+    void Compact()
+    {
+        NodeVectorAlias nodes(_nodeAllocator);
+        if (_size > 0)
+        {
+            nodes.Reverse(_size + 1);
+            const auto last = static_cast<Index>(_size);
+            nodes.EmplaceBack();
+            nodes[HeadIndex].Next = 1;
+            nodes[HeadIndex].Prev = last;
+            Index next = 1;
+            for (auto it = GetConstBegin(); it != GetConstEnd(); ++it, ++next)
+            {
+                nodes.EmplaceBack();
+                NodeAlias &node = nodes[next];
+                node.Next = next == last ? HeadIndex : static_cast<Index>(next + 1);
+                node.Prev = static_cast<Index>(next - 1);
+                ::new (static_cast<void *>(node.Storage)) ValueTypeAlias(*it);
+            }
+        }
+        _nodes.Swap(nodes);
+        _free = NullIndex;
+    }
+
+    void Swap(CompactList &list) noexcept
+    {
+        std::swap(_nodeAllocator, list._nodeAllocator);
+        _nodes.Swap(list._nodes);
+        std::swap(_free, list._free);
+        std::swap(_size, list._size);
+    }
+
+    /** Drop every element and keep the node array's capacity for reuse. */
+    void Clear() noexcept
+    {
+        _nodes.Clear();
+        _free = NullIndex;
+        _size = 0;
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_COMPACT_LIST_HPP
@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_COMPACT_LIST_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_COMPACT_LIST_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class CompactListException : public Utilities::Exception
+{
+  public:
+    CompactListException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class CompactListEmptyException : public CompactListException
+{
+  public:
+    CompactListEmptyException(string_type fileText, numeric_type line)
+        : CompactListException("Compact list is empty", std::move(fileText), line)
+    {
+    }
+};
+class CompactListFullException : public CompactListException
+{
+  public:
+    CompactListFullException(string_type fileText, numeric_type line)
+        : CompactListException("Compact list index type cannot address another node", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,165 @@
+#ifndef DSA_LIBRARIES_COMPACT_LIST_ITERATOR_HPP
+#define DSA_LIBRARIES_COMPACT_LIST_ITERATOR_HPP
+#include <cstddef>
+#include <iterator>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Position in a CompactList as an index into its node array, so it stays valid when the array grows; only
+ * erasing the element or Compact() invalidates it. Index 0 is the sentinel, which serves as both end and before-begin.
+ */
+template <typename T, typename Index, typename TNodes> struct CompactListIterator
+{
+    TNodes *Nodes;
+    Index Position;
+
+    using SelfAlias = CompactListIterator<T, Index, TNodes>;
+    using ValueTypeAlias = T;
+    using PointerAlias = T *;
+    using ReferenceAlias = T &;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    CompactListIterator() noexcept : Nodes(), Position()
+    {
+    }
+
+    CompactListIterator(TNodes *nodes, Index position) noexcept : Nodes(nodes), Position(position)
+    {
+    }
+
+    ReferenceAlias operator*() const noexcept
+    {
+        return *(*this->Nodes)[this->Position].GetData();
+    }
+
+    PointerAlias operator->() const noexcept
+    {
+        return (*this->Nodes)[this->Position].GetData();
+    }
+
+    SelfAlias &operator++() noexcept
+    {
+        this->Position = (*this->Nodes)[this->Position].Next;
+        return *this;
+    }
+
+    SelfAlias operator++(int) noexcept
+    {
+        SelfAlias temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    SelfAlias &operator--() noexcept
+    {
+        this->Position = (*this->Nodes)[this->Position].Prev;
+        return *this;
+    }
+
+    SelfAlias operator--(int) noexcept
+    {
+        SelfAlias temp(*this);
+        --*this;
+        return temp;
+    }
+
+    friend bool operator==(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.Position == rhs.Position;
+    }
+
+    friend bool operator!=(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <typename T, typename Index, typename TNodes> struct CompactListConstIterator
+{
+    const TNodes *Nodes;
+    Index Position;
+
+    using SelfAlias = CompactListConstIterator<T, Index, TNodes>;
+    using IteratorAlias = CompactListIterator<T, Index, TNodes>;
+    using ValueTypeAlias = T;
+    using PointerAlias = const T *;
+    using ReferenceAlias = const T &;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    CompactListConstIterator() noexcept : Nodes(), Position()
+    {
+    }
+
+    CompactListConstIterator(const TNodes *nodes, Index position) noexcept : Nodes(nodes), Position(position)
+    {
+    }
+
+    CompactListConstIterator(const IteratorAlias &iter) noexcept : Nodes(iter.Nodes), Position(iter.Position)
+    {
+    }
+
+    [[nodiscard]] IteratorAlias ConstCast() const noexcept
+    {
+        return IteratorAlias(const_cast<TNodes *>(this->Nodes), this->Position);
+    }
+
+    ReferenceAlias operator*() const noexcept
+    {
+        return *(*this->Nodes)[this->Position].GetData();
+    }
+
+    PointerAlias operator->() const noexcept
+    {
+        return (*this->Nodes)[this->Position].GetData();
+    }
+
+    SelfAlias &operator++() noexcept
+    {
+        this->Position = (*this->Nodes)[this->Position].Next;
+        return *this;
+    }
+
+    SelfAlias operator++(int) noexcept
+    {
+        SelfAlias temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    SelfAlias &operator--() noexcept
+    {
+        this->Position = (*this->Nodes)[this->Position].Prev;
+        return *this;
+    }
+
+    SelfAlias operator--(int) noexcept
+    {
+        SelfAlias temp(*this);
+        --*this;
+        return temp;
+    }
+
+    friend bool operator==(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.Position == rhs.Position;
+    }
+
+    friend bool operator!=(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_COMPACT_LIST_ITERATOR_HPP
@@ -0,0 +1,27 @@
+#ifndef DSA_LIBRARIES_COMPACT_LIST_NODE_HPP
+#define DSA_LIBRARIES_COMPACT_LIST_NODE_HPP
+#include <new>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Node of a CompactList: links are indices into the node array rather than pointers, so with 32-bit indices
+ * a node costs 8 bytes of links instead of 16 and the array can be copied or written out as is.
+ */
+template <typename T, typename Index> struct CompactListNode
+{
+    Index Next;
+    Index Prev;
+    alignas(T) unsigned char Storage[sizeof(T)];
+
+    T *GetData() noexcept
+    {
+        return std::launder(reinterpret_cast<T *>(Storage));
+    }
+
+    const T *GetData() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T *>(Storage));
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_COMPACT_LIST_NODE_HPP
@@ -1,9 +1,19 @@
 #ifndef DSA_LIBRARIES_DLIST_HPP
 #define DSA_LIBRARIES_DLIST_HPP
 #include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Instrumentation.hpp"
+#include "../../Utilities/NodePool.hpp"
+#include "../../Utilities/NodeSlabs.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "../LoserTree/LoserTree.hpp"
 #include "DListIterator.hpp"
 #include "DListNode.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
 #include <memory>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -11,16 +21,22 @@ using namespace DSALibraries::Utilities;
 
 namespace DSALibraries::Containers
 {
+template <typename T, typename Alloc> class DList;
+
 template <typename T, typename Alloc> class DListBase
 {
   protected:
     using TypeAllocatorTraitsAlias = std::allocator_traits<Alloc>;
     using NodeAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<DListNode<T>>;
     using TpAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<T>;
+    using NodeSlabsAlias = Utilities::NodeSlabs<DListNode<T>, NodeAllocatorTypeAlias>;
 
     struct DListBaseCore : NodeAllocatorTypeAlias
     {
         DListNodeBase NodeHead;
+        // Last node, or &NodeHead when empty, so the back is reachable in O(1).
+        DListNodeBase* NodeTail = &NodeHead;
+        Utilities::NodePool<DListNode<T>, NodeAllocatorTypeAlias> Pool;
 
         DListBaseCore() : NodeAllocatorTypeAlias(), NodeHead()
         {
@@ -43,12 +59,127 @@ template <typename T, typename Alloc> class DListBase
 
     DListNode<T>* GetNodeInternal() noexcept
     {
-        return static_cast<DListNode<T>*>(LinkedListCore.NodeAllocatorTypeAlias::allocate(1));
+        if (DListNode<T>* node = this->LinkedListCore.Pool.Pop())
+        {
+            return node;
+        }
+        DListNode<T>* node = NodeSlabsAlias::AllocateOne(this->GetNodeAllocatorInternal());
+        Utilities::InstrumentationHooks<DList<T, Alloc>>::OnAllocation(sizeof(DListNode<T>));
+        return node;
     }
 
     void PutNodeInternal(DListNode<T>* node) noexcept
     {
-        LinkedListCore.NodeAllocatorTypeAlias::deallocate(node, 1);
+        if (this->LinkedListCore.Pool.Push(node))
+        {
+            return;
+        }
+        ReportNodesFreedInternal(NodeSlabsAlias::Deallocate(this->GetNodeAllocatorInternal(), node));
+    }
+
+    void ReserveNodesInternal(std::size_t count)
+    {
+        if (const std::size_t bytes = this->LinkedListCore.Pool.Reserve(this->GetNodeAllocatorInternal(), count))
+        {
+            Utilities::InstrumentationHooks<DList<T, Alloc>>::OnAllocation(bytes);
+        }
+    }
+
+    void SetNodePoolLimitInternal(std::size_t limit) noexcept
+    {
+        this->LinkedListCore.Pool.SetLimit(this->GetNodeAllocatorInternal(), limit, &ReportNodesFreedInternal);
+    }
+
+    void ReleaseNodePoolInternal() noexcept
+    {
+        this->LinkedListCore.Pool.Release(this->GetNodeAllocatorInternal(), &ReportNodesFreedInternal);
+    }
+
+    /** Report one allocator call per lone node or slab given back; bytes is 0 while a node's slab is in use. */
+    static void ReportNodesFreedInternal(std::size_t bytes) noexcept
+    {
+        if (bytes != 0)
+        {
+            Utilities::InstrumentationHooks<DList<T, Alloc>>::OnDeallocation(bytes);
+        }
+    }
+
+    /** Allocate size contiguous nodes: one slab, or a single, possibly cached, node when size is 1. */
+    DListNode<T>* AllocateNodesInternal(std::size_t size)
+    {
+        if (size == 1)
+        {
+            return this->GetNodeInternal();
+        }
+        auto* slab = NodeSlabsAlias::Allocate(this->GetNodeAllocatorInternal(), size);
+        Utilities::InstrumentationHooks<DList<T, Alloc>>::OnAllocation(NodeSlabsAlias::GetSlabBytes(size));
+        return slab;
+    }
+
+    /**
+     * Allocate size contiguous nodes and construct their elements in order by calling construct with each element's
+     * storage. The nodes are returned unlinked. On exception the built elements are destroyed and every node is
+     * released, so the list is left as it was.
+     */
+    template <typename TConstruct> DListNode<T>* CreateNodesInternal(std::size_t size, TConstruct construct)
+    {
+        DListNode<T>* nodes = this->AllocateNodesInternal(size);
+        std::size_t built = 0;
+        try
+        {
+            for (; built < size; ++built)
+            {
+                construct(nodes[built].GetData());
+            }
+        }
+        catch (...)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (i < built)
+                {
+                    this->GetTpAllocatorInternal().destroy(nodes[i].GetData());
+                }
+                this->PutNodeInternal(nodes + i);
+            }
+            throw;
+        }
+        return nodes;
+    }
+
+    /** Link size contiguous nodes behind position in order and return the last one. */
+    DListNodeBase* LinkNodesAfterInternal(DListNodeBase* position, DListNode<T>* nodes, std::size_t size) noexcept
+    {
+        DListNodeBase* next = position->PointerNext;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            nodes[i].PointerPrev = i == 0 ? position : nodes + i - 1;
+            nodes[i].PointerNext = i + 1 == size ? next : nodes + i + 1;
+        }
+        DListNode<T>* last = nodes + size - 1;
+        if (next != nullptr)
+        {
+            next->PointerPrev = last;
+        }
+        position->PointerNext = nodes;
+        if (this->LinkedListCore.NodeTail == position)
+        {
+            this->LinkedListCore.NodeTail = last;
+        }
+        return last;
+    }
+
+    /**
+     * Move the size elements starting at first into new contiguous nodes, in order, and return them unlinked. On
+     * exception the nodes are released and the source elements are left as move_if_noexcept left them.
+     */
+    DListNode<T>* MoveToSlabInternal(DListNodeBase* first, std::size_t size)
+    {
+        return this->CreateNodesInternal(size, [this, &first](T* data) {
+            auto* source = static_cast<DListNode<T>*>(first);
+            this->GetTpAllocatorInternal().construct(data, std::move_if_noexcept(*source->GetData()));
+            first = first->PointerNext;
+        });
     }
 
   public:
@@ -87,6 +218,7 @@ template <typename T, typename Alloc> class DListBase
     DListBase(DListBase&& list, NodeAllocatorTypeAlias&& al, std::true_type) noexcept
         : LinkedListCore(std::move(list.LinkedListCore), std::move(al))
     {
+        this->TakeTailInternal(list);
     }
 
     DListBase(DListBase&& list, NodeAllocatorTypeAlias&& al) noexcept
@@ -96,14 +228,48 @@ template <typename T, typename Alloc> class DListBase
         {
             this->LinkedListCore.NodeHead = std::move(list.LinkedListCore.NodeHead);
         }
+        this->TakeTailInternal(list);
     }
 
     ~DListBase() noexcept
     {
         this->EraseAfterInternal(&this->LinkedListCore.NodeHead, nullptr);
+        this->ReleaseNodePoolInternal();
     }
 
   protected:
+    /** Point the first node back at the head after the head moved, or the tail at the head when empty. */
+    void RelinkHeadInternal() noexcept
+    {
+        NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        if (head.PointerNext != nullptr)
+        {
+            head.PointerNext->PointerPrev = &head;
+        }
+        else
+        {
+            this->LinkedListCore.NodeTail = &head;
+        }
+    }
+
+    /** Called once the head of list has been moved into this empty list: take its tail too. */
+    void TakeTailInternal(DListBase& list) noexcept
+    {
+        this->LinkedListCore.NodeTail = list.LinkedListCore.NodeTail;
+        this->RelinkHeadInternal();
+        list.RelinkHeadInternal();
+    }
+
+    /** Set the tail by walking on from node, which is the last node already when the caller knows it. */
+    void ResetTailInternal(NodeBaseAlias* node) noexcept
+    {
+        while (node->PointerNext != nullptr)
+        {
+            node = node->PointerNext;
+        }
+        this->LinkedListCore.NodeTail = node;
+    }
+
     template <typename... Args> NodeAlias* CreateNodeInternal(Args&&... args)
     {
         NodeAlias* node = this->GetNodeInternal();
@@ -124,7 +290,16 @@ template <typename T, typename Alloc> class DListBase
 
         NodeAlias* newNode = this->CreateNodeInternal(std::forward<Args>(args)...);
 
-        newNode->HookBeforeInternal(nodeBase);
+        if (nodeBase == nullptr)
+        {
+            // Before the end is after the tail.
+            newNode->HookAfterInternal(this->LinkedListCore.NodeTail);
+            this->LinkedListCore.NodeTail = newNode;
+        }
+        else
+        {
+            newNode->HookBeforeInternal(nodeBase);
+        }
 
         return IteratorAlias(newNode);
     }
@@ -137,6 +312,11 @@ template <typename T, typename Alloc> class DListBase
 
         newNode->HookAfterInternal(nodeBase);
 
+        if (this->LinkedListCore.NodeTail == nodeBase)
+        {
+            this->LinkedListCore.NodeTail = newNode;
+        }
+
         return IteratorAlias(newNode);
     }
 
@@ -146,6 +326,11 @@ template <typename T, typename Alloc> class DListBase
 
         currentNode->UnhookInternal();
 
+        if (this->LinkedListCore.NodeTail == currentNode)
+        {
+            this->LinkedListCore.NodeTail = position;
+        }
+
         this->GetTpAllocatorInternal().destroy(currentNode->GetData());
 
         currentNode->~NodeAlias();
@@ -173,6 +358,10 @@ template <typename T, typename Alloc> class DListBase
         {
             end->PointerPrev = begin;
         }
+        else
+        {
+            this->LinkedListCore.NodeTail = begin;
+        }
 
         return end;
     }
@@ -207,6 +396,9 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
     using size_type = SizeTypeAlias;
 
   private:
+    /** Smallest chunk ParallelSort hands to a thread; below it the thread costs more than it saves. */
+    static constexpr SizeTypeAlias ParallelSortChunkMinimum = 4096;
+
     DList(DList&& list, NodeAllocatorTypeAlias&& nodeAllocator, std::false_type) noexcept
         : DListBaseAlias(std::move(list), std::move(nodeAllocator))
     {
@@ -239,9 +431,16 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         FillInitializeInternal(size, value);
     }
 
-    DList(const DList& list) : DListBaseAlias(NodeAllocatorTypeAlias::select_on_container_copy_construction())
+    DList(const DList& list)
+        : DListBaseAlias(
+              NodeAllocatorTypeAlias(list.GetNodeAllocatorInternal().select_on_container_copy_construction()))
+    {
+        RangeInitalizeInternal(list.GetConstBegin(), list.GetConstEnd());
+    }
+
+    DList(DList&& list) noexcept
+        : DListBaseAlias(std::move(list), NodeAllocatorTypeAlias(list.GetNodeAllocatorInternal()), std::true_type())
     {
-        RangeInitalizeInternal(list.GetBegin(), list.GetEnd());
     }
 
     DList(std::initializer_list<ValueTypeAlias> init, const AllocatorTypeAlias& al = AllocatorTypeAlias())
@@ -421,7 +620,48 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
 
     void PopFront()
     {
-        this->EraseAfterInternal(GetBeginFromHead());
+        this->EraseAfterInternal(&this->LinkedListCore.NodeHead);
+    }
+
+    /** @brief Iterator to the last element, or GetBeginFromHead() when empty; O(1). */
+    IteratorAlias GetBeforeEnd() noexcept
+    {
+        return IteratorAlias(this->LinkedListCore.NodeTail);
+    }
+
+    ConstIteratorAlias GetConstBeforeEnd() const noexcept
+    {
+        return ConstIteratorAlias(this->LinkedListCore.NodeTail);
+    }
+
+    ReferenceTypeAlias GetItemBack() noexcept
+    {
+        return *static_cast<NodeAlias*>(this->LinkedListCore.NodeTail)->GetData();
+    }
+
+    ConstReferenceTypeAlias GetConstItemBack() const noexcept
+    {
+        return *static_cast<const NodeAlias*>(this->LinkedListCore.NodeTail)->GetData();
+    }
+
+    void PushBack(const ValueTypeAlias& value)
+    {
+        this->InsertAfterInternal(this->GetConstBeforeEnd(), value);
+    }
+
+    void PushBack(ValueTypeAlias&& value)
+    {
+        this->InsertAfterInternal(this->GetConstBeforeEnd(), std::move(value));
+    }
+
+    template <typename... Args> void EmplaceBack(Args&&... args)
+    {
+        this->InsertAfterInternal(this->GetConstBeforeEnd(), std::forward<Args>(args)...);
+    }
+
+    void PopBack()
+    {
+        this->EraseAfterInternal(this->LinkedListCore.NodeTail->PointerPrev);
     }
 
     template <typename... Args> IteratorAlias EmplaceBefore(ConstIteratorAlias position, Args&&... args)
@@ -456,29 +696,30 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
 
     IteratorAlias InsertAfter(ConstIteratorAlias position, SizeTypeAlias size, const ValueTypeAlias& value)
     {
-        if (size)
-        {
-            DList temp(size, value, this->GetAllocator());
-            return this->SpliceAfterInternal(position, temp.GetBeginFromHead(), temp.GetConstEnd());
-        }
-        else
-        {
-            return IteratorAlias(const_cast<IteratorAlias*>(position.NodeBase));
-        }
+        return IteratorAlias(
+            this->FillInsertAfterInternal(const_cast<NodeBaseAlias*>(position.NodeBase), size, value));
     }
 
     template <typename InputIterator>
-    void InsertAfter(ConstIteratorAlias position, InputIterator begin, InputIterator end)
+    IteratorAlias InsertAfter(ConstIteratorAlias position, InputIterator begin, InputIterator end)
     {
-        DList list(begin, end, this->GetAllocator());
-
-        if (!list.IsEmpty())
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            return this->SpliceAfterInternal(position, list.GetConstBeginFromHead(), list.GetConstEnd());
+            return IteratorAlias(
+                this->RangeInsertAfterInternal(const_cast<NodeBaseAlias*>(position.NodeBase), begin, end));
         }
         else
         {
-            return IteratorAlias(const_cast<IteratorAlias*>(position.NodeBase));
+            DList list(begin, end, this->GetAllocator());
+
+            if (!list.IsEmpty())
+            {
+                return this->SpliceAfterInternal(position, list.GetConstBeginFromHead(), list.GetConstEnd());
+            }
+            else
+            {
+                return IteratorAlias(const_cast<NodeBaseAlias*>(position.NodeBase));
+            }
         }
     }
 
@@ -497,6 +738,7 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         if (!list.IsEmpty())
         {
             this->SpliceAfterInternal(pos, list.GetBeginFromHead(), list.GetConstEnd());
+            list.LinkedListCore.NodeTail = &list.LinkedListCore.NodeHead;
         }
     }
 
@@ -514,11 +756,29 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
             return;
         }
         NodeBaseAlias* begin = const_cast<NodeBaseAlias*>(pos.NodeBase);
-        return begin->TransferAfter(const_cast<NodeBaseAlias*>(it.NodeBase), const_cast<NodeBaseAlias*>(next.NodeBase));
+        if (list.LinkedListCore.NodeTail == next.NodeBase)
+        {
+            list.LinkedListCore.NodeTail = const_cast<NodeBaseAlias*>(it.NodeBase);
+        }
+        if (this->LinkedListCore.NodeTail == begin)
+        {
+            this->LinkedListCore.NodeTail = const_cast<NodeBaseAlias*>(next.NodeBase);
+        }
+        begin->TransferAfter(const_cast<NodeBaseAlias*>(it.NodeBase), const_cast<NodeBaseAlias*>(next.NodeBase));
     }
 
-    void SpliceAfter(ConstIteratorAlias pos, DListBaseAlias&& list, ConstIteratorAlias begin, ConstIteratorAlias end)
+    void SpliceAfter(ConstIteratorAlias pos, DList& list, ConstIteratorAlias it)
     {
+        SpliceAfter(pos, std::move(list), it);
+    }
+
+    void SpliceAfter(ConstIteratorAlias pos, DList&& list, ConstIteratorAlias begin, ConstIteratorAlias end)
+    {
+        if (end == list.GetConstEnd() && begin.NodeBase->PointerNext != nullptr)
+        {
+            // The range ends at the tail of list; when list is this list, SpliceAfterInternal corrects it again.
+            list.LinkedListCore.NodeTail = const_cast<NodeBaseAlias*>(begin.NodeBase);
+        }
         this->SpliceAfterInternal(pos, begin, end);
     }
 
@@ -527,6 +787,26 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         SpliceAfter(pos, std::move(list), first, last);
     }
 
+    /** @brief Move every element of list to the back of this list in O(1). */
+    void SpliceBack(DList&& list) noexcept
+    {
+        if (std::addressof(list) == this || list.IsEmpty())
+        {
+            return;
+        }
+        NodeBaseAlias* first = list.LinkedListCore.NodeHead.PointerNext;
+        this->LinkedListCore.NodeTail->PointerNext = first;
+        first->PointerPrev = this->LinkedListCore.NodeTail;
+        this->LinkedListCore.NodeTail = list.LinkedListCore.NodeTail;
+        list.LinkedListCore.NodeHead.PointerNext = nullptr;
+        list.LinkedListCore.NodeTail = &list.LinkedListCore.NodeHead;
+    }
+
+    void SpliceBack(DList& list) noexcept
+    {
+        SpliceBack(std::move(list));
+    }
+
     IteratorAlias EraseAfter(ConstIteratorAlias position)
     {
         return IteratorAlias(this->EraseAfterInternal(const_cast<NodeBaseAlias*>(position.NodeBase)));
@@ -613,10 +893,14 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
             node = node->PointerNext;
         }
 
-        if (list.LinkedListCore.NodeHead.PointerNext)
+        if (NodeBaseAlias* rest = list.LinkedListCore.NodeHead.PointerNext)
         {
-            *node = std::move(list.LinkedListCore.NodeHead);
+            node->PointerNext = rest;
+            rest->PointerPrev = node;
+            list.LinkedListCore.NodeHead.PointerNext = nullptr;
+            this->LinkedListCore.NodeTail = list.LinkedListCore.NodeTail;
         }
+        list.LinkedListCore.NodeTail = &list.LinkedListCore.NodeHead;
     }
 
     template <typename Compare> void Merge(DList& list, Compare compare)
@@ -624,13 +908,158 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         Merge(std::move(list), compare);
     }
 
+    /**
+     * @brief Merge the sorted lists into this sorted list in one relinking pass, with a LoserTree over the list fronts:
+     * O(n log k) comparisons for k lists and no node allocation. Equal elements come from this list first, then from
+     * the lists in argument order. The lists are left empty and must use an allocator equal to this one.
+     */
+    template <typename TCompare, typename... TLists>
+        requires(!std::is_same_v<std::remove_cvref_t<TCompare>, DList> && (std::is_same_v<TLists, DList> && ...))
+    void MergeAll(TCompare compare, TLists&... lists)
+    {
+        DList* sources[] = {this, std::addressof(lists)...};
+        this->MergeAllInternal([&sources](SizeTypeAlias i) { return sources[i]; }, sizeof...(TLists) + 1, compare);
+    }
+
+    template <typename... TLists>
+        requires(std::is_same_v<TLists, DList> && ...)
+    void MergeAll(TLists&... lists)
+    {
+        this->MergeAll(std::less<ValueTypeAlias>(), lists...);
+    }
+
+    /** @brief MergeAll over the count lists stored from lists on, such as the shards kept in a Vector. */
+    template <typename TCompare> void MergeAll(DList* lists, SizeTypeAlias count, TCompare compare)
+    {
+        this->MergeAllInternal([this, lists](SizeTypeAlias i) { return i == 0 ? this : lists + i - 1; }, count + 1,
+                               compare);
+    }
+
+    void MergeAll(DList* lists, SizeTypeAlias count)
+    {
+        this->MergeAll(lists, count, std::less<ValueTypeAlias>());
+    }
+
     void Sort()
     {
         this->Sort(std::less<ValueTypeAlias>());
     }
 
-    template <typename TCompare> void Sort(TCompare compare)
+    /**
+     * @brief Stable sort on several threads. One pass over the list notes every ParallelSortChunkMinimum-th node,
+     * the list is cut at those marks into chunks of at least that many nodes, each chunk is sorted by Sort on its own
+     * thread, and MergeAll relinks the sorted chunks; no element is copied or moved. compare is copied for every
+     * thread. If it throws, the chunks are still joined back, as Sort left them, and the first exception is rethrown.
+     *
+     * @param threadCount Number of threads including the caller; 0 uses std::thread::hardware_concurrency.
+     */
+    template <typename TCompare>
+        requires(!std::is_integral_v<TCompare>)
+    void ParallelSort(TCompare compare, SizeTypeAlias threadCount = 0)
     {
+        if (threadCount == 0)
+        {
+            threadCount = std::max<SizeTypeAlias>(1, std::thread::hardware_concurrency());
+        }
+        Vector<NodeBaseAlias*> marks;
+        SizeTypeAlias position = 0;
+        for (NodeBaseAlias* node = this->LinkedListCore.NodeHead.PointerNext; node != nullptr; node = node->PointerNext)
+        {
+            if (++position % ParallelSortChunkMinimum == 0)
+            {
+                marks.PushBack(node);
+            }
+        }
+        const SizeTypeAlias count = std::min(threadCount, marks.GetSize());
+        if (count < 2)
+        {
+            this->Sort(compare);
+            return;
+        }
+
+        // This list keeps the first chunk, so MergeAll's preference for it keeps equal elements in order.
+        Vector<std::unique_ptr<DList>> chunks;
+        chunks.Reverse(count - 1);
+        for (SizeTypeAlias i = 1; i < count; ++i)
+        {
+            chunks.PushBack(std::make_unique<DList>(this->GetAllocator()));
+        }
+        Vector<std::exception_ptr> errors(count);
+        Vector<std::thread> workers;
+        workers.Reverse(count - 1);
+
+        // Every chunk but the last ends on a mark, spread as evenly as the marks allow; the last ends at the tail.
+        NodeBaseAlias* const tail = this->LinkedListCore.NodeTail;
+        NodeBaseAlias* before = &this->LinkedListCore.NodeHead;
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            NodeBaseAlias* last = i + 1 == count ? tail : marks[(i + 1) * marks.GetSize() / count - 1];
+            if (i == 0)
+            {
+                this->LinkedListCore.NodeTail = last;
+            }
+            else
+            {
+                DList& chunk = *chunks[i - 1];
+                chunk.LinkedListCore.NodeHead.PointerNext = std::exchange(before->PointerNext, nullptr);
+                chunk.LinkedListCore.NodeHead.PointerNext->PointerPrev = &chunk.LinkedListCore.NodeHead;
+                chunk.LinkedListCore.NodeTail = last;
+            }
+            before = last;
+        }
+
+        auto sortChunk = [this, &chunks, &errors, &compare](SizeTypeAlias i) noexcept {
+            try
+            {
+                (i == 0 ? *this : *chunks[i - 1]).Sort(compare);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        };
+        SizeTypeAlias started = 1;
+        for (; started < count; ++started)
+        {
+            try
+            {
+                workers.EmplaceBack(sortChunk, started);
+            }
+            catch (...)
+            {
+                // Sort the chunks left over on this thread.
+                break;
+            }
+        }
+        for (SizeTypeAlias i = started; i < count; ++i)
+        {
+            sortChunk(i);
+        }
+        sortChunk(0);
+        for (SizeTypeAlias i = 0; i < workers.GetSize(); ++i)
+        {
+            workers[i].join();
+        }
+
+        this->MergeAllInternal([this, &chunks](SizeTypeAlias i) { return i == 0 ? this : chunks[i - 1].get(); }, count,
+                               compare);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+        }
+    }
+
+    void ParallelSort(SizeTypeAlias threadCount = 0)
+    {
+        this->ParallelSort(std::less<ValueTypeAlias>(), threadCount);
+    }
+
+    template <typename TCompare> void Sort(TCompare userCompare)
+    {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         // MergeHelper Sort for doubly linked list
 
         IteratorAlias pLeft;
@@ -643,6 +1072,7 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         SizeTypeAlias numOfMerges;
         SizeTypeAlias leftSize;
         SizeTypeAlias rightSize;
+        SizeTypeAlias nodeWalks = 0;
 
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -667,6 +1097,7 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
                 {
                     ++pRight;
                     ++leftSize;
+                    ++nodeWalks;
                     if (pRight == this->GetEnd())
                     {
                         break;
@@ -716,12 +1147,16 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
                         pTail = pNode;
                     }
                     pTail.NodeBase->PointerNext = nullptr;
+                    ++nodeWalks;
                 }
                 pLeft = pRight;
             }
 
+            Utilities::InstrumentationHooks<DList>::OnNodeWalks(nodeWalks);
+            nodeWalks = 0;
             if (numOfMerges <= 1)
             {
+                this->ResetTailInternal(pTail.NodeBase);
                 return;
             }
             listSize *= 2;
@@ -730,14 +1165,82 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
 
     void Reverse() noexcept
     {
+        if (!this->IsEmpty())
+        {
+            this->LinkedListCore.NodeTail = this->LinkedListCore.NodeHead.PointerNext;
+        }
         this->LinkedListCore.NodeHead.ReverseAfter();
     }
 
+    /**
+     * @brief Move every element into one slab of nodes laid out in iteration order and relink them, so later scans
+     * walk memory front to back. Invalidates iterators; if an element's move throws, the list is unchanged.
+     */
+    void Compact()
+    {
+        const SizeTypeAlias size = this->GetSize();
+        if (size == 0)
+        {
+            return;
+        }
+        NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        NodeAlias* slab = this->MoveToSlabInternal(head.PointerNext, size);
+        this->EraseAfterInternal(&head, nullptr);
+        this->LinkNodesAfterInternal(&head, slab, size);
+    }
+
+    /** @brief Fraction of links that jump elsewhere in memory instead of to the adjacent node; 0 after Compact. */
+    [[nodiscard]] double GetScatter() const noexcept
+    {
+        const NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        Utilities::NodeScatter<NodeAlias> scatter;
+        for (const NodeBaseAlias* node = head.PointerNext; node != nullptr; node = node->PointerNext)
+        {
+            scatter.Visit(static_cast<const NodeAlias*>(node));
+        }
+        return scatter.GetScatter();
+    }
+
+    /**
+     * @brief Keep up to limit erased nodes for reuse by later inserts instead of freeing them. 0, the default, turns
+     * recycling off; lowering the limit frees the surplus.
+     */
+    void SetNodeCacheLimit(SizeTypeAlias limit) noexcept
+    {
+        this->SetNodePoolLimitInternal(limit);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetNodeCacheLimit() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetLimit();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCachedNodeCount() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetCount();
+    }
+
+    /**
+     * @brief Cache at least count spare nodes, allocated together in one call, so the next count inserts do not
+     * allocate. Raises the cache limit to count if it is lower.
+     */
+    void Reserve(SizeTypeAlias count)
+    {
+        this->ReserveNodesInternal(count);
+    }
+
+    /** @brief Free every cached node. The cache limit is kept. */
+    void ShrinkToFit() noexcept
+    {
+        this->ReleaseNodePoolInternal();
+    }
+
     void Swap(DList& list) noexcept
     {
         std::swap(this->LinkedListCore.NodeHead.PointerNext, list.LinkedListCore.NodeHead.PointerNext);
-        std::swap(this->LinkedListCore.NodeHead.PointerNext.PointerPrev,
-                  list.LinkedListCore.NodeHead.PointerNext.PointerPrev);
+        std::swap(this->LinkedListCore.NodeTail, list.LinkedListCore.NodeTail);
+        this->RelinkHeadInternal();
+        list.RelinkHeadInternal();
     }
 
     void Clear() noexcept
@@ -746,39 +1249,67 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
     }
 
   private:
-    void DefaultInitializeInternal(SizeTypeAlias size)
+    /** Insert size copies of value behind position from one slab and return the last one, or position if size is 0. */
+    NodeBaseAlias* FillInsertAfterInternal(NodeBaseAlias* position, SizeTypeAlias size, const ValueTypeAlias& value)
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-
-        for (; size > 0; --size)
+        if (size == 0)
         {
-            NodeAlias* newNode = this->CreateNodeInternal();
-            newNode->HookAfterInternal(temp);
-            temp = newNode;
+            return position;
         }
+        NodeAlias* nodes = this->CreateNodesInternal(
+            size, [this, &value](T* data) { this->GetTpAllocatorInternal().construct(data, value); });
+        return this->LinkNodesAfterInternal(position, nodes, size);
     }
 
-    void FillInitializeInternal(SizeTypeAlias size, const ValueTypeAlias& value)
+    /** Forward range counterpart of FillInsertAfterInternal: count the range, then build it in one slab. */
+    template <typename ForwardIterator>
+    NodeBaseAlias* RangeInsertAfterInternal(NodeBaseAlias* position, ForwardIterator begin, ForwardIterator end)
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
+        const auto size = static_cast<SizeTypeAlias>(std::distance(begin, end));
+        if (size == 0)
+        {
+            return position;
+        }
+        NodeAlias* nodes = this->CreateNodesInternal(size, [this, &begin](T* data) {
+            this->GetTpAllocatorInternal().construct(data, *begin);
+            ++begin;
+        });
+        return this->LinkNodesAfterInternal(position, nodes, size);
+    }
 
-        for (; size > 0; --size)
+    void DefaultInitializeInternal(SizeTypeAlias size)
+    {
+        if (size != 0)
         {
-            NodeAlias* newNode = this->CreateNodeInternal(value);
-            newNode->HookAfterInternal(temp);
-            temp = newNode;
+            NodeAlias* nodes =
+                this->CreateNodesInternal(size, [this](T* data) { this->GetTpAllocatorInternal().construct(data); });
+            this->LinkNodesAfterInternal(&this->LinkedListCore.NodeHead, nodes, size);
         }
     }
 
-    template <typename InputIterator> void RangeInitalizeInternal(InputIterator begin, InputIterator end)
+    void FillInitializeInternal(SizeTypeAlias size, const ValueTypeAlias& value)
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
+        this->FillInsertAfterInternal(&this->LinkedListCore.NodeHead, size, value);
+    }
 
-        for (; begin != end; ++begin)
+    /** Forward ranges are built in one slab; input ranges, which cannot be counted first, go node by node. */
+    template <typename InputIterator> void RangeInitalizeInternal(InputIterator begin, InputIterator end)
+    {
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            NodeAlias* newNode = this->CreateNodeInternal(*begin);
-            newNode->HookAfterInternal(temp);
-            temp = newNode;
+            this->RangeInsertAfterInternal(&this->LinkedListCore.NodeHead, begin, end);
+        }
+        else
+        {
+            NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
+
+            for (; begin != end; ++begin)
+            {
+                NodeAlias* newNode = this->CreateNodeInternal(*begin);
+                newNode->HookAfterInternal(temp);
+                temp = newNode;
+                this->LinkedListCore.NodeTail = temp;
+            }
         }
     }
 
@@ -812,10 +1343,76 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         this->InsertAfter(this->GetConstBeginFromHead(), begin, end);
     }
 
+    /**
+     * Relink the nodes of the count sorted lists given by sources(i) into this list, which is sources(0). A list given
+     * twice is merged once. If compare throws, the nodes not merged yet are appended unsorted, so none is lost.
+     */
+    template <typename TSources, typename TCompare>
+    void MergeAllInternal(TSources sources, SizeTypeAlias count, TCompare compare)
+    {
+        auto byValue = [&compare](const NodeBaseAlias* lhs, const NodeBaseAlias* rhs) {
+            return compare(*static_cast<const NodeAlias*>(lhs)->GetData(),
+                           *static_cast<const NodeAlias*>(rhs)->GetData());
+        };
+        LoserTree<NodeBaseAlias*, decltype(byValue)> tree(count, byValue);
+        Vector<NodeBaseAlias*> heads(count, nullptr);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            DList* list = sources(i);
+            heads[i] = std::exchange(list->LinkedListCore.NodeHead.PointerNext, nullptr);
+            list->LinkedListCore.NodeTail = &list->LinkedListCore.NodeHead;
+            if (heads[i] != nullptr)
+            {
+                tree.SetSource(i, heads[i]);
+            }
+        }
+
+        NodeBaseAlias* tail = &this->LinkedListCore.NodeHead;
+        try
+        {
+            tree.Build();
+            while (!tree.IsEmpty())
+            {
+                const SizeTypeAlias winner = tree.GetWinner();
+                NodeBaseAlias* node = heads[winner];
+                tail->PointerNext = node;
+                node->PointerPrev = tail;
+                tail = node;
+                heads[winner] = node->PointerNext;
+                if (heads[winner] != nullptr)
+                {
+                    tree.ReplaceTop(heads[winner]);
+                }
+                else
+                {
+                    tree.PopTop();
+                }
+            }
+        }
+        catch (...)
+        {
+            for (SizeTypeAlias i = 0; i < count; ++i)
+            {
+                for (NodeBaseAlias* node = heads[i]; node != nullptr; node = node->PointerNext)
+                {
+                    tail->PointerNext = node;
+                    node->PointerPrev = tail;
+                    tail = node;
+                }
+            }
+            tail->PointerNext = nullptr;
+            this->LinkedListCore.NodeTail = tail;
+            throw;
+        }
+        tail->PointerNext = nullptr;
+        this->LinkedListCore.NodeTail = tail;
+    }
+
     void MoveAssignInternal(DList&& list, std::true_type)
     {
         this->Clear();
-        this->InsertAfter(this->GetConstBeginFromHead(), list.GetBegin(), list.GetEnd());
+        this->LinkedListCore.NodeHead = std::move(list.LinkedListCore.NodeHead);
+        this->TakeTailInternal(list);
     }
 
     void MoveAssignInternal(DList&& list, std::false_type)
@@ -844,7 +1441,11 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
 
         if (beginNode != endNode)
         {
-            temp->TransferAfter(beginNode, endNode);
+            if (this->LinkedListCore.NodeTail == temp)
+            {
+                this->LinkedListCore.NodeTail = endNode;
+            }
+            return IteratorAlias(temp->TransferAfter(beginNode, endNode));
         }
         else
         {
@@ -855,8 +1456,9 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
     // Zone of DSA
 
   public:
-    template <typename TCompare> void BubbleSort(TCompare compare)
+    template <typename TCompare> void BubbleSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         // Bubble Sort for doubly linked list, inplace sorting
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -880,13 +1482,15 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
             }
             if (!isSwapped)
             {
+                this->ResetTailInternal(curr);
                 break;
             }
         }
     }
 
-    template <typename TCompare> void SelectionSort(TCompare compare)
+    template <typename TCompare> void SelectionSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         // Selection Sort for doubly linked list, inplace sorting
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -918,10 +1522,12 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
                 curr = curr->PointerNext;
             }
         }
+        this->ResetTailInternal(curr);
     }
 
-    template <typename TCompare> void InsertionSort(TCompare compare)
+    template <typename TCompare> void InsertionSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         // Insertion Sort for doubly linked list, inplace sorting
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -934,16 +1540,19 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         while (sorted->PointerNext)
         {
             bool isInserted = false;
-            for (NodeBaseAlias* temp = &this->LinkedListCore.NodeHead; temp->PointerNext != sorted;
-                 temp = temp->PointerNext)
+            // sorted ends the sorted prefix, so a node not less than it is already in place
+            if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(), *static_cast<NodeAlias*>(sorted)->GetData()))
             {
-                if (compare(*static_cast<NodeAlias*>(temp->PointerNext)->GetData(),
-                            *static_cast<NodeAlias*>(unsorted)->GetData()))
+                for (NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;; temp = temp->PointerNext)
                 {
-                    temp->TransferAfter(sorted, unsorted);
-                    unsorted = sorted->PointerNext;
-                    isInserted = true;
-                    break;
+                    if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(),
+                                *static_cast<NodeAlias*>(temp->PointerNext)->GetData()))
+                    {
+                        temp->TransferAfter(sorted, unsorted);
+                        unsorted = sorted->PointerNext;
+                        isInserted = true;
+                        break;
+                    }
                 }
             }
 
@@ -953,10 +1562,12 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
                 unsorted = sorted->PointerNext;
             }
         }
+        this->ResetTailInternal(sorted);
     }
 
-    template <typename TCompare> void HeapSort(TCompare compare)
+    template <typename TCompare> void HeapSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         // Heap Sort for doubly linked list
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -980,8 +1591,9 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         }
     }
 
-    template <typename TCompare> void QuickSort(TCompare compare)
+    template <typename TCompare> void QuickSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         // Quick Sort for doubly linked list
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -991,8 +1603,18 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         QuickSortHelper(compare, this->GetBegin(), this->GetEnd());
     }
 
-    template <typename TCompare> void DSASort(unsigned choice, TCompare compare)
+    /**
+     * @brief Sort with the strategy that suits the input; see Utilities::AdaptiveSortList. Not stable.
+     * @return The strategy used.
+     */
+    template <typename TCompare> Utilities::SortStrategy AdaptiveSort(TCompare userCompare)
     {
+        return Utilities::AdaptiveSortList(*this, userCompare, Utilities::InstrumentCompare<DList>(userCompare));
+    }
+
+    template <typename TCompare> void DSASort(unsigned choice, TCompare userCompare)
+    {
+        auto compare = Utilities::InstrumentCompare<DList>(userCompare);
         switch (choice)
         {
         case 1:
@@ -1010,6 +1632,9 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
         case 5:
             this->HeapSort(compare);
             break;
+        case 6:
+            this->AdaptiveSort(userCompare);
+            break;
         default:
             this->Sort(compare);
             break;
@@ -1035,6 +1660,7 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
     template <typename TCompare>
     IteratorAlias PartitionForQuickSortHelper(TCompare compare, IteratorAlias begin, IteratorAlias end)
     {
+        using std::swap;
         IteratorAlias pivot = begin;
         IteratorAlias i = begin;
         IteratorAlias j = begin.PointerNext();
@@ -1044,12 +1670,12 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
             if (compare(*j, *pivot))
             {
                 ++i;
-                std::swap(*i, *j);
+                swap(*i, *j);
             }
             ++j;
         }
 
-        std::swap(*i, *pivot);
+        swap(*i, *pivot);
 
         return i;
     }
@@ -1079,6 +1705,7 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
 
     void SwapForHeapSortHelper(SizeTypeAlias root, SizeTypeAlias left)
     {
+        using std::swap;
         IteratorAlias rootIter = this->GetBegin();
         IteratorAlias leftIter = this->GetBegin();
 
@@ -1092,16 +1719,18 @@ template <typename T, typename Alloc = Allocator<T>> class DList : protected DLi
             ++leftIter;
         }
 
-        std::swap(*rootIter, *leftIter);
+        swap(*rootIter, *leftIter);
     }
 
     IteratorAlias FindForHeapSortHelper(SizeTypeAlias index)
     {
         IteratorAlias iter = this->GetBegin();
-        for (SizeTypeAlias i = 0; i < index && iter != this->GetEnd(); i++)
+        SizeTypeAlias i = 0;
+        for (; i < index && iter != this->GetEnd(); i++)
         {
             ++iter;
         }
+        Utilities::InstrumentationHooks<DList>::OnNodeWalks(i);
         return iter;
     }
 };
@@ -1,6 +1,7 @@
 #ifndef DSA_LIBRARIES_DLIST_NODE_HPP
 #define DSA_LIBRARIES_DLIST_NODE_HPP
 #include "../../Utilities/AlignedBuffer.hpp"
+#include <cstdint>
 #include <cstddef>
 #include <memory>
 #include <utility>
@@ -123,6 +124,8 @@ template <typename T> struct DListNode : public DListNodeBase
 {
     DListNode() = default;
 
+    /** 1-based position in the NodeSlabs slab the node was allocated from; 0 when it was allocated on its own. */
+    std::uint32_t SlabIndex = 0;
     Utilities::AlignedBuffer<T> data;
 
     T *GetData() noexcept
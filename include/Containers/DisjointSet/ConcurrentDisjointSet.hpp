@@ -0,0 +1,167 @@
+#ifndef DSA_LIBRARIES_CONCURRENT_DISJOINT_SET_HPP
+#define DSA_LIBRARIES_CONCURRENT_DISJOINT_SET_HPP
+#include "../Vector/Vector.hpp"
+#include "DisjointSetExceptions.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Lock-free union-find for a fixed number of elements.
+ *
+ * Parents are atomics in one flat Vector. Unite links the root with the smaller id below the root with the larger id
+ * using a CAS, so two threads can never link roots into a cycle; Find halves paths with CAS and simply ignores lost
+ * races, since any successful write still points to an ancestor.
+ *
+ * @tparam Index Unsigned integer type used for element ids.
+ */
+template <typename Index = std::uint32_t> class ConcurrentDisjointSet
+{
+    static_assert(std::is_unsigned_v<Index>, "ConcurrentDisjointSet index type must be an unsigned integer");
+
+  public:
+    using IndexTypeAlias = Index;
+    using SizeTypeAlias = std::size_t;
+
+    // Adaptive alias
+    using size_type = SizeTypeAlias;
+
+  private:
+    Vector<std::atomic<IndexTypeAlias>> _parents;
+    alignas(64) std::atomic<SizeTypeAlias> _setCount;
+
+  public:
+    explicit ConcurrentDisjointSet(SizeTypeAlias size) : _parents(size), _setCount(size)
+    {
+        if (size > static_cast<SizeTypeAlias>(std::numeric_limits<IndexTypeAlias>::max()))
+        {
+            throw DisjointSetIndexOverflowException(__FILE__, __LINE__);
+        }
+        for (SizeTypeAlias element = 0; element < size; ++element)
+        {
+            _parents[element].store(static_cast<IndexTypeAlias>(element), std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentDisjointSet(const ConcurrentDisjointSet &) = delete;
+    ConcurrentDisjointSet &operator=(const ConcurrentDisjointSet &) = delete;
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _parents.GetSize();
+    }
+
+    /**
+     * @brief Number of disjoint sets. Exact once all writers are done.
+     */
+    [[nodiscard]] SizeTypeAlias GetSetCount() const noexcept
+    {
+        return _setCount.load(std::memory_order_relaxed);
+    }
+
+    IndexTypeAlias Find(IndexTypeAlias element)
+    {
+        this->CheckElementInternal(element);
+        return this->FindInternal(element);
+    }
+
+    bool IsSameSet(IndexTypeAlias lhs, IndexTypeAlias rhs)
+    {
+        this->CheckElementInternal(lhs);
+        this->CheckElementInternal(rhs);
+
+        while (true)
+        {
+            lhs = this->FindInternal(lhs);
+            rhs = this->FindInternal(rhs);
+            if (lhs == rhs)
+            {
+                return true;
+            }
+            // lhs may have been linked below another root after we found it
+            if (_parents[lhs].load(std::memory_order_acquire) == lhs)
+            {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @brief Merge the sets containing lhs and rhs.
+     * @return false if they already were in the same set.
+     */
+    bool Unite(IndexTypeAlias lhs, IndexTypeAlias rhs)
+    {
+        this->CheckElementInternal(lhs);
+        this->CheckElementInternal(rhs);
+
+        while (true)
+        {
+            lhs = this->FindInternal(lhs);
+            rhs = this->FindInternal(rhs);
+            if (lhs == rhs)
+            {
+                return false;
+            }
+            if (lhs > rhs)
+            {
+                std::swap(lhs, rhs);
+            }
+
+            IndexTypeAlias expected = lhs;
+            if (_parents[lhs].compare_exchange_strong(expected, rhs, std::memory_order_acq_rel,
+                                                      std::memory_order_acquire))
+            {
+                _setCount.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    template <typename TInputIterator> SizeTypeAlias UniteMany(TInputIterator first, TInputIterator last)
+    {
+        SizeTypeAlias merged = 0;
+        for (; first != last; ++first)
+        {
+            merged += this->Unite(static_cast<IndexTypeAlias>(std::get<0>(*first)),
+                                  static_cast<IndexTypeAlias>(std::get<1>(*first)))
+                          ? 1
+                          : 0;
+        }
+        return merged;
+    }
+
+  protected:
+    void CheckElementInternal(IndexTypeAlias element) const
+    {
+        if (static_cast<SizeTypeAlias>(element) >= _parents.GetSize())
+        {
+            throw DisjointSetOutOfBoundsException(__FILE__, __LINE__);
+        }
+    }
+
+    IndexTypeAlias FindInternal(IndexTypeAlias element) noexcept
+    {
+        while (true)
+        {
+            IndexTypeAlias parent = _parents[element].load(std::memory_order_acquire);
+            if (parent == element)
+            {
+                return element;
+            }
+            const IndexTypeAlias grandParent = _parents[parent].load(std::memory_order_acquire);
+            if (parent != grandParent)
+            {
+                _parents[element].compare_exchange_weak(parent, grandParent, std::memory_order_acq_rel,
+                                                        std::memory_order_relaxed);
+            }
+            element = grandParent;
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_CONCURRENT_DISJOINT_SET_HPP
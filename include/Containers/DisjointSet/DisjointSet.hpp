@@ -0,0 +1,237 @@
+#ifndef DSA_LIBRARIES_DISJOINT_SET_HPP
+#define DSA_LIBRARIES_DISJOINT_SET_HPP
+#include "../Vector/Vector.hpp"
+#include "DisjointSetExceptions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Union-find over the elements [0, GetSize()).
+ *
+ * Parents and ranks live in two flat Vectors, so a Find walks a single contiguous array. Find uses path halving and
+ * Unite links by rank, which keeps every operation effectively constant time.
+ *
+ * @tparam Index Unsigned integer type used for element ids; a narrower type halves the memory traffic.
+ */
+template <typename Index = std::uint32_t> class DisjointSet
+{
+    static_assert(std::is_unsigned_v<Index>, "DisjointSet index type must be an unsigned integer");
+
+  public:
+    using IndexTypeAlias = Index;
+    using RankTypeAlias = std::uint8_t;
+    using SizeTypeAlias = std::size_t;
+
+    // Adaptive alias
+    using size_type = SizeTypeAlias;
+
+    /** Number of pairs UniteMany looks ahead when prefetching parents. */
+    static constexpr SizeTypeAlias PrefetchDistance = 8;
+
+  private:
+    Vector<IndexTypeAlias> _parents;
+    Vector<RankTypeAlias> _ranks;
+    SizeTypeAlias _setCount = 0;
+
+  public:
+    DisjointSet() = default;
+
+    explicit DisjointSet(SizeTypeAlias size) : _parents(size), _ranks(size), _setCount(size)
+    {
+        if (size > static_cast<SizeTypeAlias>(std::numeric_limits<IndexTypeAlias>::max()))
+        {
+            throw DisjointSetIndexOverflowException(__FILE__, __LINE__);
+        }
+        for (SizeTypeAlias element = 0; element < size; ++element)
+        {
+            _parents[element] = static_cast<IndexTypeAlias>(element);
+        }
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _parents.GetSize();
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _parents.IsEmpty();
+    }
+
+    /**
+     * @brief Number of disjoint sets currently represented.
+     */
+    [[nodiscard]] SizeTypeAlias GetSetCount() const noexcept
+    {
+        return _setCount;
+    }
+
+    /**
+     * @brief Append a new singleton set.
+     * @return The id of the new element.
+     */
+    IndexTypeAlias PushBack()
+    {
+        const SizeTypeAlias element = _parents.GetSize();
+        if (element >= static_cast<SizeTypeAlias>(std::numeric_limits<IndexTypeAlias>::max()))
+        {
+            throw DisjointSetIndexOverflowException(__FILE__, __LINE__);
+        }
+        _parents.PushBack(static_cast<IndexTypeAlias>(element));
+        _ranks.PushBack(0);
+        ++_setCount;
+        return static_cast<IndexTypeAlias>(element);
+    }
+
+    /**
+     * @brief Representative of the set containing element.
+     */
+    IndexTypeAlias Find(IndexTypeAlias element)
+    {
+        this->CheckElementInternal(element);
+        return this->FindInternal(element);
+    }
+
+    bool IsSameSet(IndexTypeAlias lhs, IndexTypeAlias rhs)
+    {
+        return this->Find(lhs) == this->Find(rhs);
+    }
+
+    /**
+     * @brief Merge the sets containing lhs and rhs.
+     * @return false if they were already in the same set.
+     */
+    bool Unite(IndexTypeAlias lhs, IndexTypeAlias rhs)
+    {
+        this->CheckElementInternal(lhs);
+        this->CheckElementInternal(rhs);
+        return this->UniteInternal(lhs, rhs);
+    }
+
+    /**
+     * @brief Unite every pair of a range. Elements of upcoming pairs are prefetched, which hides most of the cache
+     * misses when the pairs hit random parts of a large set.
+     * @param first,last Range of pair-like values (std::get<0> / std::get<1>).
+     * @return The number of merges performed.
+     */
+    template <typename TInputIterator> SizeTypeAlias UniteMany(TInputIterator first, TInputIterator last)
+    {
+        using CategoryAlias = typename std::iterator_traits<TInputIterator>::iterator_category;
+        SizeTypeAlias merged = 0;
+
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, CategoryAlias>)
+        {
+            const auto count = static_cast<SizeTypeAlias>(last - first);
+            for (SizeTypeAlias i = 0; i < count; ++i)
+            {
+                if (i + PrefetchDistance < count)
+                {
+                    const auto &ahead = first[i + PrefetchDistance];
+                    this->PrefetchInternal(static_cast<IndexTypeAlias>(std::get<0>(ahead)));
+                    this->PrefetchInternal(static_cast<IndexTypeAlias>(std::get<1>(ahead)));
+                }
+                const auto &pair = first[i];
+                merged += this->Unite(static_cast<IndexTypeAlias>(std::get<0>(pair)),
+                                      static_cast<IndexTypeAlias>(std::get<1>(pair)))
+                              ? 1
+                              : 0;
+            }
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                merged += this->Unite(static_cast<IndexTypeAlias>(std::get<0>(*first)),
+                                      static_cast<IndexTypeAlias>(std::get<1>(*first)))
+                              ? 1
+                              : 0;
+            }
+        }
+
+        return merged;
+    }
+
+    /**
+     * @brief Compress every path fully, so that afterwards parent[i] is the representative of i.
+     */
+    void Flatten() noexcept
+    {
+        for (SizeTypeAlias element = 0; element < _parents.GetSize(); ++element)
+        {
+            _parents[element] = this->FindInternal(static_cast<IndexTypeAlias>(element));
+        }
+    }
+
+    void Clear() noexcept
+    {
+        _parents.Clear();
+        _ranks.Clear();
+        _setCount = 0;
+    }
+
+    void Swap(DisjointSet &other) noexcept
+    {
+        _parents.Swap(other._parents);
+        _ranks.Swap(other._ranks);
+        std::swap(_setCount, other._setCount);
+    }
+
+  protected:
+    void CheckElementInternal(IndexTypeAlias element) const
+    {
+        if (static_cast<SizeTypeAlias>(element) >= _parents.GetSize())
+        {
+            throw DisjointSetOutOfBoundsException(__FILE__, __LINE__);
+        }
+    }
+
+    IndexTypeAlias FindInternal(IndexTypeAlias element) noexcept
+    {
+        IndexTypeAlias *const parents = _parents.GetData();
+        while (parents[element] != element)
+        {
+            parents[element] = parents[parents[element]];
+            element = parents[element];
+        }
+        return element;
+    }
+
+    bool UniteInternal(IndexTypeAlias lhs, IndexTypeAlias rhs) noexcept
+    {
+        lhs = this->FindInternal(lhs);
+        rhs = this->FindInternal(rhs);
+        if (lhs == rhs)
+        {
+            return false;
+        }
+
+        if (_ranks[lhs] < _ranks[rhs])
+        {
+            std::swap(lhs, rhs);
+        }
+        _parents[rhs] = lhs;
+        if (_ranks[lhs] == _ranks[rhs])
+        {
+            ++_ranks[lhs];
+        }
+        --_setCount;
+        return true;
+    }
+
+    void PrefetchInternal([[maybe_unused]] IndexTypeAlias element) const noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if (static_cast<SizeTypeAlias>(element) < _parents.GetSize())
+        {
+            __builtin_prefetch(_parents.GetData() + element);
+        }
+#endif
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_DISJOINT_SET_HPP
@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_DISJOINT_SET_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_DISJOINT_SET_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class DisjointSetException : public Utilities::Exception
+{
+  public:
+    DisjointSetException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class DisjointSetOutOfBoundsException : public DisjointSetException
+{
+  public:
+    DisjointSetOutOfBoundsException(string_type fileText, numeric_type line)
+        : DisjointSetException("Element out of bounds", std::move(fileText), line)
+    {
+    }
+};
+class DisjointSetIndexOverflowException : public DisjointSetException
+{
+  public:
+    DisjointSetIndexOverflowException(string_type fileText, numeric_type line)
+        : DisjointSetException("Element count does not fit the index type", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
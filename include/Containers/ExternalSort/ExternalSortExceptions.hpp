@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_EXTERNAL_SORT_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_EXTERNAL_SORT_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class ExternalSortException : public Utilities::Exception
+{
+  public:
+    ExternalSortException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class ExternalSortInvalidBudgetException : public ExternalSortException
+{
+  public:
+    ExternalSortInvalidBudgetException(string_type fileText, numeric_type line)
+        : ExternalSortException("Memory budget must hold a few records per thread", std::move(fileText), line)
+    {
+    }
+};
+class ExternalSortIOException : public ExternalSortException
+{
+  public:
+    ExternalSortIOException(string_type fileText, numeric_type line)
+        : ExternalSortException("Failed to create, write or read a run file", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,417 @@
+#ifndef DSA_LIBRARIES_EXTERNAL_SORTER_HPP
+#define DSA_LIBRARIES_EXTERNAL_SORTER_HPP
+#include "../../Utilities/Sort.hpp"
+#include "../LoserTree/LoserTree.hpp"
+#include "../Vector/Vector.hpp"
+#include "ExternalSortExceptions.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Sorts more records than fit in memory.
+ *
+ * Pushed records fill a Vector up to the memory budget; a full chunk is sorted with Utilities::AdaptiveSortRange and
+ * written to a run file in one sequential write. Merge then streams the runs through a LoserTree, reading each in
+ * large blocks, and hands the records to a sink in order. With more runs than the fan-in, groups of runs are first
+ * merged into longer runs so that the number of open files stays bounded.
+ *
+ * With threadCount > 1 full chunks are sorted and written on background threads while the caller fills the next one;
+ * the budget is split between the chunks in flight. Run files live in the given directory and are removed by Merge or
+ * the destructor.
+ *
+ * @tparam T Trivially copyable; records are written to disk as raw bytes.
+ */
+template <typename T, typename TCompare = std::less<T>> class ExternalSorter
+{
+    static_assert(std::is_trivially_copyable_v<T>, "ExternalSorter writes records as raw bytes");
+
+  public:
+    using ValueTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using CompareAlias = TCompare;
+    using PathAlias = std::filesystem::path;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+
+    static constexpr SizeTypeAlias DefaultFanIn = 128;
+
+  private:
+    /** Reads a run front to back in blocks. */
+    class RunReader
+    {
+      private:
+        std::FILE *_file = nullptr;
+        Vector<T> _block;
+        SizeTypeAlias _position = 0;
+        SizeTypeAlias _filled = 0;
+
+      public:
+        RunReader(const PathAlias &path, SizeTypeAlias blockRecords) : _block(blockRecords)
+        {
+            _file = std::fopen(path.string().c_str(), "rb");
+            if (_file == nullptr)
+            {
+                throw ExternalSortIOException(__FILE__, __LINE__);
+            }
+        }
+
+        RunReader(const RunReader &) = delete;
+        RunReader &operator=(const RunReader &) = delete;
+
+        ~RunReader()
+        {
+            std::fclose(_file);
+        }
+
+        bool Next(T &value)
+        {
+            if (_position == _filled)
+            {
+                _filled = std::fread(_block.GetData(), sizeof(T), _block.GetSize(), _file);
+                _position = 0;
+                if (_filled == 0)
+                {
+                    if (std::ferror(_file))
+                    {
+                        throw ExternalSortIOException(__FILE__, __LINE__);
+                    }
+                    return false;
+                }
+            }
+            value = _block[_position++];
+            return true;
+        }
+    };
+
+    /** Appends records to a new run in blocks. */
+    class RunWriter
+    {
+      private:
+        std::FILE *_file;
+        Vector<T> _block;
+
+      public:
+        RunWriter(std::FILE *file, SizeTypeAlias blockRecords) : _file(file)
+        {
+            _block.Reverse(blockRecords);
+        }
+
+        RunWriter(const RunWriter &) = delete;
+        RunWriter &operator=(const RunWriter &) = delete;
+
+        ~RunWriter()
+        {
+            if (_file)
+            {
+                std::fclose(_file);
+            }
+        }
+
+        void Write(const T &value)
+        {
+            _block.PushBack(value);
+            if (_block.GetSize() == _block.GetCapacity())
+            {
+                this->FlushInternal();
+            }
+        }
+
+        void Close()
+        {
+            this->FlushInternal();
+            const int result = std::fclose(_file);
+            _file = nullptr;
+            if (result != 0)
+            {
+                throw ExternalSortIOException(__FILE__, __LINE__);
+            }
+        }
+
+      private:
+        void FlushInternal()
+        {
+            if (std::fwrite(_block.GetData(), sizeof(T), _block.GetSize(), _file) != _block.GetSize())
+            {
+                throw ExternalSortIOException(__FILE__, __LINE__);
+            }
+            _block.Clear();
+        }
+    };
+
+    SizeTypeAlias _memoryBudget;
+    SizeTypeAlias _chunkCapacity;
+    SizeTypeAlias _threadCount;
+    SizeTypeAlias _fanIn = DefaultFanIn;
+    PathAlias _directory;
+    CompareAlias _compare;
+
+    Vector<T> _chunk;
+    Vector<PathAlias> _runs;
+    Vector<std::future<void>> _pending;
+    SizeTypeAlias _spillCount = 0;
+    SizeTypeAlias _size = 0;
+    std::uint64_t _id;
+
+  public:
+    /**
+     * @param memoryBudget Bytes of records held in memory at once, across all threads.
+     * @param directory Where run files are created; local disk.
+     * @param threadCount Chunks sorted and written concurrently; 1 spills on the calling thread.
+     */
+    explicit ExternalSorter(SizeTypeAlias memoryBudget,
+                            PathAlias directory = std::filesystem::temp_directory_path(),
+                            const CompareAlias &compare = CompareAlias(), SizeTypeAlias threadCount = 1)
+        : _memoryBudget(memoryBudget), _threadCount(threadCount > 0 ? threadCount : 1),
+          _directory(std::move(directory)), _compare(compare), _id(NextIdInternal())
+    {
+        _chunkCapacity = memoryBudget / sizeof(T) / _threadCount;
+        if (_chunkCapacity < 2)
+        {
+            throw ExternalSortInvalidBudgetException(__FILE__, __LINE__);
+        }
+        _chunk.Reverse(_chunkCapacity);
+        for (SizeTypeAlias i = 1; i < _threadCount; ++i)
+        {
+            _pending.EmplaceBack();
+        }
+    }
+
+    ExternalSorter(const ExternalSorter &) = delete;
+    ExternalSorter &operator=(const ExternalSorter &) = delete;
+
+    ~ExternalSorter()
+    {
+        for (SizeTypeAlias i = 0; i < _pending.GetSize(); ++i)
+        {
+            if (_pending[i].valid())
+            {
+                _pending[i].wait();
+            }
+        }
+        this->RemoveRunsInternal(0, _runs.GetSize());
+    }
+
+    /** Records pushed since the last Merge. */
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    /** Runs spilled to disk since the last Merge. */
+    [[nodiscard]] SizeTypeAlias GetRunCount() const noexcept
+    {
+        return _runs.GetSize();
+    }
+
+    /**
+     * @brief Most runs merged in one pass, and so most files open at once. At least 2.
+     */
+    void SetFanIn(SizeTypeAlias fanIn) noexcept
+    {
+        _fanIn = fanIn > 2 ? fanIn : 2;
+    }
+
+    void Push(const ValueTypeAlias &value)
+    {
+        _chunk.PushBack(value);
+        ++_size;
+        if (_chunk.GetSize() == _chunkCapacity)
+        {
+            this->SpillInternal();
+        }
+    }
+
+    template <typename TInputIterator> void PushRange(TInputIterator first, TInputIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            this->Push(*first);
+        }
+    }
+
+    /**
+     * @brief Call sink(const T &) for every record pushed, in order, then start over empty.
+     */
+    template <typename TSink> void Merge(TSink sink)
+    {
+        if (_runs.IsEmpty())
+        {
+            Utilities::AdaptiveSortRange(_chunk.GetBegin(), _chunk.GetEnd(), _compare);
+            for (SizeTypeAlias i = 0; i < _chunk.GetSize(); ++i)
+            {
+                sink(static_cast<const T &>(_chunk[i]));
+            }
+            _chunk.Clear();
+            _size = 0;
+            return;
+        }
+
+        if (!_chunk.IsEmpty())
+        {
+            this->SpillInternal();
+        }
+        for (SizeTypeAlias i = 0; i < _pending.GetSize(); ++i)
+        {
+            if (_pending[i].valid())
+            {
+                _pending[i].get();
+            }
+        }
+        // The chunk memory now serves the read blocks.
+        Vector<T>().Swap(_chunk);
+
+        SizeTypeAlias first = 0;
+        while (_runs.GetSize() - first > _fanIn)
+        {
+            std::FILE *file = nullptr;
+            PathAlias path = this->CreateRunInternal(file);
+            RunWriter writer(file, this->GetBlockRecordsInternal());
+            this->MergeRunsInternal(first, first + _fanIn, [&writer](const T &value) { writer.Write(value); });
+            writer.Close();
+            _runs.PushBack(std::move(path));
+            this->RemoveRunsInternal(first, first + _fanIn);
+            first += _fanIn;
+        }
+        this->MergeRunsInternal(first, _runs.GetSize(), sink);
+        this->RemoveRunsInternal(first, _runs.GetSize());
+
+        _runs.Clear();
+        _size = 0;
+        _chunk.Reverse(_chunkCapacity);
+    }
+
+  private:
+    static std::uint64_t NextIdInternal() noexcept
+    {
+        static std::atomic<std::uint64_t> counter{0};
+        const auto now = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        return (now << 16) ^ counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    SizeTypeAlias GetBlockRecordsInternal() const noexcept
+    {
+        // Split the budget between the readers of a pass and one writer, but keep blocks large enough to read
+        // sequentially.
+        const SizeTypeAlias blockBytes = _memoryBudget / (_fanIn + 1);
+        const SizeTypeAlias minimumBytes = 64 * 1024;
+        const SizeTypeAlias bytes = blockBytes > minimumBytes ? blockBytes : minimumBytes;
+        return bytes / sizeof(T) > 0 ? bytes / sizeof(T) : 1;
+    }
+
+    /**
+     * @brief Create a new, empty run file; "x" fails on an existing name, so concurrent sorters cannot collide.
+     */
+    PathAlias CreateRunInternal(std::FILE *&file)
+    {
+        while (true)
+        {
+            PathAlias path = _directory / ("dsa-external-sort-" + std::to_string(_id) + "-" +
+                                           std::to_string(_spillCount++) + ".run");
+            file = std::fopen(path.string().c_str(), "wbx");
+            if (file)
+            {
+                return path;
+            }
+            std::error_code error;
+            if (!std::filesystem::exists(path, error))
+            {
+                throw ExternalSortIOException(__FILE__, __LINE__);
+            }
+        }
+    }
+
+    static void SortAndWriteInternal(Vector<T> &chunk, std::FILE *file, const CompareAlias &compare)
+    {
+        Utilities::AdaptiveSortRange(chunk.GetBegin(), chunk.GetEnd(), compare);
+        const bool isWritten = std::fwrite(chunk.GetData(), sizeof(T), chunk.GetSize(), file) == chunk.GetSize();
+        if (std::fclose(file) != 0 || !isWritten)
+        {
+            throw ExternalSortIOException(__FILE__, __LINE__);
+        }
+    }
+
+    void SpillInternal()
+    {
+        if (_threadCount == 1)
+        {
+            std::FILE *file = nullptr;
+            _runs.PushBack(this->CreateRunInternal(file));
+            SortAndWriteInternal(_chunk, file, _compare);
+            _chunk.Clear();
+            return;
+        }
+
+        // Wait for the oldest chunk in flight, so at most threadCount chunks are alive with the one being filled.
+        std::future<void> &slot = _pending[_runs.GetSize() % _pending.GetSize()];
+        if (slot.valid())
+        {
+            slot.get();
+        }
+        std::FILE *file = nullptr;
+        _runs.PushBack(this->CreateRunInternal(file));
+        slot = std::async(std::launch::async,
+                          [chunk = std::move(_chunk), file, compare = _compare]() mutable {
+                              SortAndWriteInternal(chunk, file, compare);
+                          });
+        _chunk = Vector<T>();
+        _chunk.Reverse(_chunkCapacity);
+    }
+
+    template <typename TSink> void MergeRunsInternal(SizeTypeAlias first, SizeTypeAlias last, TSink &&sink)
+    {
+        const SizeTypeAlias count = last - first;
+        const SizeTypeAlias blockRecords = this->GetBlockRecordsInternal();
+        Vector<std::unique_ptr<RunReader>> readers;
+        readers.Reverse(count);
+        LoserTree<T, TCompare> tree(count, _compare);
+        T value;
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            readers.PushBack(std::make_unique<RunReader>(_runs[first + i], blockRecords));
+            if (readers[i]->Next(value))
+            {
+                tree.SetSource(i, value);
+            }
+        }
+        tree.Build();
+
+        while (!tree.IsEmpty())
+        {
+            const SizeTypeAlias winner = tree.GetWinner();
+            sink(tree.GetTop());
+            if (readers[winner]->Next(value))
+            {
+                tree.ReplaceTop(value);
+            }
+            else
+            {
+                tree.PopTop();
+            }
+        }
+    }
+
+    void RemoveRunsInternal(SizeTypeAlias first, SizeTypeAlias last) noexcept
+    {
+        for (SizeTypeAlias i = first; i < last; ++i)
+        {
+            std::error_code error;
+            std::filesystem::remove(_runs[i], error);
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_EXTERNAL_SORTER_HPP
@@ -0,0 +1,586 @@
+#ifndef DSA_LIBRARIES_CSR_GRAPH_HPP
+#define DSA_LIBRARIES_CSR_GRAPH_HPP
+#include "../Bitset/DynamicBitset.hpp"
+#include "../PriorityQueue/PriorityQueue.hpp"
+#include "../Stack/Stack.hpp"
+#include "../Vector/Vector.hpp"
+#include "GraphExceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Edge from Source to Target, the input of a CsrGraph.
+ */
+template <typename Weight = std::uint32_t> struct GraphEdge
+{
+    std::uint32_t Source;
+    std::uint32_t Target;
+    Weight EdgeWeight = Weight(1);
+};
+
+/**
+ * @brief Immutable graph in compressed sparse row form.
+ *
+ * The out-edges of vertex v are the slots [offsets[v], offsets[v + 1]) of two flat arrays, targets and weights, so a
+ * traversal streams through contiguous memory instead of chasing adjacency-list nodes. The arrays are filled with a
+ * counting sort over the edge list, which is linear and keeps the input order of the edges of each vertex.
+ *
+ * Directed graphs also keep the transpose, which the bottom-up steps of BreadthFirstDistances scan; an undirected
+ * graph stores every edge in both directions and is its own transpose.
+ *
+ * @tparam Weight Arithmetic edge weight type.
+ */
+template <typename Weight = std::uint32_t> class CsrGraph
+{
+    static_assert(std::is_arithmetic_v<Weight>, "CsrGraph weight type must be arithmetic");
+
+  public:
+    using VertexTypeAlias = std::uint32_t;
+    using WeightTypeAlias = Weight;
+    using SizeTypeAlias = std::size_t;
+    using EdgeTypeAlias = GraphEdge<Weight>;
+
+    // Adaptive alias
+    using size_type = SizeTypeAlias;
+
+    /** Distance of the vertices a breadth-first search does not reach. */
+    static constexpr VertexTypeAlias Unreached = std::numeric_limits<VertexTypeAlias>::max();
+
+    /** Distance of the vertices a shortest-path search does not reach. */
+    static constexpr WeightTypeAlias Infinity = std::numeric_limits<Weight>::has_infinity
+                                                    ? std::numeric_limits<Weight>::infinity()
+                                                    : std::numeric_limits<Weight>::max();
+
+    /** Switch to bottom-up once the frontier has more than 1 / Alpha of the unexplored edges. */
+    static constexpr SizeTypeAlias Alpha = 15;
+
+    /** Switch back to top-down once the frontier has fewer than 1 / Beta of the vertices and is shrinking. */
+    static constexpr SizeTypeAlias Beta = 18;
+
+  private:
+    /** Frontier vertices a parallel breadth-first worker buffers before publishing them. */
+    static constexpr SizeTypeAlias LocalFrontierSize = 256;
+
+    /** Frontier vertices a parallel breadth-first worker claims at a time. */
+    static constexpr SizeTypeAlias FrontierChunkSize = 64;
+
+    Vector<SizeTypeAlias> _offsets;
+    Vector<VertexTypeAlias> _targets;
+    Vector<WeightTypeAlias> _weights;
+    Vector<SizeTypeAlias> _reverseOffsets;
+    Vector<VertexTypeAlias> _reverseSources;
+    bool _isDirected = true;
+    bool _hasNegativeWeight = false;
+
+  public:
+    CsrGraph() = default;
+
+    /**
+     * @param vertexCount Number of vertices; edges refer to them as [0, vertexCount).
+     * @param edges Edge list, in any order.
+     * @param isDirected When false, every edge is stored in both directions.
+     */
+    CsrGraph(SizeTypeAlias vertexCount, const Vector<EdgeTypeAlias> &edges, bool isDirected = true)
+        : _isDirected(isDirected)
+    {
+        if (vertexCount >= static_cast<SizeTypeAlias>(Unreached))
+        {
+            throw GraphVertexOverflowException(__FILE__, __LINE__);
+        }
+        for (SizeTypeAlias i = 0; i < edges.GetSize(); ++i)
+        {
+            if (edges[i].Source >= vertexCount || edges[i].Target >= vertexCount)
+            {
+                throw GraphVertexOutOfBoundsException(__FILE__, __LINE__);
+            }
+            if constexpr (std::is_signed_v<Weight>)
+            {
+                _hasNegativeWeight = _hasNegativeWeight || edges[i].EdgeWeight < Weight(0);
+            }
+        }
+
+        this->BuildInternal(vertexCount, edges, false, _offsets, _targets, &_weights);
+        if (_isDirected)
+        {
+            this->BuildInternal(vertexCount, edges, true, _reverseOffsets, _reverseSources, nullptr);
+        }
+    }
+
+    [[nodiscard]] SizeTypeAlias GetVertexCount() const noexcept
+    {
+        return _offsets.IsEmpty() ? 0 : _offsets.GetSize() - 1;
+    }
+
+    /**
+     * @brief Number of stored edges; an undirected edge between two distinct vertices counts twice.
+     */
+    [[nodiscard]] SizeTypeAlias GetEdgeCount() const noexcept
+    {
+        return _targets.GetSize();
+    }
+
+    [[nodiscard]] bool IsDirected() const noexcept
+    {
+        return _isDirected;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return this->GetVertexCount() == 0;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetDegree(VertexTypeAlias vertex) const
+    {
+        this->CheckVertexInternal(vertex);
+        return _offsets[vertex + 1] - _offsets[vertex];
+    }
+
+    [[nodiscard]] const VertexTypeAlias *GetNeighborBegin(VertexTypeAlias vertex) const
+    {
+        this->CheckVertexInternal(vertex);
+        return _targets.GetData() + _offsets[vertex];
+    }
+
+    [[nodiscard]] const VertexTypeAlias *GetNeighborEnd(VertexTypeAlias vertex) const
+    {
+        this->CheckVertexInternal(vertex);
+        return _targets.GetData() + _offsets[vertex + 1];
+    }
+
+    /**
+     * @brief Weights of the out-edges of vertex, parallel to GetNeighborBegin.
+     */
+    [[nodiscard]] const WeightTypeAlias *GetWeightBegin(VertexTypeAlias vertex) const
+    {
+        this->CheckVertexInternal(vertex);
+        return _weights.GetData() + _offsets[vertex];
+    }
+
+    [[nodiscard]] const Vector<SizeTypeAlias> &GetOffsets() const noexcept
+    {
+        return _offsets;
+    }
+
+    [[nodiscard]] const Vector<VertexTypeAlias> &GetTargets() const noexcept
+    {
+        return _targets;
+    }
+
+    [[nodiscard]] const Vector<WeightTypeAlias> &GetWeights() const noexcept
+    {
+        return _weights;
+    }
+
+    /**
+     * @brief Hop count from source to every vertex, Unreached where there is no path.
+     *
+     * Direction-optimizing search: small frontiers expand top-down over their out-edges, while large frontiers are
+     * handled bottom-up, where every unvisited vertex scans its in-edges and stops at the first parent found in the
+     * frontier bitset. On low-diameter graphs this skips most of the edges a plain breadth-first search would touch.
+     */
+    [[nodiscard]] Vector<VertexTypeAlias> BreadthFirstDistances(VertexTypeAlias source) const
+    {
+        this->CheckVertexInternal(source);
+
+        const SizeTypeAlias vertexCount = this->GetVertexCount();
+        Vector<VertexTypeAlias> distances(vertexCount, Unreached);
+        Vector<VertexTypeAlias> frontier;
+        Vector<VertexTypeAlias> next;
+        frontier.Reverse(vertexCount);
+        next.Reverse(vertexCount);
+        DynamicBitset<> frontierBits;
+        DynamicBitset<> nextBits;
+
+        distances[source] = 0;
+        frontier.PushBack(source);
+
+        SizeTypeAlias edgesToCheck = this->GetEdgeCount();
+        SizeTypeAlias scoutCount = _offsets[source + 1] - _offsets[source];
+        VertexTypeAlias depth = 0;
+
+        while (!frontier.IsEmpty())
+        {
+            if (scoutCount > edgesToCheck / Alpha)
+            {
+                if (frontierBits.GetSize() != vertexCount)
+                {
+                    frontierBits.Resize(vertexCount);
+                    nextBits.Resize(vertexCount);
+                }
+                frontierBits.Reset();
+                for (SizeTypeAlias i = 0; i < frontier.GetSize(); ++i)
+                {
+                    frontierBits.Set(frontier[i]);
+                }
+
+                DynamicBitset<> *current = &frontierBits;
+                DynamicBitset<> *upcoming = &nextBits;
+                SizeTypeAlias awakeCount = frontier.GetSize();
+                SizeTypeAlias previousAwakeCount;
+                do
+                {
+                    previousAwakeCount = awakeCount;
+                    upcoming->Reset();
+                    awakeCount = this->BottomUpStepInternal(distances, *current, *upcoming, depth + 1);
+                    std::swap(current, upcoming);
+                    ++depth;
+                } while (awakeCount >= previousAwakeCount || awakeCount > vertexCount / Beta);
+
+                frontier.Clear();
+                for (SizeTypeAlias vertex = current->FindFirst(); vertex < vertexCount;
+                     vertex = current->FindNext(vertex))
+                {
+                    frontier.PushBack(static_cast<VertexTypeAlias>(vertex));
+                }
+                scoutCount = 1;
+            }
+            else
+            {
+                edgesToCheck -= std::min(scoutCount, edgesToCheck);
+                next.Clear();
+                scoutCount = this->TopDownStepInternal(distances, frontier, next, depth + 1);
+                frontier.Swap(next);
+                ++depth;
+            }
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Same result as BreadthFirstDistances, computed level by level on several threads.
+     *
+     * Workers claim chunks of the frontier, claim undiscovered neighbors with a CAS on their distance, and collect them
+     * in a small local buffer that is published to the next frontier with a single fetch_add per batch. All buffers
+     * are allocated up front, so nothing allocates while the workers run.
+     *
+     * @param threadCount Number of threads including the caller; 0 uses std::thread::hardware_concurrency.
+     */
+    [[nodiscard]] Vector<VertexTypeAlias> ParallelBreadthFirstDistances(VertexTypeAlias source,
+                                                                        SizeTypeAlias threadCount = 0) const
+    {
+        this->CheckVertexInternal(source);
+        if (threadCount == 0)
+        {
+            threadCount = std::max<SizeTypeAlias>(1, std::thread::hardware_concurrency());
+        }
+
+        const SizeTypeAlias vertexCount = this->GetVertexCount();
+        Vector<VertexTypeAlias> distances(vertexCount, Unreached);
+        Vector<VertexTypeAlias> frontier(vertexCount);
+        Vector<VertexTypeAlias> next(vertexCount);
+
+        VertexTypeAlias *const distanceData = distances.GetData();
+        const SizeTypeAlias *const offsets = _offsets.GetData();
+        const VertexTypeAlias *const targets = _targets.GetData();
+
+        VertexTypeAlias *frontierData = frontier.GetData();
+        VertexTypeAlias *nextData = next.GetData();
+        SizeTypeAlias frontierSize = 1;
+        VertexTypeAlias depth = 0;
+        bool isDone = false;
+        std::atomic<SizeTypeAlias> cursor{0};
+        std::atomic<SizeTypeAlias> nextSize{0};
+
+        distanceData[source] = 0;
+        frontierData[0] = source;
+
+        auto onLevelEnd = [&]() noexcept {
+            std::swap(frontierData, nextData);
+            frontierSize = nextSize.load(std::memory_order_relaxed);
+            nextSize.store(0, std::memory_order_relaxed);
+            cursor.store(0, std::memory_order_relaxed);
+            ++depth;
+            isDone = frontierSize == 0;
+        };
+        std::barrier levelBarrier(static_cast<std::ptrdiff_t>(threadCount), onLevelEnd);
+
+        auto worker = [&]() noexcept {
+            std::array<VertexTypeAlias, LocalFrontierSize> buffer;
+            SizeTypeAlias buffered = 0;
+            auto flush = [&]() noexcept {
+                const SizeTypeAlias position = nextSize.fetch_add(buffered, std::memory_order_relaxed);
+                std::copy(buffer.data(), buffer.data() + buffered, nextData + position);
+                buffered = 0;
+            };
+
+            while (!isDone)
+            {
+                const VertexTypeAlias nextDepth = depth + 1;
+                while (true)
+                {
+                    const SizeTypeAlias begin = cursor.fetch_add(FrontierChunkSize, std::memory_order_relaxed);
+                    if (begin >= frontierSize)
+                    {
+                        break;
+                    }
+                    const SizeTypeAlias end = std::min(begin + FrontierChunkSize, frontierSize);
+                    for (SizeTypeAlias i = begin; i < end; ++i)
+                    {
+                        const VertexTypeAlias vertex = frontierData[i];
+                        for (SizeTypeAlias edge = offsets[vertex]; edge < offsets[vertex + 1]; ++edge)
+                        {
+                            std::atomic_ref<VertexTypeAlias> distance(distanceData[targets[edge]]);
+                            VertexTypeAlias expected = Unreached;
+                            if (distance.load(std::memory_order_relaxed) == Unreached &&
+                                distance.compare_exchange_strong(expected, nextDepth, std::memory_order_relaxed))
+                            {
+                                buffer[buffered++] = targets[edge];
+                                if (buffered == LocalFrontierSize)
+                                {
+                                    flush();
+                                }
+                            }
+                        }
+                    }
+                }
+                flush();
+                levelBarrier.arrive_and_wait();
+            }
+        };
+
+        Vector<std::thread> workers;
+        workers.Reverse(threadCount - 1);
+        for (SizeTypeAlias i = 0; i + 1 < threadCount; ++i)
+        {
+            try
+            {
+                workers.EmplaceBack(worker);
+            }
+            catch (...)
+            {
+                // Run with the threads we got; the missing ones leave the barrier for good.
+                for (SizeTypeAlias missing = i; missing + 1 < threadCount; ++missing)
+                {
+                    levelBarrier.arrive_and_drop();
+                }
+                break;
+            }
+        }
+        worker();
+        for (SizeTypeAlias i = 0; i < workers.GetSize(); ++i)
+        {
+            workers[i].join();
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Vertices reachable from source in depth-first preorder, following out-edges in stored order.
+     *
+     * Iterative: each BoundedStack entry holds a vertex and the next edge slot to try, so the search uses no recursion
+     * and its stack is allocated once with room for every vertex.
+     */
+    [[nodiscard]] Vector<VertexTypeAlias> DepthFirstOrder(VertexTypeAlias source) const
+    {
+        this->CheckVertexInternal(source);
+
+        const SizeTypeAlias vertexCount = this->GetVertexCount();
+        Vector<VertexTypeAlias> order;
+        order.Reverse(vertexCount);
+        DynamicBitset<> visited(vertexCount);
+        BoundedStack<std::pair<VertexTypeAlias, SizeTypeAlias>> stack(vertexCount);
+
+        visited.Set(source);
+        order.PushBack(source);
+        stack.Emplace(source, _offsets[source]);
+
+        while (!stack.IsEmpty())
+        {
+            auto &[vertex, edge] = stack.Top();
+            const SizeTypeAlias end = _offsets[vertex + 1];
+            while (edge < end && visited[_targets[edge]])
+            {
+                ++edge;
+            }
+            if (edge == end)
+            {
+                stack.Pop();
+                continue;
+            }
+
+            const VertexTypeAlias child = _targets[edge++];
+            visited.Set(child);
+            order.PushBack(child);
+            stack.Emplace(child, _offsets[child]);
+        }
+
+        return order;
+    }
+
+    /**
+     * @brief Dijkstra's shortest-path distances from source, Infinity where there is no path.
+     *
+     * Uses a PriorityQueue of (distance, vertex) with lazy deletion: a vertex is pushed again whenever its distance
+     * improves and stale entries are skipped when popped, which is cheaper than a decrease-key heap in practice.
+     */
+    [[nodiscard]] Vector<WeightTypeAlias> DijkstraDistances(VertexTypeAlias source) const
+    {
+        this->CheckVertexInternal(source);
+        if (_hasNegativeWeight)
+        {
+            throw GraphNegativeWeightException(__FILE__, __LINE__);
+        }
+
+        using EntryAlias = std::pair<WeightTypeAlias, VertexTypeAlias>;
+
+        Vector<WeightTypeAlias> distances(this->GetVertexCount(), Infinity);
+        PriorityQueue<EntryAlias, std::greater<EntryAlias>> queue;
+        queue.Reserve(this->GetVertexCount());
+
+        distances[source] = WeightTypeAlias(0);
+        queue.Emplace(WeightTypeAlias(0), source);
+
+        while (!queue.IsEmpty())
+        {
+            const auto [distance, vertex] = queue.PopTop();
+            if (distance > distances[vertex])
+            {
+                continue;
+            }
+            for (SizeTypeAlias edge = _offsets[vertex]; edge < _offsets[vertex + 1]; ++edge)
+            {
+                // A path at or past Infinity is no path; with integer weights the sum itself would overflow.
+                if (_weights[edge] >= Infinity - distance)
+                {
+                    continue;
+                }
+                const WeightTypeAlias candidate = distance + _weights[edge];
+                const VertexTypeAlias target = _targets[edge];
+                if (candidate < distances[target])
+                {
+                    distances[target] = candidate;
+                    queue.Emplace(candidate, target);
+                }
+            }
+        }
+
+        return distances;
+    }
+
+  protected:
+    void CheckVertexInternal(VertexTypeAlias vertex) const
+    {
+        if (static_cast<SizeTypeAlias>(vertex) >= this->GetVertexCount())
+        {
+            throw GraphVertexOutOfBoundsException(__FILE__, __LINE__);
+        }
+    }
+
+    /**
+     * @brief Counting sort of the edges by source (or by target when transpose is set) into offsets and targets.
+     */
+    void BuildInternal(SizeTypeAlias vertexCount, const Vector<EdgeTypeAlias> &edges, bool transpose,
+                       Vector<SizeTypeAlias> &offsets, Vector<VertexTypeAlias> &targets,
+                       Vector<WeightTypeAlias> *weights)
+    {
+        offsets.Resize(vertexCount + 1);
+        for (SizeTypeAlias i = 0; i < edges.GetSize(); ++i)
+        {
+            const EdgeTypeAlias &edge = edges[i];
+            ++offsets[(transpose ? edge.Target : edge.Source) + 1];
+            if (!_isDirected && edge.Source != edge.Target)
+            {
+                ++offsets[edge.Target + 1];
+            }
+        }
+        for (SizeTypeAlias vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            offsets[vertex + 1] += offsets[vertex];
+        }
+
+        targets.Resize(offsets[vertexCount]);
+        if (weights)
+        {
+            weights->Resize(offsets[vertexCount]);
+        }
+
+        Vector<SizeTypeAlias> cursors(offsets);
+        auto place = [&](VertexTypeAlias from, VertexTypeAlias to, WeightTypeAlias weight) {
+            const SizeTypeAlias slot = cursors[from]++;
+            targets[slot] = to;
+            if (weights)
+            {
+                (*weights)[slot] = weight;
+            }
+        };
+        for (SizeTypeAlias i = 0; i < edges.GetSize(); ++i)
+        {
+            const EdgeTypeAlias &edge = edges[i];
+            if (transpose)
+            {
+                place(edge.Target, edge.Source, edge.EdgeWeight);
+            }
+            else
+            {
+                place(edge.Source, edge.Target, edge.EdgeWeight);
+                if (!_isDirected && edge.Source != edge.Target)
+                {
+                    place(edge.Target, edge.Source, edge.EdgeWeight);
+                }
+            }
+        }
+    }
+
+    SizeTypeAlias TopDownStepInternal(Vector<VertexTypeAlias> &distances, const Vector<VertexTypeAlias> &frontier,
+                                      Vector<VertexTypeAlias> &next, VertexTypeAlias depth) const
+    {
+        SizeTypeAlias scoutCount = 0;
+        for (SizeTypeAlias i = 0; i < frontier.GetSize(); ++i)
+        {
+            const VertexTypeAlias vertex = frontier[i];
+            for (SizeTypeAlias edge = _offsets[vertex]; edge < _offsets[vertex + 1]; ++edge)
+            {
+                const VertexTypeAlias target = _targets[edge];
+                if (distances[target] == Unreached)
+                {
+                    distances[target] = depth;
+                    next.PushBack(target);
+                    scoutCount += _offsets[target + 1] - _offsets[target];
+                }
+            }
+        }
+        return scoutCount;
+    }
+
+    SizeTypeAlias BottomUpStepInternal(Vector<VertexTypeAlias> &distances, const DynamicBitset<> &frontier,
+                                       DynamicBitset<> &next, VertexTypeAlias depth) const
+    {
+        const Vector<SizeTypeAlias> &inOffsets = _isDirected ? _reverseOffsets : _offsets;
+        const Vector<VertexTypeAlias> &inSources = _isDirected ? _reverseSources : _targets;
+        const SizeTypeAlias vertexCount = this->GetVertexCount();
+
+        SizeTypeAlias awakeCount = 0;
+        for (SizeTypeAlias vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            if (distances[vertex] != Unreached)
+            {
+                continue;
+            }
+            for (SizeTypeAlias edge = inOffsets[vertex]; edge < inOffsets[vertex + 1]; ++edge)
+            {
+                if (frontier[inSources[edge]])
+                {
+                    distances[vertex] = depth;
+                    next.Set(vertex);
+                    ++awakeCount;
+                    break;
+                }
+            }
+        }
+        return awakeCount;
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_CSR_GRAPH_HPP
@@ -0,0 +1,39 @@
+#ifndef DSA_LIBRARIES_GRAPH_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_GRAPH_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class GraphException : public Utilities::Exception
+{
+  public:
+    GraphException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class GraphVertexOutOfBoundsException : public GraphException
+{
+  public:
+    GraphVertexOutOfBoundsException(string_type fileText, numeric_type line)
+        : GraphException("Vertex out of bounds", std::move(fileText), line)
+    {
+    }
+};
+class GraphVertexOverflowException : public GraphException
+{
+  public:
+    GraphVertexOverflowException(string_type fileText, numeric_type line)
+        : GraphException("Vertex count does not fit the vertex type", std::move(fileText), line)
+    {
+    }
+};
+class GraphNegativeWeightException : public GraphException
+{
+  public:
+    GraphNegativeWeightException(string_type fileText, numeric_type line)
+        : GraphException("Graph has a negative edge weight", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,467 @@
+#ifndef DSA_LIBRARIES_INTRUSIVE_DLIST_HPP
+#define DSA_LIBRARIES_INTRUSIVE_DLIST_HPP
+#include "IntrusiveHook.hpp"
+#include "IntrusiveListExceptions.hpp"
+#include "IntrusiveListIterator.hpp"
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Doubly linked list of objects that carry their own DListNodeBase hook as the member Hook, so linking,
+ * unlinking, splicing and sorting never allocate. The list does not own its objects: erasing only unlinks, and an
+ * object must stay alive and in place while linked unless its hook is an IntrusiveDListAutoHook.
+ *
+ * An object can sit in several lists at once through different hooks. Inserting an object whose hook is already
+ * linked throws IntrusiveListLinkedException.
+ */
+template <typename T, auto Hook> class IntrusiveDList
+{
+  public:
+    using TraitsAlias = IntrusiveHookTraits<Hook, DListNodeBase>;
+    using ValueTypeAlias = T;
+    using PointerAlias = T *;
+    using ConstPointerAlias = const T *;
+    using ReferenceTypeAlias = T &;
+    using ConstReferenceTypeAlias = const T &;
+    using IteratorAlias = IntrusiveListIterator<TraitsAlias, false>;
+    using ConstIteratorAlias = IntrusiveListIterator<TraitsAlias, true>;
+    using SizeTypeAlias = std::size_t;
+    using DifferenceTypeAlias = std::ptrdiff_t;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using pointer = PointerAlias;
+    using const_pointer = ConstPointerAlias;
+    using reference = ReferenceTypeAlias;
+    using const_reference = ConstReferenceTypeAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+    using size_type = SizeTypeAlias;
+    using difference_type = DifferenceTypeAlias;
+
+    static_assert(std::is_same_v<T, typename TraitsAlias::ValueTypeAlias>, "Hook must be a member of T");
+
+  private:
+    // Circular: the head's PointerNext is the first node and its PointerPrev the last.
+    DListNodeBase _head;
+
+    DListNodeBase *HeadInternal() const noexcept
+    {
+        return const_cast<DListNodeBase *>(&_head);
+    }
+
+    static DListNodeBase *LinkableNodeInternal(ReferenceTypeAlias value)
+    {
+        DListNodeBase *node = TraitsAlias::ToNode(value);
+        if (node->PointerNext != nullptr)
+        {
+            throw IntrusiveListLinkedException(__FILE__, __LINE__);
+        }
+        return node;
+    }
+
+    static DListNodeBase *UnlinkInternal(DListNodeBase *node) noexcept
+    {
+        DListNodeBase *next = node->PointerNext;
+        node->UnhookInternal();
+        node->PointerNext = node->PointerPrev = nullptr;
+        return next;
+    }
+
+    /** Move [first, last) in front of position; the range may come from any list. */
+    static void TransferInternal(DListNodeBase *position, DListNodeBase *first, DListNodeBase *last) noexcept
+    {
+        if (first == last || position == last)
+        {
+            return;
+        }
+        DListNodeBase *back = last->PointerPrev;
+        first->PointerPrev->PointerNext = last;
+        last->PointerPrev = first->PointerPrev;
+        DListNodeBase *prev = position->PointerPrev;
+        prev->PointerNext = first;
+        first->PointerPrev = prev;
+        back->PointerNext = position;
+        position->PointerPrev = back;
+    }
+
+    static void RelinkInternal(DListNodeBase &target, DListNodeBase &source) noexcept
+    {
+        if (source.PointerNext == &source)
+        {
+            target.PointerNext = target.PointerPrev = &target;
+            return;
+        }
+        target.PointerNext = source.PointerNext;
+        target.PointerPrev = source.PointerPrev;
+        target.PointerNext->PointerPrev = &target;
+        target.PointerPrev->PointerNext = &target;
+        source.PointerNext = source.PointerPrev = &source;
+    }
+
+  public:
+    IntrusiveDList() noexcept
+    {
+        _head.PointerNext = _head.PointerPrev = &_head;
+    }
+
+    template <std::input_iterator InputIterator> IntrusiveDList(InputIterator begin, InputIterator end) : IntrusiveDList()
+    {
+        for (; begin != end; ++begin)
+        {
+            PushBack(*begin);
+        }
+    }
+
+    IntrusiveDList(const IntrusiveDList &) = delete;
+    IntrusiveDList &operator=(const IntrusiveDList &) = delete;
+
+    IntrusiveDList(IntrusiveDList &&list) noexcept
+    {
+        RelinkInternal(_head, list._head);
+    }
+
+    IntrusiveDList &operator=(IntrusiveDList &&list) noexcept
+    {
+        if (this != &list)
+        {
+            Clear();
+            RelinkInternal(_head, list._head);
+        }
+        return *this;
+    }
+
+    ~IntrusiveDList()
+    {
+        Clear();
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() noexcept
+    {
+        return GetBegin();
+    }
+
+    ConstIteratorAlias begin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cbegin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    IteratorAlias end() noexcept
+    {
+        return GetEnd();
+    }
+
+    ConstIteratorAlias end() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cend() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] IteratorAlias before_begin() noexcept
+    {
+        return GetBeginFromHead();
+    }
+    // End Zone Adaptive Iterator
+
+    /** The position before the first element, which is the end position, as in DList. */
+    IteratorAlias GetBeginFromHead() noexcept
+    {
+        return IteratorAlias(&_head);
+    }
+
+    IteratorAlias GetBegin() noexcept
+    {
+        return IteratorAlias(_head.PointerNext);
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return ConstIteratorAlias(_head.PointerNext);
+    }
+
+    IteratorAlias GetEnd() noexcept
+    {
+        return IteratorAlias(&_head);
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return ConstIteratorAlias(HeadInternal());
+    }
+
+    /** Iterator to value, which must be linked into this list; O(1). */
+    static IteratorAlias GetIterator(ReferenceTypeAlias value) noexcept
+    {
+        return IteratorAlias(TraitsAlias::ToNode(value));
+    }
+
+    [[nodiscard]] static bool IsLinked(ConstReferenceTypeAlias value) noexcept
+    {
+        return TraitsAlias::IsLinked(value);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _head.PointerNext == &_head;
+    }
+
+    /** O(n): objects can leave the list through Unlink without it knowing. */
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        SizeTypeAlias size = 0;
+        for (const DListNodeBase *node = _head.PointerNext; node != &_head; node = node->PointerNext)
+        {
+            ++size;
+        }
+        return size;
+    }
+
+    ReferenceTypeAlias GetItemFront()
+    {
+        if (IsEmpty())
+        {
+            throw IntrusiveListEmptyException(__FILE__, __LINE__);
+        }
+        return *GetBegin();
+    }
+
+    ReferenceTypeAlias GetItemBack()
+    {
+        if (IsEmpty())
+        {
+            throw IntrusiveListEmptyException(__FILE__, __LINE__);
+        }
+        return *TraitsAlias::ToValue(_head.PointerPrev);
+    }
+
+    void PushFront(ReferenceTypeAlias value)
+    {
+        LinkableNodeInternal(value)->HookBeforeInternal(_head.PointerNext);
+    }
+
+    void PushBack(ReferenceTypeAlias value)
+    {
+        LinkableNodeInternal(value)->HookBeforeInternal(&_head);
+    }
+
+    void PopFront()
+    {
+        if (IsEmpty())
+        {
+            throw IntrusiveListEmptyException(__FILE__, __LINE__);
+        }
+        UnlinkInternal(_head.PointerNext);
+    }
+
+    void PopBack()
+    {
+        if (IsEmpty())
+        {
+            throw IntrusiveListEmptyException(__FILE__, __LINE__);
+        }
+        UnlinkInternal(_head.PointerPrev);
+    }
+
+    IteratorAlias InsertBefore(ConstIteratorAlias position, ReferenceTypeAlias value)
+    {
+        DListNodeBase *node = LinkableNodeInternal(value);
+        node->HookBeforeInternal(position.Node);
+        return IteratorAlias(node);
+    }
+
+    IteratorAlias InsertAfter(ConstIteratorAlias position, ReferenceTypeAlias value)
+    {
+        DListNodeBase *node = LinkableNodeInternal(value);
+        node->HookBeforeInternal(position.Node->PointerNext);
+        return IteratorAlias(node);
+    }
+
+    /** Unlink the object at position and return an iterator to the one after it. */
+    IteratorAlias Erase(ConstIteratorAlias position) noexcept
+    {
+        return IteratorAlias(UnlinkInternal(position.Node));
+    }
+
+    IteratorAlias Erase(ConstIteratorAlias first, ConstIteratorAlias last) noexcept
+    {
+        DListNodeBase *node = first.Node;
+        while (node != last.Node)
+        {
+            node = UnlinkInternal(node);
+        }
+        return last.ConstCast();
+    }
+
+    IteratorAlias EraseAfter(ConstIteratorAlias position) noexcept
+    {
+        return IteratorAlias(UnlinkInternal(position.Node->PointerNext));
+    }
+
+    /** Unlink value from whatever list holds it in O(1), without a reference to that list. */
+    static void Unlink(ReferenceTypeAlias value) noexcept
+    {
+        DListNodeBase *node = TraitsAlias::ToNode(value);
+        if (node->PointerNext != nullptr)
+        {
+            UnlinkInternal(node);
+        }
+    }
+
+    /** Move every object of list in front of position in O(1). */
+    void Splice(ConstIteratorAlias position, IntrusiveDList &list) noexcept
+    {
+        TransferInternal(position.Node, list._head.PointerNext, &list._head);
+    }
+
+    void Splice(ConstIteratorAlias position, IntrusiveDList &&list) noexcept
+    {
+        Splice(position, list);
+    }
+
+    /** Move the object at it, which is in list, in front of position. */
+    void Splice(ConstIteratorAlias position, IntrusiveDList &, ConstIteratorAlias it) noexcept
+    {
+        if (position.Node != it.Node)
+        {
+            TransferInternal(position.Node, it.Node, it.Node->PointerNext);
+        }
+    }
+
+    void Splice(ConstIteratorAlias position, IntrusiveDList &, ConstIteratorAlias first, ConstIteratorAlias last) noexcept
+    {
+        TransferInternal(position.Node, first.Node, last.Node);
+    }
+
+    void SpliceAfter(ConstIteratorAlias position, IntrusiveDList &list) noexcept
+    {
+        TransferInternal(position.Node->PointerNext, list._head.PointerNext, &list._head);
+    }
+
+    void SpliceAfter(ConstIteratorAlias position, IntrusiveDList &&list) noexcept
+    {
+        SpliceAfter(position, list);
+    }
+
+    void Remove(ConstReferenceTypeAlias value)
+    {
+        RemoveIf([&value](ConstReferenceTypeAlias item) { return item == value; });
+    }
+
+    template <typename TPredicate> void RemoveIf(TPredicate predicate)
+    {
+        for (DListNodeBase *node = _head.PointerNext; node != &_head;)
+        {
+            node = predicate(*TraitsAlias::ToValue(node)) ? UnlinkInternal(node) : node->PointerNext;
+        }
+    }
+
+    void Merge(IntrusiveDList &list)
+    {
+        Merge(list, std::less<ValueTypeAlias>());
+    }
+
+    /** Merge the sorted list into this sorted list by relinking; equal objects of this list stay first. */
+    template <typename TCompare> void Merge(IntrusiveDList &list, TCompare compare)
+    {
+        if (&list == this)
+        {
+            return;
+        }
+        DListNodeBase *first = _head.PointerNext;
+        DListNodeBase *other = list._head.PointerNext;
+        while (first != &_head && other != &list._head)
+        {
+            if (compare(*TraitsAlias::ToValue(other), *TraitsAlias::ToValue(first)))
+            {
+                DListNodeBase *next = other->PointerNext;
+                TransferInternal(first, other, next);
+                other = next;
+            }
+            else
+            {
+                first = first->PointerNext;
+            }
+        }
+        TransferInternal(&_head, other, &list._head);
+    }
+
+    void Sort()
+    {
+        Sort(std::less<ValueTypeAlias>());
+    }
+
+    /** Stable merge sort by relinking, O(n log n) compares with no allocation: runs of doubling length are merged
+     * through a fixed set of bucket lists on the stack. */
+    template <typename TCompare> void Sort(TCompare compare)
+    {
+        if (IsEmpty() || _head.PointerNext->PointerNext == &_head)
+        {
+            return;
+        }
+        IntrusiveDList carry;
+        IntrusiveDList buckets[64];
+        std::size_t fill = 0;
+        do
+        {
+            TransferInternal(carry._head.PointerNext, _head.PointerNext, _head.PointerNext->PointerNext);
+            std::size_t i = 0;
+            for (; i < fill && !buckets[i].IsEmpty(); ++i)
+            {
+                buckets[i].Merge(carry, compare);
+                carry.Swap(buckets[i]);
+            }
+            carry.Swap(buckets[i]);
+            if (i == fill)
+            {
+                ++fill;
+            }
+        } while (!IsEmpty());
+        for (std::size_t i = 1; i < fill; ++i)
+        {
+            buckets[i].Merge(buckets[i - 1], compare);
+        }
+        Swap(buckets[fill - 1]);
+    }
+
+    void Reverse() noexcept
+    {
+        DListNodeBase *node = &_head;
+        do
+        {
+            std::swap(node->PointerNext, node->PointerPrev);
+            node = node->PointerPrev;
+        } while (node != &_head);
+    }
+
+    void Swap(IntrusiveDList &list) noexcept
+    {
+        DListNodeBase temp;
+        RelinkInternal(temp, _head);
+        RelinkInternal(_head, list._head);
+        RelinkInternal(list._head, temp);
+    }
+
+    /** Unlink every object, leaving each hook unlinked. */
+    void Clear() noexcept
+    {
+        while (_head.PointerNext != &_head)
+        {
+            UnlinkInternal(_head.PointerNext);
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_INTRUSIVE_DLIST_HPP
@@ -0,0 +1,91 @@
+#ifndef DSA_LIBRARIES_INTRUSIVE_HOOK_HPP
+#define DSA_LIBRARIES_INTRUSIVE_HOOK_HPP
+#include "../DList/DListNode.hpp"
+#include "../SList/SListNode.hpp"
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief DListNodeBase that unlinks itself when its object is destroyed, so an object can die while still in an
+ * IntrusiveDList. Copies and moves start out unlinked; the links belong to the original object.
+ */
+struct IntrusiveDListAutoHook : public DListNodeBase
+{
+    IntrusiveDListAutoHook() = default;
+
+    IntrusiveDListAutoHook(const IntrusiveDListAutoHook &) noexcept : DListNodeBase()
+    {
+    }
+
+    IntrusiveDListAutoHook(IntrusiveDListAutoHook &&) noexcept : DListNodeBase()
+    {
+    }
+
+    IntrusiveDListAutoHook &operator=(const IntrusiveDListAutoHook &) noexcept
+    {
+        return *this;
+    }
+
+    IntrusiveDListAutoHook &operator=(IntrusiveDListAutoHook &&) noexcept
+    {
+        return *this;
+    }
+
+    ~IntrusiveDListAutoHook()
+    {
+        if (this->PointerNext != nullptr)
+        {
+            this->UnhookInternal();
+        }
+    }
+};
+
+template <typename TMember> struct IntrusiveMemberTraits;
+
+template <typename T, typename THook> struct IntrusiveMemberTraits<THook T::*>
+{
+    using ValueTypeAlias = T;
+    using HookTypeAlias = THook;
+};
+
+/**
+ * @brief Maps between an object and the hook member Hook embedded in it. A hook is linked exactly when its
+ * PointerNext is set; the lists clear both links when they let go of a node.
+ */
+template <auto Hook, typename TNode> struct IntrusiveHookTraits
+{
+    using ValueTypeAlias = typename IntrusiveMemberTraits<decltype(Hook)>::ValueTypeAlias;
+    using HookTypeAlias = typename IntrusiveMemberTraits<decltype(Hook)>::HookTypeAlias;
+    using NodeAlias = TNode;
+
+    static_assert(std::is_base_of_v<TNode, HookTypeAlias>, "The hook member must derive from the list's node base");
+
+    static NodeAlias *ToNode(ValueTypeAlias &value) noexcept
+    {
+        return std::addressof(value.*Hook);
+    }
+
+    static ValueTypeAlias *ToValue(NodeAlias *node) noexcept
+    {
+        auto *hook = reinterpret_cast<unsigned char *>(static_cast<HookTypeAlias *>(node));
+        return reinterpret_cast<ValueTypeAlias *>(hook - OffsetInternal());
+    }
+
+    static bool IsLinked(const ValueTypeAlias &value) noexcept
+    {
+        return (value.*Hook).PointerNext != nullptr;
+    }
+
+  private:
+    static std::ptrdiff_t OffsetInternal() noexcept
+    {
+        // Only addresses are taken, so the probe is never read; compilers fold this to a constant.
+        alignas(ValueTypeAlias) unsigned char probe[sizeof(ValueTypeAlias)];
+        auto *object = reinterpret_cast<ValueTypeAlias *>(probe);
+        return reinterpret_cast<unsigned char *>(std::addressof(object->*Hook)) - probe;
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_INTRUSIVE_HOOK_HPP
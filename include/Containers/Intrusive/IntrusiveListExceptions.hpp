@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_INTRUSIVE_LIST_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_INTRUSIVE_LIST_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class IntrusiveListException : public Utilities::Exception
+{
+  public:
+    IntrusiveListException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class IntrusiveListEmptyException : public IntrusiveListException
+{
+  public:
+    IntrusiveListEmptyException(string_type fileText, numeric_type line)
+        : IntrusiveListException("Intrusive list is empty", std::move(fileText), line)
+    {
+    }
+};
+class IntrusiveListLinkedException : public IntrusiveListException
+{
+  public:
+    IntrusiveListLinkedException(string_type fileText, numeric_type line)
+        : IntrusiveListException("Object is already linked into a list through this hook", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
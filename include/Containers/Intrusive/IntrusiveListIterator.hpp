@@ -0,0 +1,101 @@
+#ifndef DSA_LIBRARIES_INTRUSIVE_LIST_ITERATOR_HPP
+#define DSA_LIBRARIES_INTRUSIVE_LIST_ITERATOR_HPP
+#include "../DList/DListNode.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Iterator over an intrusive list: walks the hooks and maps each back to its object through TTraits.
+ * Bidirectional over DListNodeBase hooks, forward over SListNodeBase hooks.
+ */
+template <typename TTraits, bool IsConst> struct IntrusiveListIterator
+{
+    using NodeAlias = typename TTraits::NodeAlias;
+    using SelfAlias = IntrusiveListIterator<TTraits, IsConst>;
+    using ValueTypeAlias = typename TTraits::ValueTypeAlias;
+    using PointerAlias = std::conditional_t<IsConst, const ValueTypeAlias *, ValueTypeAlias *>;
+    using ReferenceAlias = std::conditional_t<IsConst, const ValueTypeAlias &, ValueTypeAlias &>;
+
+    static constexpr bool IsBidirectional = std::is_base_of_v<DListNodeBase, NodeAlias>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::conditional_t<IsBidirectional, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+
+    NodeAlias *Node;
+
+    IntrusiveListIterator() noexcept : Node()
+    {
+    }
+
+    explicit IntrusiveListIterator(NodeAlias *node) noexcept : Node(node)
+    {
+    }
+
+    template <bool IsOtherConst>
+        requires(IsConst && !IsOtherConst)
+    IntrusiveListIterator(const IntrusiveListIterator<TTraits, IsOtherConst> &iter) noexcept : Node(iter.Node)
+    {
+    }
+
+    [[nodiscard]] IntrusiveListIterator<TTraits, false> ConstCast() const noexcept
+    {
+        return IntrusiveListIterator<TTraits, false>(this->Node);
+    }
+
+    ReferenceAlias operator*() const noexcept
+    {
+        return *TTraits::ToValue(this->Node);
+    }
+
+    PointerAlias operator->() const noexcept
+    {
+        return TTraits::ToValue(this->Node);
+    }
+
+    SelfAlias &operator++() noexcept
+    {
+        this->Node = this->Node->PointerNext;
+        return *this;
+    }
+
+    SelfAlias operator++(int) noexcept
+    {
+        SelfAlias temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    SelfAlias &operator--() noexcept
+        requires IsBidirectional
+    {
+        this->Node = this->Node->PointerPrev;
+        return *this;
+    }
+
+    SelfAlias operator--(int) noexcept
+        requires IsBidirectional
+    {
+        SelfAlias temp(*this);
+        --*this;
+        return temp;
+    }
+
+    friend bool operator==(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.Node == rhs.Node;
+    }
+
+    friend bool operator!=(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_INTRUSIVE_LIST_ITERATOR_HPP
@@ -0,0 +1,406 @@
+#ifndef DSA_LIBRARIES_INTRUSIVE_SLIST_HPP
+#define DSA_LIBRARIES_INTRUSIVE_SLIST_HPP
+#include "IntrusiveHook.hpp"
+#include "IntrusiveListExceptions.hpp"
+#include "IntrusiveListIterator.hpp"
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Singly linked list of objects that carry their own SListNodeBase hook as the member Hook, so linking and
+ * unlinking never allocate. The list does not own its objects: erasing only unlinks, and an object must stay alive
+ * and in place while linked.
+ *
+ * Inserting an object whose hook is already linked throws IntrusiveListLinkedException. Unlinking needs the
+ * predecessor, so it goes through EraseAfter; use IntrusiveDList for O(1) unlink from any node.
+ */
+template <typename T, auto Hook> class IntrusiveSList
+{
+  public:
+    using TraitsAlias = IntrusiveHookTraits<Hook, SListNodeBase>;
+    using ValueTypeAlias = T;
+    using PointerAlias = T *;
+    using ConstPointerAlias = const T *;
+    using ReferenceTypeAlias = T &;
+    using ConstReferenceTypeAlias = const T &;
+    using IteratorAlias = IntrusiveListIterator<TraitsAlias, false>;
+    using ConstIteratorAlias = IntrusiveListIterator<TraitsAlias, true>;
+    using SizeTypeAlias = std::size_t;
+    using DifferenceTypeAlias = std::ptrdiff_t;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using pointer = PointerAlias;
+    using const_pointer = ConstPointerAlias;
+    using reference = ReferenceTypeAlias;
+    using const_reference = ConstReferenceTypeAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+    using size_type = SizeTypeAlias;
+    using difference_type = DifferenceTypeAlias;
+
+    static_assert(std::is_same_v<T, typename TraitsAlias::ValueTypeAlias>, "Hook must be a member of T");
+
+  private:
+    SListNodeBase _head;
+
+    /**
+     * The last node links to this shared marker rather than to nullptr, so a null PointerNext always means
+     * unlinked, and moving a list stays O(1).
+     */
+    static SListNodeBase *EndInternal() noexcept
+    {
+        static SListNodeBase end;
+        return &end;
+    }
+
+    static SListNodeBase *LinkableNodeInternal(ReferenceTypeAlias value)
+    {
+        SListNodeBase *node = TraitsAlias::ToNode(value);
+        if (node->PointerNext != nullptr)
+        {
+            throw IntrusiveListLinkedException(__FILE__, __LINE__);
+        }
+        return node;
+    }
+
+    static void LinkAfterInternal(SListNodeBase *position, SListNodeBase *node) noexcept
+    {
+        node->PointerNext = position->PointerNext;
+        position->PointerNext = node;
+    }
+
+    /** Unlink the node after position and return the one that followed it. */
+    static SListNodeBase *UnlinkAfterInternal(SListNodeBase *position) noexcept
+    {
+        SListNodeBase *node = position->PointerNext;
+        position->PointerNext = node->PointerNext;
+        node->PointerNext = nullptr;
+        return position->PointerNext;
+    }
+
+    /** Move the node after source in behind position. */
+    static void TransferAfterInternal(SListNodeBase *position, SListNodeBase *source) noexcept
+    {
+        SListNodeBase *node = source->PointerNext;
+        source->PointerNext = node->PointerNext;
+        LinkAfterInternal(position, node);
+    }
+
+  public:
+    IntrusiveSList() noexcept
+    {
+        _head.PointerNext = EndInternal();
+    }
+
+    template <std::input_iterator InputIterator> IntrusiveSList(InputIterator begin, InputIterator end) : IntrusiveSList()
+    {
+        SListNodeBase *last = &_head;
+        for (; begin != end; ++begin)
+        {
+            SListNodeBase *node = LinkableNodeInternal(*begin);
+            LinkAfterInternal(last, node);
+            last = node;
+        }
+    }
+
+    IntrusiveSList(const IntrusiveSList &) = delete;
+    IntrusiveSList &operator=(const IntrusiveSList &) = delete;
+
+    IntrusiveSList(IntrusiveSList &&list) noexcept
+    {
+        _head.PointerNext = std::exchange(list._head.PointerNext, EndInternal());
+    }
+
+    IntrusiveSList &operator=(IntrusiveSList &&list) noexcept
+    {
+        if (this != &list)
+        {
+            Clear();
+            _head.PointerNext = std::exchange(list._head.PointerNext, EndInternal());
+        }
+        return *this;
+    }
+
+    ~IntrusiveSList()
+    {
+        Clear();
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() noexcept
+    {
+        return GetBegin();
+    }
+
+    ConstIteratorAlias begin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cbegin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    IteratorAlias end() noexcept
+    {
+        return GetEnd();
+    }
+
+    ConstIteratorAlias end() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cend() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] IteratorAlias before_begin() noexcept
+    {
+        return GetBeginFromHead();
+    }
+    // End Zone Adaptive Iterator
+
+    IteratorAlias GetBeginFromHead() noexcept
+    {
+        return IteratorAlias(&_head);
+    }
+
+    IteratorAlias GetBegin() noexcept
+    {
+        return IteratorAlias(_head.PointerNext);
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return ConstIteratorAlias(_head.PointerNext);
+    }
+
+    IteratorAlias GetEnd() noexcept
+    {
+        return IteratorAlias(EndInternal());
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return ConstIteratorAlias(EndInternal());
+    }
+
+    [[nodiscard]] static bool IsLinked(ConstReferenceTypeAlias value) noexcept
+    {
+        return TraitsAlias::IsLinked(value);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _head.PointerNext == EndInternal();
+    }
+
+    /** O(n), as for SList. */
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        SizeTypeAlias size = 0;
+        for (const SListNodeBase *node = _head.PointerNext; node != EndInternal(); node = node->PointerNext)
+        {
+            ++size;
+        }
+        return size;
+    }
+
+    ReferenceTypeAlias GetItemFront()
+    {
+        if (IsEmpty())
+        {
+            throw IntrusiveListEmptyException(__FILE__, __LINE__);
+        }
+        return *GetBegin();
+    }
+
+    void PushFront(ReferenceTypeAlias value)
+    {
+        LinkAfterInternal(&_head, LinkableNodeInternal(value));
+    }
+
+    void PopFront()
+    {
+        if (IsEmpty())
+        {
+            throw IntrusiveListEmptyException(__FILE__, __LINE__);
+        }
+        UnlinkAfterInternal(&_head);
+    }
+
+    IteratorAlias InsertAfter(ConstIteratorAlias position, ReferenceTypeAlias value)
+    {
+        SListNodeBase *node = LinkableNodeInternal(value);
+        LinkAfterInternal(position.Node, node);
+        return IteratorAlias(node);
+    }
+
+    /** Unlink the object after position and return an iterator to the one after it. */
+    IteratorAlias EraseAfter(ConstIteratorAlias position) noexcept
+    {
+        return IteratorAlias(UnlinkAfterInternal(position.Node));
+    }
+
+    /** Unlink the objects strictly between begin and end. */
+    IteratorAlias EraseAfter(ConstIteratorAlias begin, ConstIteratorAlias end) noexcept
+    {
+        while (begin.Node->PointerNext != end.Node)
+        {
+            UnlinkAfterInternal(begin.Node);
+        }
+        return end.ConstCast();
+    }
+
+    /** Move every object of list behind position; O(list.GetSize()) to find its last node. */
+    void SpliceAfter(ConstIteratorAlias position, IntrusiveSList &list) noexcept
+    {
+        if (&list == this || list.IsEmpty())
+        {
+            return;
+        }
+        SListNodeBase *last = list._head.PointerNext;
+        while (last->PointerNext != EndInternal())
+        {
+            last = last->PointerNext;
+        }
+        last->PointerNext = position.Node->PointerNext;
+        position.Node->PointerNext = std::exchange(list._head.PointerNext, EndInternal());
+    }
+
+    void SpliceAfter(ConstIteratorAlias position, IntrusiveSList &&list) noexcept
+    {
+        SpliceAfter(position, list);
+    }
+
+    /** Move the object after before, which is in list, behind position. */
+    void SpliceAfter(ConstIteratorAlias position, IntrusiveSList &, ConstIteratorAlias before) noexcept
+    {
+        if (position.Node != before.Node && position.Node != before.Node->PointerNext)
+        {
+            TransferAfterInternal(position.Node, before.Node);
+        }
+    }
+
+    void Remove(ConstReferenceTypeAlias value)
+    {
+        RemoveIf([&value](ConstReferenceTypeAlias item) { return item == value; });
+    }
+
+    template <typename TPredicate> void RemoveIf(TPredicate predicate)
+    {
+        for (SListNodeBase *prev = &_head; prev->PointerNext != EndInternal();)
+        {
+            if (predicate(*TraitsAlias::ToValue(prev->PointerNext)))
+            {
+                UnlinkAfterInternal(prev);
+            }
+            else
+            {
+                prev = prev->PointerNext;
+            }
+        }
+    }
+
+    void Merge(IntrusiveSList &list)
+    {
+        Merge(list, std::less<ValueTypeAlias>());
+    }
+
+    /** Merge the sorted list into this sorted list by relinking; equal objects of this list stay first. */
+    template <typename TCompare> void Merge(IntrusiveSList &list, TCompare compare)
+    {
+        if (&list == this)
+        {
+            return;
+        }
+        SListNodeBase *prev = &_head;
+        while (prev->PointerNext != EndInternal() && !list.IsEmpty())
+        {
+            if (compare(*TraitsAlias::ToValue(list._head.PointerNext), *TraitsAlias::ToValue(prev->PointerNext)))
+            {
+                TransferAfterInternal(prev, &list._head);
+            }
+            prev = prev->PointerNext;
+        }
+        if (!list.IsEmpty())
+        {
+            // The rest of list already ends at the shared marker, so it is linked in whole.
+            prev->PointerNext = std::exchange(list._head.PointerNext, EndInternal());
+        }
+    }
+
+    void Sort()
+    {
+        Sort(std::less<ValueTypeAlias>());
+    }
+
+    /** Stable merge sort by relinking with no allocation, bucketing runs of doubling length as IntrusiveDList does. */
+    template <typename TCompare> void Sort(TCompare compare)
+    {
+        if (IsEmpty() || _head.PointerNext->PointerNext == EndInternal())
+        {
+            return;
+        }
+        IntrusiveSList carry;
+        IntrusiveSList buckets[64];
+        std::size_t fill = 0;
+        do
+        {
+            TransferAfterInternal(&carry._head, &_head);
+            std::size_t i = 0;
+            for (; i < fill && !buckets[i].IsEmpty(); ++i)
+            {
+                buckets[i].Merge(carry, compare);
+                carry.Swap(buckets[i]);
+            }
+            carry.Swap(buckets[i]);
+            if (i == fill)
+            {
+                ++fill;
+            }
+        } while (!IsEmpty());
+        for (std::size_t i = 1; i < fill; ++i)
+        {
+            buckets[i].Merge(buckets[i - 1], compare);
+        }
+        Swap(buckets[fill - 1]);
+    }
+
+    void Reverse() noexcept
+    {
+        SListNodeBase *reversed = EndInternal();
+        SListNodeBase *node = _head.PointerNext;
+        while (node != EndInternal())
+        {
+            SListNodeBase *next = node->PointerNext;
+            node->PointerNext = reversed;
+            reversed = node;
+            node = next;
+        }
+        _head.PointerNext = reversed;
+    }
+
+    void Swap(IntrusiveSList &list) noexcept
+    {
+        std::swap(_head.PointerNext, list._head.PointerNext);
+    }
+
+    /** Unlink every object, leaving each hook unlinked. */
+    void Clear() noexcept
+    {
+        while (_head.PointerNext != EndInternal())
+        {
+            UnlinkAfterInternal(&_head);
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_INTRUSIVE_SLIST_HPP
@@ -2,22 +2,33 @@
 #ifndef DSA_LIBRARIES_LIST_HPP
 #define DSA_LIBRARIES_LIST_HPP 1
 #include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Instrumentation.hpp"
+#include "../../Utilities/NodePool.hpp"
+#include "../../Utilities/NodeSlabs.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "../LoserTree/LoserTree.hpp"
 #include "ListIterator.hpp"
 #include "ListNode.hpp"
+#include <cstddef>
+#include <iterator>
 using namespace DSALibraries::Utilities;
 
 namespace DSALibraries::Containers
 {
+template <typename T, typename Alloc> class List;
+
 template <typename T, typename Alloc> class ListBase
 {
   protected:
     using TypeAllocatorTraitsAlias = std::allocator_traits<Alloc>;
     using NodeAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<ListNode<T>>;
     using TpAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<T>;
+    using NodeSlabsAlias = Utilities::NodeSlabs<ListNode<T>, NodeAllocatorTypeAlias>;
 
     struct ListBaseCore : NodeAllocatorTypeAlias
     {
         ListNodeBase NodeBase;
+        Utilities::NodePool<ListNode<T>, NodeAllocatorTypeAlias> Pool;
 
         ListBaseCore() : NodeAllocatorTypeAlias(), NodeBase()
         {
@@ -38,12 +49,119 @@ template <typename T, typename Alloc> class ListBase
 
     ListNode<T>* GetNodeInternal() noexcept
     {
-        return static_cast<ListNode<T>*>(LinkedListCore.NodeAllocatorTypeAlias::allocate(1));
+        if (ListNode<T>* node = this->LinkedListCore.Pool.Pop())
+        {
+            return node;
+        }
+        ListNode<T>* node = NodeSlabsAlias::AllocateOne(this->GetNodeAllocatorInternal());
+        Utilities::InstrumentationHooks<List<T, Alloc>>::OnAllocation(sizeof(ListNode<T>));
+        return node;
     }
 
     void PutNodeInternal(ListNode<T>* node) noexcept
     {
-        LinkedListCore.NodeAllocatorTypeAlias::deallocate(node, 1);
+        if (this->LinkedListCore.Pool.Push(node))
+        {
+            return;
+        }
+        ReportNodesFreedInternal(NodeSlabsAlias::Deallocate(this->GetNodeAllocatorInternal(), node));
+    }
+
+    void ReserveNodesInternal(std::size_t count)
+    {
+        if (const std::size_t bytes = this->LinkedListCore.Pool.Reserve(this->GetNodeAllocatorInternal(), count))
+        {
+            Utilities::InstrumentationHooks<List<T, Alloc>>::OnAllocation(bytes);
+        }
+    }
+
+    void SetNodePoolLimitInternal(std::size_t limit) noexcept
+    {
+        this->LinkedListCore.Pool.SetLimit(this->GetNodeAllocatorInternal(), limit, &ReportNodesFreedInternal);
+    }
+
+    void ReleaseNodePoolInternal() noexcept
+    {
+        this->LinkedListCore.Pool.Release(this->GetNodeAllocatorInternal(), &ReportNodesFreedInternal);
+    }
+
+    /** Report one allocator call per lone node or slab given back; bytes is 0 while a node's slab is in use. */
+    static void ReportNodesFreedInternal(std::size_t bytes) noexcept
+    {
+        if (bytes != 0)
+        {
+            Utilities::InstrumentationHooks<List<T, Alloc>>::OnDeallocation(bytes);
+        }
+    }
+
+    /** Allocate size contiguous nodes: one slab, or a single, possibly cached, node when size is 1. */
+    ListNode<T>* AllocateNodesInternal(std::size_t size)
+    {
+        if (size == 1)
+        {
+            return this->GetNodeInternal();
+        }
+        auto* slab = NodeSlabsAlias::Allocate(this->GetNodeAllocatorInternal(), size);
+        Utilities::InstrumentationHooks<List<T, Alloc>>::OnAllocation(NodeSlabsAlias::GetSlabBytes(size));
+        return slab;
+    }
+
+    /**
+     * Allocate size contiguous nodes and construct their elements in order by calling construct with each element's
+     * storage. The nodes are returned unlinked. On exception the built elements are destroyed and every node is
+     * released, so the list is left as it was.
+     */
+    template <typename TConstruct> ListNode<T>* CreateNodesInternal(std::size_t size, TConstruct construct)
+    {
+        ListNode<T>* nodes = this->AllocateNodesInternal(size);
+        std::size_t built = 0;
+        try
+        {
+            for (; built < size; ++built)
+            {
+                construct(nodes[built].GetData());
+            }
+        }
+        catch (...)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (i < built)
+                {
+                    this->GetTpAllocatorInternal().destroy(nodes[i].GetData());
+                }
+                this->PutNodeInternal(nodes + i);
+            }
+            throw;
+        }
+        return nodes;
+    }
+
+    /** Link size contiguous nodes in front of position, in order, and return the first one. */
+    ListNode<T>* LinkNodesBeforeInternal(ListNodeBase* position, ListNode<T>* nodes, std::size_t size) noexcept
+    {
+        ListNodeBase* prev = position->PointerPrev;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            nodes[i].PointerPrev = i == 0 ? prev : nodes + i - 1;
+            nodes[i].PointerNext = i + 1 == size ? position : nodes + i + 1;
+        }
+        prev->PointerNext = nodes;
+        position->PointerPrev = nodes + size - 1;
+        return nodes;
+    }
+
+    /**
+     * Move the size elements starting at first into new contiguous nodes, in order, and return them unlinked. On
+     * exception the nodes are released and the source elements are left as move_if_noexcept left them.
+     */
+    ListNode<T>* MoveToSlabInternal(ListNodeBase* first, std::size_t size)
+    {
+        return this->CreateNodesInternal(size, [this, &first](T* data) {
+            auto* source = static_cast<ListNode<T>*>(first);
+            this->GetTpAllocatorInternal().construct(data, std::move_if_noexcept(*source->GetData()));
+            first = first->PointerNext;
+        });
     }
 
   public:
@@ -91,6 +209,7 @@ template <typename T, typename Alloc> class ListBase
     ~ListBase() noexcept
     {
         ClearInternal();
+        this->ReleaseNodePoolInternal();
     }
 
   protected:
@@ -432,14 +551,20 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
 
     void Insert(IteratorAlias& position, SizeTypeAlias size, const ValueTypeAlias& value)
     {
-        List temp(size, value, this->GetAllocator());
-        Splice(position, std::move(temp));
+        FillInsertInternal(position.NodeBase, size, value);
     }
 
     template <typename InputIterator> void Insert(IteratorAlias& position, InputIterator begin, InputIterator end)
     {
-        List temp(begin, end, this->GetAllocator());
-        Splice(position, std::move(temp));
+        if constexpr (std::forward_iterator<InputIterator>)
+        {
+            RangeInsertInternal(position.NodeBase, begin, end);
+        }
+        else
+        {
+            List temp(begin, end, this->GetAllocator());
+            Splice(position, std::move(temp));
+        }
     }
 
     IteratorAlias Erase(IteratorAlias& position)
@@ -580,99 +705,173 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
         Merge(std::move(list), compare);
     }
 
+    /**
+     * @brief Merge the sorted lists into this sorted list in one relinking pass, with a LoserTree over the list fronts:
+     * O(n log k) comparisons for k lists and no node allocation. Equal elements come from this list first, then from
+     * the lists in argument order. The lists are left empty and must use an allocator equal to this one.
+     */
+    template <typename TCompare, typename... TLists>
+        requires(!std::is_same_v<std::remove_cvref_t<TCompare>, List> && (std::is_same_v<TLists, List> && ...))
+    void MergeAll(TCompare compare, TLists&... lists)
+    {
+        List* sources[] = {this, std::addressof(lists)...};
+        this->MergeAllInternal([&sources](SizeTypeAlias i) { return sources[i]; }, sizeof...(TLists) + 1, compare);
+    }
+
+    template <typename... TLists>
+        requires(std::is_same_v<TLists, List> && ...)
+    void MergeAll(TLists&... lists)
+    {
+        this->MergeAll(std::less<ValueTypeAlias>(), lists...);
+    }
+
+    /** @brief MergeAll over the count lists stored from lists on, such as the shards kept in a Vector. */
+    template <typename TCompare> void MergeAll(List* lists, SizeTypeAlias count, TCompare compare)
+    {
+        this->MergeAllInternal([this, lists](SizeTypeAlias i) { return i == 0 ? this : lists + i - 1; }, count + 1,
+                               compare);
+    }
+
+    void MergeAll(List* lists, SizeTypeAlias count)
+    {
+        this->MergeAll(lists, count, std::less<ValueTypeAlias>());
+    }
+
     void Sort()
     {
         this->Sort(std::less<ValueTypeAlias>());
     }
 
-    template <typename TCompare> void Sort(TCompare compare)
-    {
-        // IteratorAlias iLeft;
-        // IteratorAlias iRight;
-        // IteratorAlias iNode;
-        // IteratorAlias iHead;
-        // IteratorAlias iTail;
-
-        // int listSize = 1;
-        // int numberOfMerges;
-        // int leftSize;
-        // int rightSize;
-
-        // while (true)
-        // {
-        //     iLeft = GetBegin();
-        //     iHead = GetEnd();
-        //     iTail = GetEnd();
-
-        //     numberOfMerges = 0;
-
-        //     while (iLeft != GetEnd())
-        //     {
-        //         ++numberOfMerges;
-        //         iRight = iLeft;
-        //         leftSize = 0;
-
-        //         for (int i = 0; i < listSize; ++i)
-        //         {
-        //             ++leftSize;
-        //             ++iRight;
-
-        //             if (iRight == GetEnd())
-        //             {
-        //                 break;
-        //             }
-        //         }
-
-        //         rightSize = listSize;
-
-        //         while (leftSize > 0 || (rightSize > 0 && iRight != GetEnd()))
-        //         {
-        //             if (leftSize == 0)
-        //             {
-        //                 iNode = iRight;
-        //                 ++iRight;
-        //                 --rightSize;
-        //             }
-
-        //             else if (rightSize == 0 || iRight == iTail)
-        //             {
-        //                 iNode = iLeft;
-        //                 ++iLeft;
-        //                 --leftSize;
-        //             }
-
-        //             else if (!compare(*iLeft, *iRight))
-        //             {
-        //                 iNode = iLeft;
-        //                 ++iLeft;
-        //                 --leftSize;
-        //             }
-        //             else
-        //             {
-        //                 iNode = iRight;
-        //                 ++iRight;
-        //                 --rightSize;
-        //             }
-
-        //             if (iHead == GetEnd())
-        //             {
-        //                 iHead.NodeBase.PointerNext = iNode.NodeBase;
-        //                 iNode.NodeBase.PointerPrev = &iHead.NodeBase;
-        //                 iHead = iNode;
-        //                 iTail = iNode;
-        //             }
-        //             else
-        //             {
-        //                 iTail.NodeBase.PointerNext = iNode.NodeBase;
-        //                 iNode.NodeBase.PointerPrev = &iTail.NodeBase;
-        //                 iTail = iNode;
-        //             }
-
-        //         }
-
-        //         iLeft = iTail;
-        //     }
-        // }
+    /**
+     * @brief Stable bottom-up merge sort that relinks the nodes and never moves an element.
+     */
+    template <typename TCompare> void Sort(TCompare userCompare)
+    {
+        auto compare = Utilities::InstrumentCompare<List>(userCompare);
+        ListNodeBase& head = this->LinkedListCore.NodeBase;
+        if (head.PointerNext == &head || head.PointerNext->PointerNext == &head)
+        {
+            return;
+        }
+
+        SizeTypeAlias nodeWalks = 0;
+        for (SizeTypeAlias runSize = 1;; runSize *= 2)
+        {
+            ListNodeBase* left = head.PointerNext;
+            ListNodeBase* tail = &head;
+            SizeTypeAlias numberOfMerges = 0;
+
+            while (left != &head)
+            {
+                ++numberOfMerges;
+                ListNodeBase* right = left;
+                SizeTypeAlias leftSize = 0;
+                for (; leftSize < runSize && right != &head; ++leftSize)
+                {
+                    right = right->PointerNext;
+                    ++nodeWalks;
+                }
+
+                SizeTypeAlias rightSize = runSize;
+                while (leftSize > 0 || (rightSize > 0 && right != &head))
+                {
+                    ListNodeBase* node;
+                    if (leftSize == 0 || (rightSize > 0 && right != &head &&
+                                          compare(*static_cast<NodeAlias*>(right)->GetData(),
+                                                  *static_cast<NodeAlias*>(left)->GetData())))
+                    {
+                        node = right;
+                        right = right->PointerNext;
+                        --rightSize;
+                    }
+                    else
+                    {
+                        node = left;
+                        left = left->PointerNext;
+                        --leftSize;
+                    }
+                    tail->PointerNext = node;
+                    node->PointerPrev = tail;
+                    tail = node;
+                    ++nodeWalks;
+                }
+                left = right;
+            }
+            tail->PointerNext = &head;
+            head.PointerPrev = tail;
+
+            Utilities::InstrumentationHooks<List>::OnNodeWalks(nodeWalks);
+            nodeWalks = 0;
+            if (numberOfMerges <= 1)
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Stable insertion sort by relinking; each node is walked back from the end of the sorted prefix.
+     */
+    template <typename TCompare> void InsertionSort(TCompare userCompare)
+    {
+        auto compare = Utilities::InstrumentCompare<List>(userCompare);
+        ListNodeBase& head = this->LinkedListCore.NodeBase;
+        if (head.PointerNext == &head)
+        {
+            return;
+        }
+
+        SizeTypeAlias nodeWalks = 0;
+        ListNodeBase* sorted = head.PointerNext;
+        while (sorted->PointerNext != &head)
+        {
+            ListNodeBase* node = sorted->PointerNext;
+            const ValueTypeAlias& value = *static_cast<NodeAlias*>(node)->GetData();
+            if (!compare(value, *static_cast<NodeAlias*>(sorted)->GetData()))
+            {
+                sorted = node;
+                continue;
+            }
+
+            ListNodeBase* position = sorted->PointerPrev;
+            while (position != &head && compare(value, *static_cast<NodeAlias*>(position)->GetData()))
+            {
+                position = position->PointerPrev;
+                ++nodeWalks;
+            }
+            node->UnhookInternal();
+            node->HookInternal(position->PointerNext);
+        }
+        Utilities::InstrumentationHooks<List>::OnNodeWalks(nodeWalks);
+    }
+
+    /**
+     * @brief Sort with the strategy that suits the input; see Utilities::AdaptiveSortList. Not stable.
+     * @return The strategy used.
+     */
+    template <typename TCompare> Utilities::SortStrategy AdaptiveSort(TCompare userCompare)
+    {
+        return Utilities::AdaptiveSortList(*this, userCompare, Utilities::InstrumentCompare<List>(userCompare));
+    }
+
+    /**
+     * @brief Choice 1 is insertion sort and 6 AdaptiveSort; List has no selection, bubble, quick or heap sort, so every
+     * other choice merge sorts.
+     */
+    template <typename TCompare> void DSASort(unsigned choice, TCompare userCompare)
+    {
+        switch (choice)
+        {
+        case 1:
+            this->InsertionSort(userCompare);
+            break;
+        case 6:
+            this->AdaptiveSort(userCompare);
+            break;
+        default:
+            this->Sort(userCompare);
+            break;
+        }
     }
 
     void Reverse() noexcept
@@ -680,6 +879,70 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
         this->LinkedListCore.NodeBase.ReverseAfterInternal();
     }
 
+    /**
+     * @brief Move every element into one slab of nodes laid out in iteration order and relink them, so later scans
+     * walk memory front to back. Invalidates iterators; if an element's move throws, the list is unchanged.
+     */
+    void Compact()
+    {
+        const SizeTypeAlias size = this->GetSize();
+        if (size == 0)
+        {
+            return;
+        }
+        ListNodeBase& head = this->LinkedListCore.NodeBase;
+        NodeAlias* slab = this->MoveToSlabInternal(head.PointerNext, size);
+        this->ClearInternal();
+        this->InitInternal();
+        this->LinkNodesBeforeInternal(&head, slab, size);
+    }
+
+    /** @brief Fraction of links that jump elsewhere in memory instead of to the adjacent node; 0 after Compact. */
+    [[nodiscard]] double GetScatter() const noexcept
+    {
+        const ListNodeBase& head = this->LinkedListCore.NodeBase;
+        Utilities::NodeScatter<NodeAlias> scatter;
+        for (const ListNodeBase* node = head.PointerNext; node != &head; node = node->PointerNext)
+        {
+            scatter.Visit(static_cast<const NodeAlias*>(node));
+        }
+        return scatter.GetScatter();
+    }
+
+    /**
+     * @brief Keep up to limit erased nodes for reuse by later inserts instead of freeing them. 0, the default, turns
+     * recycling off; lowering the limit frees the surplus.
+     */
+    void SetNodeCacheLimit(SizeTypeAlias limit) noexcept
+    {
+        this->SetNodePoolLimitInternal(limit);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetNodeCacheLimit() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetLimit();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCachedNodeCount() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetCount();
+    }
+
+    /**
+     * @brief Cache at least count spare nodes, allocated together in one call, so the next count inserts do not
+     * allocate. Raises the cache limit to count if it is lower.
+     */
+    void Reserve(SizeTypeAlias count)
+    {
+        this->ReserveNodesInternal(count);
+    }
+
+    /** @brief Free every cached node. The cache limit is kept. */
+    void ShrinkToFit() noexcept
+    {
+        this->ReleaseNodePoolInternal();
+    }
+
     void Swap(List& list) noexcept
     {
         ::DSALibraries::Containers::ListNodeBase::Swap(this->LinkedListCore.NodeBase, list.LinkedListCore.NodeBase);
@@ -694,21 +957,50 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
   private:
     void DefaultInitializeInternal(SizeTypeAlias size)
     {
-        SizeTypeAlias i = 0;
-        try
+        if (size != 0)
         {
-            for (; i < size; ++i)
-            {
-                EmplaceBack();
-            }
+            NodeAlias* nodes =
+                this->CreateNodesInternal(size, [this](T* data) { this->GetTpAllocatorInternal().construct(data); });
+            this->LinkNodesBeforeInternal(&this->LinkedListCore.NodeBase, nodes, size);
         }
-        catch (...)
+    }
+
+    /**
+     * @brief Chèn size bản sao của value trước position, các nút được cấp phát trong một slab
+     *
+     * @param position
+     * @param size
+     * @param value
+     */
+    void FillInsertInternal(ListNodeBase* position, SizeTypeAlias size, const ValueTypeAlias& value)
+    {
+        if (size != 0)
         {
-            for (; i > 0; --i)
-            {
-                PopBack();
-            }
-            throw;
+            NodeAlias* nodes = this->CreateNodesInternal(
+                size, [this, &value](T* data) { this->GetTpAllocatorInternal().construct(data, value); });
+            this->LinkNodesBeforeInternal(position, nodes, size);
+        }
+    }
+
+    /**
+     * @brief Chèn phạm vi [begin, end) trước position, các nút được cấp phát trong một slab
+     *
+     * @tparam ForwardIterator
+     * @param position
+     * @param begin
+     * @param end
+     */
+    template <typename ForwardIterator>
+    void RangeInsertInternal(ListNodeBase* position, ForwardIterator begin, ForwardIterator end)
+    {
+        const auto size = static_cast<SizeTypeAlias>(std::distance(begin, end));
+        if (size != 0)
+        {
+            NodeAlias* nodes = this->CreateNodesInternal(size, [this, &begin](T* data) {
+                this->GetTpAllocatorInternal().construct(data, *begin);
+                ++begin;
+            });
+            this->LinkNodesBeforeInternal(position, nodes, size);
         }
     }
 
@@ -720,10 +1012,7 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
      */
     void FillInitializeInternal(SizeTypeAlias size, const ValueTypeAlias& value)
     {
-        for (; size > 0; --size)
-        {
-            PushBack(value);
-        }
+        FillInsertInternal(&this->LinkedListCore.NodeBase, size, value);
     }
 
     /**
@@ -733,12 +1022,18 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
      * @param begin
      * @param end
      */
-    void RangeInitalizeInternal(IteratorAlias begin, IteratorAlias end)
+    template <typename InputIterator> void RangeInitalizeInternal(InputIterator begin, InputIterator end)
     {
-
-        for (; begin != end; ++begin)
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            PushBack(*begin);
+            RangeInsertInternal(&this->LinkedListCore.NodeBase, begin, end);
+        }
+        else
+        {
+            for (; begin != end; ++begin)
+            {
+                PushBack(*begin);
+            }
         }
     }
 
@@ -808,6 +1103,81 @@ template <typename T, typename Alloc = Allocator<T>> class List : protected List
         return;
     }
 
+    /**
+     * @brief Nối các nút của count danh sách đã sắp xếp sources(i) vào danh sách này, chính là sources(0)
+     *
+     * Mỗi chuỗi kết thúc khi quay về nút đầu của danh sách nguồn. Nếu compare ném ngoại lệ, các nút chưa trộn được
+     * nối vào cuối theo thứ tự cũ nên không nút nào bị mất.
+     *
+     * @tparam TSources
+     * @tparam TCompare
+     * @param sources
+     * @param count
+     * @param compare
+     */
+    template <typename TSources, typename TCompare>
+    void MergeAllInternal(TSources sources, SizeTypeAlias count, TCompare compare)
+    {
+        auto byValue = [&compare](const ListNodeBase* lhs, const ListNodeBase* rhs) {
+            return compare(*static_cast<const NodeAlias*>(lhs)->GetData(),
+                           *static_cast<const NodeAlias*>(rhs)->GetData());
+        };
+        LoserTree<ListNodeBase*, decltype(byValue)> tree(count, byValue);
+        Vector<ListNodeBase*> heads(count, nullptr);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            List* list = sources(i);
+            ListNodeBase* head = &list->LinkedListCore.NodeBase;
+            if (head->PointerNext != head)
+            {
+                heads[i] = head->PointerNext;
+                list->InitInternal();
+                tree.SetSource(i, heads[i]);
+            }
+        }
+
+        ListNodeBase* tail = &this->LinkedListCore.NodeBase;
+        auto append = [&tail](ListNodeBase* node) {
+            tail->PointerNext = node;
+            node->PointerPrev = tail;
+            tail = node;
+        };
+        try
+        {
+            tree.Build();
+            while (!tree.IsEmpty())
+            {
+                const SizeTypeAlias winner = tree.GetWinner();
+                ListNodeBase* node = heads[winner];
+                append(node);
+                heads[winner] = node->PointerNext;
+                if (heads[winner] != &sources(winner)->LinkedListCore.NodeBase)
+                {
+                    tree.ReplaceTop(heads[winner]);
+                }
+                else
+                {
+                    heads[winner] = nullptr;
+                    tree.PopTop();
+                }
+            }
+        }
+        catch (...)
+        {
+            for (SizeTypeAlias i = 0; i < count; ++i)
+            {
+                ListNodeBase* end = &sources(i)->LinkedListCore.NodeBase;
+                for (ListNodeBase* node = heads[i]; node != nullptr && node != end; node = node->PointerNext)
+                {
+                    append(node);
+                }
+            }
+            append(&this->LinkedListCore.NodeBase);
+            throw;
+        }
+        append(&this->LinkedListCore.NodeBase);
+    }
+
     void EraseInternal(IteratorAlias position)
     {
         position.NodeBase->UnhookInternal();
@@ -1,5 +1,6 @@
 #include <bits/stdc++.h>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #ifndef DSA_LIBRARIES_LIST_NODE_HPP
 #define DSA_LIBRARIES_LIST_NODE_HPP 1
@@ -80,6 +81,8 @@ struct ListNodeBase
 
 template <typename T> struct ListNode : public ListNodeBase
 {
+    /** 1-based position in the NodeSlabs slab the node was allocated from; 0 when it was allocated on its own. */
+    std::uint32_t SlabIndex = 0;
     alignas(T) std::byte Data[sizeof(T)];
 
     ListNode() = default;
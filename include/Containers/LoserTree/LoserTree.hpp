@@ -0,0 +1,227 @@
+#ifndef DSA_LIBRARIES_LOSER_TREE_HPP
+#define DSA_LIBRARIES_LOSER_TREE_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../Vector/Vector.hpp"
+#include "LoserTreeExceptions.hpp"
+#include <cstddef>
+#include <functional>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Tournament tree for k-way merging: the head of each of k sources sits in a leaf, and every inner node keeps
+ * the loser of the match played there.
+ *
+ * Replacing the winner replays only its path to the root, one comparison per level against the stored loser, so each
+ * element of a k-way merge costs ceil(log2 k) comparisons, about half of what a binary heap's sift-down needs. Equal
+ * heads go to the lower source index, so merging runs in source order is stable.
+ */
+template <typename T, typename TCompare = std::less<T>, typename Alloc = Utilities::Allocator<T>> class LoserTree
+{
+  public:
+    using ValueTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using CompareAlias = TCompare;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+
+  private:
+    using IndexAllocatorAlias = typename std::allocator_traits<Alloc>::template rebind_alloc<SizeTypeAlias>;
+    using FlagAllocatorAlias = typename std::allocator_traits<Alloc>::template rebind_alloc<unsigned char>;
+
+    Vector<T, Alloc> _heads;
+    Vector<unsigned char, FlagAllocatorAlias> _isExhausted;
+    // _tree[0] is the winner, _tree[1..k) the losers; leaf i sits at position k + i.
+    Vector<SizeTypeAlias, IndexAllocatorAlias> _tree;
+    CompareAlias _compare;
+    SizeTypeAlias _active = 0;
+
+  public:
+    /**
+     * @param count Number of sources. Every source starts exhausted until SetSource gives it a head.
+     */
+    explicit LoserTree(SizeTypeAlias count, const CompareAlias &compare = CompareAlias())
+        : _heads(count), _isExhausted(count, 1), _tree(count > 0 ? count : 1, 0), _compare(compare)
+    {
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSourceCount() const noexcept
+    {
+        return _heads.GetSize();
+    }
+
+    /** Sources that still have a head. */
+    [[nodiscard]] SizeTypeAlias GetActiveCount() const noexcept
+    {
+        return _active;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _active == 0;
+    }
+
+    /**
+     * @brief Give source its first head. Call for every non-empty source, then Build.
+     */
+    void SetSource(SizeTypeAlias source, ValueTypeAlias value)
+    {
+        if (source >= _heads.GetSize())
+        {
+            throw LoserTreeOutOfBoundsException(__FILE__, __LINE__);
+        }
+        _heads[source] = std::move(value);
+        if (_isExhausted[source])
+        {
+            _isExhausted[source] = 0;
+            ++_active;
+        }
+    }
+
+    /**
+     * @brief Play every match from the leaves up; k - 1 comparisons.
+     */
+    void Build()
+    {
+        const SizeTypeAlias count = _heads.GetSize();
+        if (count == 0)
+        {
+            return;
+        }
+        Vector<SizeTypeAlias, IndexAllocatorAlias> winners(2 * count, 0);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            winners[count + i] = i;
+        }
+        for (SizeTypeAlias node = count - 1; node > 0; --node)
+        {
+            const SizeTypeAlias left = winners[2 * node];
+            const SizeTypeAlias right = winners[2 * node + 1];
+            const bool isLeftWinner = this->BeatsInternal(left, right);
+            winners[node] = isLeftWinner ? left : right;
+            _tree[node] = isLeftWinner ? right : left;
+        }
+        _tree[0] = count == 1 ? 0 : winners[1];
+    }
+
+    /** Source of the current least head. */
+    [[nodiscard]] SizeTypeAlias GetWinner() const
+    {
+        if (_active == 0)
+        {
+            throw LoserTreeEmptyException(__FILE__, __LINE__);
+        }
+        return _tree[0];
+    }
+
+    [[nodiscard]] const ValueTypeAlias &GetTop() const
+    {
+        return _heads[this->GetWinner()];
+    }
+
+    /**
+     * @brief Move the least head out; the caller refills its source with ReplaceTop or ends it with PopTop.
+     */
+    [[nodiscard]] ValueTypeAlias TakeTop()
+    {
+        return std::move(_heads[this->GetWinner()]);
+    }
+
+    /**
+     * @brief The winning source's next element takes its place.
+     */
+    void ReplaceTop(ValueTypeAlias value)
+    {
+        const SizeTypeAlias winner = this->GetWinner();
+        _heads[winner] = std::move(value);
+        this->ReplayInternal(winner);
+    }
+
+    /**
+     * @brief The winning source is exhausted.
+     */
+    void PopTop()
+    {
+        const SizeTypeAlias winner = this->GetWinner();
+        _isExhausted[winner] = 1;
+        --_active;
+        this->ReplayInternal(winner);
+    }
+
+  private:
+    bool BeatsInternal(SizeTypeAlias lhs, SizeTypeAlias rhs)
+    {
+        if (_isExhausted[lhs] || _isExhausted[rhs])
+        {
+            return !_isExhausted[lhs] || (_isExhausted[rhs] && lhs < rhs);
+        }
+        if (_compare(_heads[lhs], _heads[rhs]))
+        {
+            return true;
+        }
+        return lhs < rhs && !_compare(_heads[rhs], _heads[lhs]);
+    }
+
+    void ReplayInternal(SizeTypeAlias source)
+    {
+        const SizeTypeAlias count = _heads.GetSize();
+        SizeTypeAlias winner = source;
+        for (SizeTypeAlias node = (count + source) / 2; node > 0; node /= 2)
+        {
+            if (this->BeatsInternal(_tree[node], winner))
+            {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+};
+
+/**
+ * @brief k-way merge of sorted [first, second) ranges into output through a LoserTree of iterators, so each element is
+ * copied once and costs ceil(log2 k) comparisons. Equal elements keep the order of their ranges.
+ * @return The end of the merged output.
+ */
+template <typename TIterator, typename TRangeAlloc, typename TOutputIterator, typename TCompare>
+TOutputIterator MergeRanges(const Vector<std::pair<TIterator, TIterator>, TRangeAlloc> &ranges, TOutputIterator output,
+                            TCompare compare)
+{
+    auto byValue = [&compare](const TIterator &lhs, const TIterator &rhs) { return compare(*lhs, *rhs); };
+    const std::size_t count = ranges.GetSize();
+    LoserTree<TIterator, decltype(byValue)> tree(count, byValue);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (ranges[i].first != ranges[i].second)
+        {
+            tree.SetSource(i, ranges[i].first);
+        }
+    }
+    tree.Build();
+
+    while (!tree.IsEmpty())
+    {
+        const std::size_t winner = tree.GetWinner();
+        TIterator next = tree.GetTop();
+        *output = *next;
+        ++output;
+        if (++next != ranges[winner].second)
+        {
+            tree.ReplaceTop(next);
+        }
+        else
+        {
+            tree.PopTop();
+        }
+    }
+    return output;
+}
+
+template <typename TIterator, typename TRangeAlloc, typename TOutputIterator>
+TOutputIterator MergeRanges(const Vector<std::pair<TIterator, TIterator>, TRangeAlloc> &ranges, TOutputIterator output)
+{
+    return MergeRanges(ranges, output, std::less<>());
+}
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_LOSER_TREE_HPP
@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_LOSER_TREE_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_LOSER_TREE_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class LoserTreeException : public Utilities::Exception
+{
+  public:
+    LoserTreeException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class LoserTreeEmptyException : public LoserTreeException
+{
+  public:
+    LoserTreeEmptyException(string_type fileText, numeric_type line)
+        : LoserTreeException("Every source of the loser tree is exhausted", std::move(fileText), line)
+    {
+    }
+};
+class LoserTreeOutOfBoundsException : public LoserTreeException
+{
+  public:
+    LoserTreeOutOfBoundsException(string_type fileText, numeric_type line)
+        : LoserTreeException("Source index out of bounds", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,187 @@
+#ifndef DSA_LIBRARIES_PRIORITY_QUEUE_HPP
+#define DSA_LIBRARIES_PRIORITY_QUEUE_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../Vector/Vector.hpp"
+#include "PriorityQueueExceptions.hpp"
+#include <cstddef>
+#include <functional>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Binary heap on top of a Vector. GetTop returns the element that compares greatest, so std::greater gives a
+ * min-queue.
+ */
+template <typename T, typename TCompare = std::less<T>, typename Alloc = Utilities::Allocator<T>> class PriorityQueue
+{
+  public:
+    using ValueTypeAlias = T;
+    using ReferenceAlias = T &;
+    using ConstReferenceAlias = const T &;
+    using SizeTypeAlias = std::size_t;
+    using CompareAlias = TCompare;
+    using ContainerAlias = Vector<T, Alloc>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using const_reference = ConstReferenceAlias;
+    using size_type = SizeTypeAlias;
+
+  private:
+    ContainerAlias _heap;
+    CompareAlias _compare;
+
+  public:
+    PriorityQueue() = default;
+
+    explicit PriorityQueue(const CompareAlias &compare, const Alloc &alloc = Alloc()) : _heap(alloc), _compare(compare)
+    {
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _heap.IsEmpty();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _heap.GetSize();
+    }
+
+    void Reserve(SizeTypeAlias capacity)
+    {
+        _heap.Reverse(capacity);
+    }
+
+    [[nodiscard]] ConstReferenceAlias GetTop() const
+    {
+        if (_heap.IsEmpty())
+        {
+            throw PriorityQueueEmptyException(__FILE__, __LINE__);
+        }
+        return _heap[0];
+    }
+
+    void Push(const ValueTypeAlias &value)
+    {
+        _heap.PushBack(value);
+        this->SiftUpInternal(_heap.GetSize() - 1);
+    }
+
+    void Push(ValueTypeAlias &&value)
+    {
+        _heap.PushBack(std::move(value));
+        this->SiftUpInternal(_heap.GetSize() - 1);
+    }
+
+    template <typename... Args> void Emplace(Args &&...args)
+    {
+        _heap.EmplaceBack(std::forward<Args>(args)...);
+        this->SiftUpInternal(_heap.GetSize() - 1);
+    }
+
+    void Pop()
+    {
+        if (_heap.IsEmpty())
+        {
+            throw PriorityQueueEmptyException(__FILE__, __LINE__);
+        }
+        const SizeTypeAlias last = _heap.GetSize() - 1;
+        if (last > 0)
+        {
+            _heap[0] = std::move(_heap[last]);
+        }
+        _heap.PopBack();
+        if (!_heap.IsEmpty())
+        {
+            this->SiftDownInternal(0);
+        }
+    }
+
+    /**
+     * @brief Move the top element out and remove it.
+     */
+    ValueTypeAlias PopTop()
+    {
+        if (_heap.IsEmpty())
+        {
+            throw PriorityQueueEmptyException(__FILE__, __LINE__);
+        }
+        ValueTypeAlias top = std::move(_heap[0]);
+        this->Pop();
+        return top;
+    }
+
+    /**
+     * @brief Replace the top element and restore the heap with a single sift-down, cheaper than Pop followed by Push.
+     */
+    void ReplaceTop(ValueTypeAlias value)
+    {
+        if (_heap.IsEmpty())
+        {
+            throw PriorityQueueEmptyException(__FILE__, __LINE__);
+        }
+        _heap[0] = std::move(value);
+        this->SiftDownInternal(0);
+    }
+
+    void Clear() noexcept
+    {
+        _heap.Clear();
+    }
+
+    /**
+     * @brief Hand the underlying storage over in heap order and leave the queue empty.
+     */
+    ContainerAlias Release() noexcept
+    {
+        ContainerAlias released;
+        released.Swap(_heap);
+        return released;
+    }
+
+  protected:
+    void SiftUpInternal(SizeTypeAlias index)
+    {
+        ValueTypeAlias value = std::move(_heap[index]);
+        while (index > 0)
+        {
+            const SizeTypeAlias parent = (index - 1) / 2;
+            if (!_compare(_heap[parent], value))
+            {
+                break;
+            }
+            _heap[index] = std::move(_heap[parent]);
+            index = parent;
+        }
+        _heap[index] = std::move(value);
+    }
+
+    void SiftDownInternal(SizeTypeAlias index)
+    {
+        const SizeTypeAlias size = _heap.GetSize();
+        ValueTypeAlias value = std::move(_heap[index]);
+        while (true)
+        {
+            SizeTypeAlias child = 2 * index + 1;
+            if (child >= size)
+            {
+                break;
+            }
+            if (child + 1 < size && _compare(_heap[child], _heap[child + 1]))
+            {
+                ++child;
+            }
+            if (!_compare(value, _heap[child]))
+            {
+                break;
+            }
+            _heap[index] = std::move(_heap[child]);
+            index = child;
+        }
+        _heap[index] = std::move(value);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_PRIORITY_QUEUE_HPP
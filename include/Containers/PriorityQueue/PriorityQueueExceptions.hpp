@@ -0,0 +1,23 @@
+#ifndef DSA_LIBRARIES_PRIORITY_QUEUE_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_PRIORITY_QUEUE_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class PriorityQueueException : public Utilities::Exception
+{
+  public:
+    PriorityQueueException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class PriorityQueueEmptyException : public PriorityQueueException
+{
+  public:
+    PriorityQueueEmptyException(string_type fileText, numeric_type line)
+        : PriorityQueueException("Priority queue is empty", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,122 @@
+#ifndef DSA_LIBRARIES_TOP_K_HPP
+#define DSA_LIBRARIES_TOP_K_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "../Vector/Vector.hpp"
+#include "PriorityQueue.hpp"
+#include <cstddef>
+#include <functional>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief The count least elements of a stream under TCompare, e.g. the best count scores with std::greater.
+ *
+ * A heap of the kept elements has the worst of them on top, so an element that does not make the cut costs one
+ * comparison and one that does costs a single sift-down: O(n log k) for the stream, O(k) memory.
+ */
+template <typename T, typename TCompare = std::less<T>, typename Alloc = Utilities::Allocator<T>> class TopK
+{
+  public:
+    using ValueTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using CompareAlias = TCompare;
+    using ContainerAlias = Vector<T, Alloc>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+
+  private:
+    PriorityQueue<T, TCompare, Alloc> _heap;
+    CompareAlias _compare;
+    SizeTypeAlias _capacity;
+
+  public:
+    explicit TopK(SizeTypeAlias count, const CompareAlias &compare = CompareAlias(), const Alloc &alloc = Alloc())
+        : _heap(compare, alloc), _compare(compare), _capacity(count)
+    {
+        _heap.Reserve(count);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _heap.GetSize();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCapacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    [[nodiscard]] bool IsFull() const noexcept
+    {
+        return _heap.GetSize() == _capacity;
+    }
+
+    /**
+     * @brief The worst element kept, which a new element must beat once the selection is full.
+     */
+    [[nodiscard]] const ValueTypeAlias &GetThreshold() const
+    {
+        return _heap.GetTop();
+    }
+
+    /**
+     * @return true if value was kept.
+     */
+    bool Push(const ValueTypeAlias &value)
+    {
+        if (!this->IsFull())
+        {
+            _heap.Push(value);
+            return true;
+        }
+        if (_capacity == 0 || !_compare(value, _heap.GetTop()))
+        {
+            return false;
+        }
+        _heap.ReplaceTop(value);
+        return true;
+    }
+
+    bool Push(ValueTypeAlias &&value)
+    {
+        if (!this->IsFull())
+        {
+            _heap.Push(std::move(value));
+            return true;
+        }
+        if (_capacity == 0 || !_compare(value, _heap.GetTop()))
+        {
+            return false;
+        }
+        _heap.ReplaceTop(std::move(value));
+        return true;
+    }
+
+    template <typename TIterator> void PushRange(TIterator first, TIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            this->Push(*first);
+        }
+    }
+
+    void Clear() noexcept
+    {
+        _heap.Clear();
+    }
+
+    /**
+     * @brief Hand the kept elements over, best first, and leave the selection empty.
+     */
+    ContainerAlias TakeSorted()
+    {
+        ContainerAlias sorted = _heap.Release();
+        Utilities::IntroSortRange(sorted.GetBegin(), sorted.GetEnd(), _compare);
+        return sorted;
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_TOP_K_HPP
@@ -1,27 +1,41 @@
 #ifndef DSA_LIBRARIES_SLIST_HPP
 #define DSA_LIBRARIES_SLIST_HPP
 #include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Instrumentation.hpp"
+#include "../../Utilities/NodePool.hpp"
+#include "../../Utilities/NodeSlabs.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "../LoserTree/LoserTree.hpp"
 #include "SListIterator.hpp"
 #include "SListNode.hpp"
 #include <algorithm>
 #include <cstddef>
+#include <exception>
+#include <iterator>
 #include <memory>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
 using namespace DSALibraries::Utilities;
 namespace DSALibraries::Containers
 {
+template <typename T, typename Alloc> class SList;
+
 template <typename T, typename Alloc> class SListBase
 {
   protected:
     using TypeAllocatorTraitsAlias = std::allocator_traits<Alloc>;
     using NodeAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<SListNode<T>>;
     using TpAllocatorTypeAlias = typename TypeAllocatorTraitsAlias::template rebind_alloc<T>;
+    using NodeSlabsAlias = Utilities::NodeSlabs<SListNode<T>, NodeAllocatorTypeAlias>;
 
     struct SListCore : public NodeAllocatorTypeAlias
     {
         SListNodeBase NodeHead;
+        // Last node, or &NodeHead when empty, so PushBack and SpliceBack are O(1).
+        SListNodeBase* NodeTail = &NodeHead;
+        Utilities::NodePool<SListNode<T>, NodeAllocatorTypeAlias> Pool;
 
         SListCore() : NodeAllocatorTypeAlias(), NodeHead()
         {
@@ -75,6 +89,7 @@ template <typename T, typename Alloc> class SListBase
     SListBase(SListBase&& list, NodeAllocatorTypeAlias&& al, std::true_type) noexcept
         : LinkedListCore(std::move(list.LinkedListCore.NodeHead), std::move(al))
     {
+        this->TakeTailInternal(list);
     }
 
     SListBase(SListBase&& list, NodeAllocatorTypeAlias&& al) noexcept : LinkedListCore(std::move(al))
@@ -82,15 +97,37 @@ template <typename T, typename Alloc> class SListBase
         if (list.GetNodeAllocator() == this->GetNodeAllocator())
         {
             this->LinkedListCore.NodeHead = std::move(list.LinkedListCore.NodeHead);
+            this->TakeTailInternal(list);
         }
     }
 
     ~SListBase() noexcept
     {
         EraseAfterInternal(&LinkedListCore.NodeHead, nullptr);
+        this->ReleaseNodePoolInternal();
     }
 
   protected:
+    /** Called once the head of list has been moved into this empty list: take its tail too. */
+    void TakeTailInternal(SListBase& list) noexcept
+    {
+        if (this->LinkedListCore.NodeHead.PointerNext != nullptr)
+        {
+            this->LinkedListCore.NodeTail = list.LinkedListCore.NodeTail;
+            list.LinkedListCore.NodeTail = &list.LinkedListCore.NodeHead;
+        }
+    }
+
+    /** Set the tail by walking on from node, which is the last node already when the caller knows it. */
+    void ResetTailInternal(NodeBaseAlias* node) noexcept
+    {
+        while (node->PointerNext != nullptr)
+        {
+            node = node->PointerNext;
+        }
+        this->LinkedListCore.NodeTail = node;
+    }
+
     template <typename... Args> NodeBaseAlias* InsertAfterInternal(ConstIteratorAlias pos, Args&&... args)
     {
         auto* curr = const_cast<NodeBaseAlias*>(pos.NodeBase);
@@ -101,6 +138,11 @@ template <typename T, typename Alloc> class SListBase
 
         curr->PointerNext = newNode;
 
+        if (this->LinkedListCore.NodeTail == curr)
+        {
+            this->LinkedListCore.NodeTail = newNode;
+        }
+
         return curr->PointerNext;
     }
 
@@ -110,6 +152,11 @@ template <typename T, typename Alloc> class SListBase
 
         pos->PointerNext = curr->PointerNext;
 
+        if (this->LinkedListCore.NodeTail == curr)
+        {
+            this->LinkedListCore.NodeTail = pos;
+        }
+
         this->GetTpAllocator().destroy(curr->GetData());
 
         curr->~NodeAlias();
@@ -136,17 +183,130 @@ template <typename T, typename Alloc> class SListBase
         }
 
         pos->PointerNext = last;
+        if (last == nullptr)
+        {
+            this->LinkedListCore.NodeTail = pos;
+        }
         return last;
     }
 
     NodeAlias* GetNode()
     {
-        return static_cast<NodeAlias*>(this->LinkedListCore.NodeAllocatorTypeAlias::allocate(1));
+        if (NodeAlias* node = this->LinkedListCore.Pool.Pop())
+        {
+            return node;
+        }
+        NodeAlias* node = NodeSlabsAlias::AllocateOne(this->GetNodeAllocator());
+        Utilities::InstrumentationHooks<SList<T, Alloc>>::OnAllocation(sizeof(NodeAlias));
+        return node;
     }
 
     void PutNode(SListNode<T>* node)
     {
-        this->LinkedListCore.NodeAllocatorTypeAlias::deallocate(node, 1);
+        if (this->LinkedListCore.Pool.Push(node))
+        {
+            return;
+        }
+        ReportNodesFreedInternal(NodeSlabsAlias::Deallocate(this->GetNodeAllocator(), node));
+    }
+
+    void ReserveNodesInternal(std::size_t count)
+    {
+        if (const std::size_t bytes = this->LinkedListCore.Pool.Reserve(this->GetNodeAllocator(), count))
+        {
+            Utilities::InstrumentationHooks<SList<T, Alloc>>::OnAllocation(bytes);
+        }
+    }
+
+    void SetNodePoolLimitInternal(std::size_t limit) noexcept
+    {
+        this->LinkedListCore.Pool.SetLimit(this->GetNodeAllocator(), limit, &ReportNodesFreedInternal);
+    }
+
+    void ReleaseNodePoolInternal() noexcept
+    {
+        this->LinkedListCore.Pool.Release(this->GetNodeAllocator(), &ReportNodesFreedInternal);
+    }
+
+    /** Report one allocator call per lone node or slab given back; bytes is 0 while a node's slab is in use. */
+    static void ReportNodesFreedInternal(std::size_t bytes) noexcept
+    {
+        if (bytes != 0)
+        {
+            Utilities::InstrumentationHooks<SList<T, Alloc>>::OnDeallocation(bytes);
+        }
+    }
+
+    /** Allocate size contiguous nodes: one slab, or a single, possibly cached, node when size is 1. */
+    NodeAlias* AllocateNodesInternal(std::size_t size)
+    {
+        if (size == 1)
+        {
+            return this->GetNode();
+        }
+        NodeAlias* slab = NodeSlabsAlias::Allocate(this->GetNodeAllocator(), size);
+        Utilities::InstrumentationHooks<SList<T, Alloc>>::OnAllocation(NodeSlabsAlias::GetSlabBytes(size));
+        return slab;
+    }
+
+    /**
+     * Allocate size contiguous nodes and construct their elements in order by calling construct with each element's
+     * storage. The nodes are returned unlinked. On exception the built elements are destroyed and every node is
+     * released, so the list is left as it was.
+     */
+    template <typename TConstruct> NodeAlias* CreateNodesInternal(std::size_t size, TConstruct construct)
+    {
+        NodeAlias* nodes = this->AllocateNodesInternal(size);
+        std::size_t built = 0;
+        try
+        {
+            for (; built < size; ++built)
+            {
+                construct(nodes[built].GetData());
+            }
+        }
+        catch (...)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (i < built)
+                {
+                    this->GetTpAllocator().destroy(nodes[i].GetData());
+                }
+                this->PutNode(nodes + i);
+            }
+            throw;
+        }
+        return nodes;
+    }
+
+    /** Link size contiguous nodes behind pos in order and return the last one. */
+    NodeBaseAlias* LinkNodesAfterInternal(NodeBaseAlias* pos, NodeAlias* nodes, std::size_t size) noexcept
+    {
+        for (std::size_t i = 0; i + 1 < size; ++i)
+        {
+            nodes[i].PointerNext = nodes + i + 1;
+        }
+        NodeAlias* last = nodes + size - 1;
+        last->PointerNext = pos->PointerNext;
+        pos->PointerNext = nodes;
+        if (this->LinkedListCore.NodeTail == pos)
+        {
+            this->LinkedListCore.NodeTail = last;
+        }
+        return last;
+    }
+
+    /**
+     * Move the size elements starting at first into new contiguous nodes, in order, and return them unlinked. On
+     * exception the nodes are released and the source elements are left as move_if_noexcept left them.
+     */
+    NodeAlias* MoveToSlabInternal(NodeBaseAlias* first, std::size_t size)
+    {
+        return this->CreateNodesInternal(size, [this, &first](T* data) {
+            this->GetTpAllocator().construct(data, std::move_if_noexcept(*static_cast<NodeAlias*>(first)->GetData()));
+            first = first->PointerNext;
+        });
     }
 
     template <typename... Args> NodeAlias* CreateNodeInternal(Args&&... args)
@@ -160,6 +320,7 @@ template <typename T, typename Alloc> class SListBase
         catch (...)
         {
             this->PutNode(node);
+            throw;
         }
         return node;
     }
@@ -175,6 +336,7 @@ template <typename T, typename Alloc> class SListBase
         catch (...)
         {
             this->PutNode(node);
+            throw;
         }
         return node;
     }
@@ -208,6 +370,9 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
     using allocator_type [[maybe_unused]] = AllocatorTypeAlias;
 
   private:
+    /** Smallest chunk ParallelSort hands to a thread; below it the thread costs more than it saves. */
+    static constexpr SizeTypeAlias ParallelSortChunkMinimum = 4096;
+
     SList(SList&& sll, NodeAllocatorTypeAlias&& al, std::true_type) : SListBaseAlias(std::move(sll), std::move(al))
     {
     }
@@ -413,6 +578,42 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         this->InsertAfterInternal(this->GetBeginFromHead(), std::forward<Args>(args)...);
     }
 
+    /** @brief Iterator to the last element, or GetBeginFromHead() when empty; O(1). */
+    IteratorAlias GetBeforeEnd() noexcept
+    {
+        return IteratorAlias(this->LinkedListCore.NodeTail);
+    }
+
+    ConstIteratorAlias GetConstBeforeEnd() const noexcept
+    {
+        return ConstIteratorAlias(this->LinkedListCore.NodeTail);
+    }
+
+    ReferenceAlias GetItemBack()
+    {
+        return *static_cast<NodeAlias*>(this->LinkedListCore.NodeTail)->GetData();
+    }
+
+    ConstReferenceAlias GetItemBack() const
+    {
+        return *static_cast<const NodeAlias*>(this->LinkedListCore.NodeTail)->GetData();
+    }
+
+    void PushBack(const T& value)
+    {
+        this->InsertAfterInternal(this->GetConstBeforeEnd(), value);
+    }
+
+    void PushBack(T&& value)
+    {
+        this->InsertAfterInternal(this->GetConstBeforeEnd(), std::move(value));
+    }
+
+    template <typename... Args> void EmplaceBack(Args&&... args)
+    {
+        this->InsertAfterInternal(this->GetConstBeforeEnd(), std::forward<Args>(args)...);
+    }
+
     template <typename... Args> IteratorAlias EmplaceAfter(ConstIteratorAlias pos, Args&&... args)
     {
         return IteratorAlias(this->InsertAfterInternal(pos, std::forward<Args>(args)...));
@@ -442,29 +643,28 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
 
     IteratorAlias InsertAfter(ConstIteratorAlias pos, SizeTypeAlias size, const T& value)
     {
-        if (size)
-        {
-            SList temp(size, value, this->GetNodeAllocator());
-            return this->SpliceAfterInternal(pos, temp.GetBeginFromHead(), temp.GetConstEnd());
-        }
-        else
-        {
-            return IteratorAlias(const_cast<NodeBaseAlias*>(pos.NodeBase));
-        }
+        return IteratorAlias(this->FillInsertAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase), size, value));
     }
 
     template <typename InputIterator>
     IteratorAlias InsertAfter(ConstIteratorAlias pos, InputIterator first, InputIterator last)
     {
-        SList temp(first, last, this->GetNodeAllocator());
-
-        if (!temp.IsEmpty())
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            return this->SpliceAfterInternal(pos, temp.GetBeginFromHead(), temp.GetConstEnd());
+            return IteratorAlias(this->RangeInsertAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase), first, last));
         }
         else
         {
-            return IteratorAlias(const_cast<NodeBaseAlias*>(pos.NodeBase));
+            SList temp(first, last, this->GetNodeAllocator());
+
+            if (!temp.IsEmpty())
+            {
+                return this->SpliceAfterInternal(pos, temp.GetBeginFromHead(), temp.GetConstEnd());
+            }
+            else
+            {
+                return IteratorAlias(const_cast<NodeBaseAlias*>(pos.NodeBase));
+            }
         }
     }
 
@@ -473,6 +673,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         if (!sll.IsEmpty())
         {
             this->SpliceAfterInternal(pos, sll.GetBeginFromHead(), sll.GetEnd());
+            sll.LinkedListCore.NodeTail = &sll.LinkedListCore.NodeHead;
         }
     }
 
@@ -487,11 +688,24 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         }
 
         auto* current = const_cast<NodeBaseAlias*>(pos.NodeBase);
+        if (sll.LinkedListCore.NodeTail == next.NodeBase)
+        {
+            sll.LinkedListCore.NodeTail = const_cast<NodeBaseAlias*>(it.NodeBase);
+        }
+        if (this->LinkedListCore.NodeTail == current)
+        {
+            this->LinkedListCore.NodeTail = const_cast<NodeBaseAlias*>(next.NodeBase);
+        }
         current->TransferAfter(const_cast<NodeBaseAlias*>(it.NodeBase), const_cast<NodeBaseAlias*>(next.NodeBase));
     }
 
     void SpliceAfter(ConstIteratorAlias pos, SList&& sll, ConstIteratorAlias first, ConstIteratorAlias last)
     {
+        if (last == sll.GetConstEnd() && first.NodeBase->PointerNext != nullptr)
+        {
+            // The range ends at the tail of sll; when sll is this list, SpliceAfterInternal corrects it again.
+            sll.LinkedListCore.NodeTail = const_cast<NodeBaseAlias*>(first.NodeBase);
+        }
         SpliceAfterInternal(pos, first, last);
     }
 
@@ -505,6 +719,24 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         this->SpliceAfter(pos, std::move(sll));
     }
 
+    /** @brief Move every element of sll to the back of this list in O(1). */
+    void SpliceBack(SList&& sll) noexcept
+    {
+        if (std::addressof(sll) == this || sll.IsEmpty())
+        {
+            return;
+        }
+        this->LinkedListCore.NodeTail->PointerNext = sll.LinkedListCore.NodeHead.PointerNext;
+        this->LinkedListCore.NodeTail = sll.LinkedListCore.NodeTail;
+        sll.LinkedListCore.NodeHead.PointerNext = nullptr;
+        sll.LinkedListCore.NodeTail = &sll.LinkedListCore.NodeHead;
+    }
+
+    void SpliceBack(SList& sll) noexcept
+    {
+        this->SpliceBack(std::move(sll));
+    }
+
     IteratorAlias EraseAfter(ConstIteratorAlias pos)
     {
         return IteratorAlias(this->EraseAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase)));
@@ -512,8 +744,8 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
 
     IteratorAlias EraseAfter(ConstIteratorAlias pos, ConstIteratorAlias last)
     {
-        return IteratorAlias(this->EraseAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase)),
-                             const_cast<NodeBaseAlias*>(last.NodeBase));
+        return IteratorAlias(this->EraseAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase),
+                                                      const_cast<NodeBaseAlias*>(last.NodeBase)));
     }
 
     void Resize(SizeTypeAlias size)
@@ -610,7 +842,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         }
     }
 
-    template <typename Compare> void Merge(SList&& sll, Compare comp)
+    template <typename Compare> void Merge(SList&& sll, Compare compare)
     {
         if (std::addressof(sll) == this)
         {
@@ -633,7 +865,9 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         if (sll.LinkedListCore.NodeHead.PointerNext)
         {
             *node = std::move(sll.LinkedListCore.NodeHead);
+            this->LinkedListCore.NodeTail = sll.LinkedListCore.NodeTail;
         }
+        sll.LinkedListCore.NodeTail = &sll.LinkedListCore.NodeHead;
     }
 
     template <typename Compare> void Merge(SList& sll, Compare comp)
@@ -651,6 +885,38 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         this->Merge(std::move(sll), std::less<T>());
     }
 
+    /**
+     * @brief Merge the sorted lists into this sorted list in one relinking pass, with a LoserTree over the list fronts:
+     * O(n log k) comparisons for k lists and no node allocation. Equal elements come from this list first, then from
+     * the lists in argument order. The lists are left empty and must use an allocator equal to this one.
+     */
+    template <typename TCompare, typename... TLists>
+        requires(!std::is_same_v<std::remove_cvref_t<TCompare>, SList> && (std::is_same_v<TLists, SList> && ...))
+    void MergeAll(TCompare compare, TLists&... lists)
+    {
+        SList* sources[] = {this, std::addressof(lists)...};
+        this->MergeAllInternal([&sources](SizeTypeAlias i) { return sources[i]; }, sizeof...(TLists) + 1, compare);
+    }
+
+    template <typename... TLists>
+        requires(std::is_same_v<TLists, SList> && ...)
+    void MergeAll(TLists&... lists)
+    {
+        this->MergeAll(std::less<T>(), lists...);
+    }
+
+    /** @brief MergeAll over the count lists stored from lists on, such as the shards kept in a Vector. */
+    template <typename TCompare> void MergeAll(SList* lists, SizeTypeAlias count, TCompare compare)
+    {
+        this->MergeAllInternal([this, lists](SizeTypeAlias i) { return i == 0 ? this : lists + i - 1; }, count + 1,
+                               compare);
+    }
+
+    void MergeAll(SList* lists, SizeTypeAlias count)
+    {
+        this->MergeAll(lists, count, std::less<T>());
+    }
+
     template <typename TBinaryPredicate> SizeTypeAlias Unique(TBinaryPredicate predicate)
     {
         IteratorAlias first = this->GetBegin();
@@ -686,8 +952,9 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
     {
         return this->Unique(std::equal_to<T>());
     }
-    template <typename TCompare> void Sort(TCompare compare)
+    template <typename TCompare> void Sort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         // This is a merge sort implementation.
 
         IteratorAlias pLeft;
@@ -700,6 +967,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         SizeTypeAlias numberOfMerges;
         SizeTypeAlias leftSize;
         SizeTypeAlias rightSize;
+        SizeTypeAlias nodeWalks = 0;
 
         // If the list is empty or has only one element, it is already sorted.
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
@@ -725,6 +993,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
                 {
                     ++leftSize;
                     ++pRight;
+                    ++nodeWalks;
                     if (pRight == this->GetEnd())
                     {
                         break;
@@ -772,12 +1041,16 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
                         pTail = pNode;
                     }
                     pTail.NodeBase->PointerNext = nullptr;
+                    ++nodeWalks;
                 }
                 pLeft = pRight;
             }
 
+            Utilities::InstrumentationHooks<SList>::OnNodeWalks(nodeWalks);
+            nodeWalks = 0;
             if (numberOfMerges <= 1)
             {
+                this->ResetTailInternal(pTail.NodeBase);
                 return;
             }
 
@@ -790,9 +1063,130 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         this->Sort(std::less<T>());
     }
 
+    /**
+     * @brief Stable sort on several threads. One pass over the list notes every ParallelSortChunkMinimum-th node,
+     * the list is cut at those marks into chunks of at least that many nodes, each chunk is sorted by Sort on its own
+     * thread, and MergeAll relinks the sorted chunks; no element is copied or moved. compare is copied for every
+     * thread. If it throws, the chunks are still joined back, as Sort left them, and the first exception is rethrown.
+     *
+     * @param threadCount Number of threads including the caller; 0 uses std::thread::hardware_concurrency.
+     */
+    template <typename TCompare>
+        requires(!std::is_integral_v<TCompare>)
+    void ParallelSort(TCompare compare, SizeTypeAlias threadCount = 0)
+    {
+        if (threadCount == 0)
+        {
+            threadCount = std::max<SizeTypeAlias>(1, std::thread::hardware_concurrency());
+        }
+        Vector<NodeBaseAlias*> marks;
+        SizeTypeAlias position = 0;
+        for (NodeBaseAlias* node = this->LinkedListCore.NodeHead.PointerNext; node != nullptr; node = node->PointerNext)
+        {
+            if (++position % ParallelSortChunkMinimum == 0)
+            {
+                marks.PushBack(node);
+            }
+        }
+        const SizeTypeAlias count = std::min(threadCount, marks.GetSize());
+        if (count < 2)
+        {
+            this->Sort(compare);
+            return;
+        }
+
+        // This list keeps the first chunk, so MergeAll's preference for it keeps equal elements in order.
+        Vector<std::unique_ptr<SList>> chunks;
+        chunks.Reverse(count - 1);
+        for (SizeTypeAlias i = 1; i < count; ++i)
+        {
+            chunks.PushBack(std::make_unique<SList>(this->GetAllocator()));
+        }
+        Vector<std::exception_ptr> errors(count);
+        Vector<std::thread> workers;
+        workers.Reverse(count - 1);
+
+        // Every chunk but the last ends on a mark, spread as evenly as the marks allow; the last ends at the tail.
+        NodeBaseAlias* const tail = this->LinkedListCore.NodeTail;
+        NodeBaseAlias* before = &this->LinkedListCore.NodeHead;
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            NodeBaseAlias* last = i + 1 == count ? tail : marks[(i + 1) * marks.GetSize() / count - 1];
+            if (i == 0)
+            {
+                this->LinkedListCore.NodeTail = last;
+            }
+            else
+            {
+                SList& chunk = *chunks[i - 1];
+                chunk.LinkedListCore.NodeHead.PointerNext = std::exchange(before->PointerNext, nullptr);
+                chunk.LinkedListCore.NodeTail = last;
+            }
+            before = last;
+        }
+
+        auto sortChunk = [this, &chunks, &errors, &compare](SizeTypeAlias i) noexcept {
+            try
+            {
+                (i == 0 ? *this : *chunks[i - 1]).Sort(compare);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        };
+        SizeTypeAlias started = 1;
+        for (; started < count; ++started)
+        {
+            try
+            {
+                workers.EmplaceBack(sortChunk, started);
+            }
+            catch (...)
+            {
+                // Sort the chunks left over on this thread.
+                break;
+            }
+        }
+        for (SizeTypeAlias i = started; i < count; ++i)
+        {
+            sortChunk(i);
+        }
+        sortChunk(0);
+        for (SizeTypeAlias i = 0; i < workers.GetSize(); ++i)
+        {
+            workers[i].join();
+        }
+
+        this->MergeAllInternal([this, &chunks](SizeTypeAlias i) { return i == 0 ? this : chunks[i - 1].get(); }, count,
+                               compare);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+        }
+    }
+
+    void ParallelSort(SizeTypeAlias threadCount = 0)
+    {
+        this->ParallelSort(std::less<T>(), threadCount);
+    }
+
+    /**
+     * @brief Sort with the strategy that suits the input; see Utilities::AdaptiveSortList. Not stable.
+     * @return The strategy used.
+     */
+    template <typename TCompare> Utilities::SortStrategy AdaptiveSort(TCompare userCompare)
+    {
+        return Utilities::AdaptiveSortList(*this, userCompare, Utilities::InstrumentCompare<SList>(userCompare));
+    }
+
     // Zone of DSA
-    template <typename TCompare> void DSASort(unsigned choice, TCompare compare)
+    template <typename TCompare> void DSASort(unsigned choice, TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         switch (choice)
         {
         case 1:
@@ -810,6 +1204,9 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         case 5:
             this->HeapSort(compare);
             break;
+        case 6:
+            this->AdaptiveSort(userCompare);
+            break;
         default:
             this->Sort(compare);
             break;
@@ -819,6 +1216,15 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
     void Swap(SList& sll) noexcept
     {
         std::swap(this->LinkedListCore.NodeHead.PointerNext, sll.LinkedListCore.NodeHead.PointerNext);
+        std::swap(this->LinkedListCore.NodeTail, sll.LinkedListCore.NodeTail);
+        if (this->IsEmpty())
+        {
+            this->LinkedListCore.NodeTail = &this->LinkedListCore.NodeHead;
+        }
+        if (sll.IsEmpty())
+        {
+            sll.LinkedListCore.NodeTail = &sll.LinkedListCore.NodeHead;
+        }
         if (NodeAllocatorTypeAlias::propagate_on_container_swap::value)
         {
             std::swap(this->GetNodeAllocator(), sll.GetNodeAllocator());
@@ -827,46 +1233,122 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
 
     void Reverse() noexcept
     {
+        if (!this->IsEmpty())
+        {
+            this->LinkedListCore.NodeTail = this->LinkedListCore.NodeHead.PointerNext;
+        }
         this->LinkedListCore.NodeHead.ReverseAfter();
     }
 
-  private:
-    void FillInitializeInternal(SizeTypeAlias size, const T& value)
+    /**
+     * @brief Move every element into one slab of nodes laid out in iteration order and relink them, so later scans
+     * walk memory front to back. Invalidates iterators; if an element's move throws, the list is unchanged.
+     */
+    void Compact()
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-        while (size)
+        const SizeTypeAlias size = this->GetSize();
+        if (size == 0)
         {
-            temp->PointerNext = this->CreateNodeInternal(value);
-            temp = temp->PointerNext;
-            --size;
+            return;
         }
+        NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        NodeAlias* slab = this->MoveToSlabInternal(head.PointerNext, size);
+        this->EraseAfterInternal(&head, nullptr);
+        this->LinkNodesAfterInternal(&head, slab, size);
     }
 
-    void DefaultInitializeInternal(SizeTypeAlias size)
+    /** @brief Fraction of links that jump elsewhere in memory instead of to the adjacent node; 0 after Compact. */
+    [[nodiscard]] double GetScatter() const noexcept
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-        while (size)
+        const NodeBaseAlias& head = this->LinkedListCore.NodeHead;
+        Utilities::NodeScatter<NodeAlias> scatter;
+        for (const NodeBaseAlias* node = head.PointerNext; node != nullptr; node = node->PointerNext)
         {
-            temp->PointerNext = this->CreateNodeInternal();
-            temp = temp->PointerNext;
-            --size;
+            scatter.Visit(static_cast<const NodeAlias*>(node));
         }
+        return scatter.GetScatter();
     }
 
-    void DefaultInsertAfterInternal(ConstIteratorAlias pos, SizeTypeAlias size)
+    /**
+     * @brief Keep up to limit erased nodes for reuse by later inserts instead of freeing them. 0, the default, turns
+     * recycling off; lowering the limit frees the surplus.
+     */
+    void SetNodeCacheLimit(SizeTypeAlias limit) noexcept
     {
-        ConstIteratorAlias savePos = pos;
-        try
+        this->SetNodePoolLimitInternal(limit);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetNodeCacheLimit() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetLimit();
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCachedNodeCount() const noexcept
+    {
+        return this->LinkedListCore.Pool.GetCount();
+    }
+
+    /**
+     * @brief Cache at least count spare nodes, allocated together in one call, so the next count inserts do not
+     * allocate. Raises the cache limit to count if it is lower.
+     */
+    void Reserve(SizeTypeAlias count)
+    {
+        this->ReserveNodesInternal(count);
+    }
+
+    /** @brief Free every cached node. The cache limit is kept. */
+    void ShrinkToFit() noexcept
+    {
+        this->ReleaseNodePoolInternal();
+    }
+
+  private:
+    /** Insert size copies of value behind pos from one slab and return the last one, or pos when size is 0. */
+    NodeBaseAlias* FillInsertAfterInternal(NodeBaseAlias* pos, SizeTypeAlias size, const T& value)
+    {
+        if (size == 0)
         {
-            for (; size; --size)
-            {
-                pos = this->EmplaceAfter(pos);
-            }
+            return pos;
         }
-        catch (...)
+        NodeAlias* nodes =
+            this->CreateNodesInternal(size, [this, &value](T* data) { this->GetTpAllocator().construct(data, value); });
+        return this->LinkNodesAfterInternal(pos, nodes, size);
+    }
+
+    /** Forward range counterpart of FillInsertAfterInternal: count the range, then build it in one slab. */
+    template <typename ForwardIterator>
+    NodeBaseAlias* RangeInsertAfterInternal(NodeBaseAlias* pos, ForwardIterator first, ForwardIterator last)
+    {
+        const auto size = static_cast<SizeTypeAlias>(std::distance(first, last));
+        if (size == 0)
         {
-            this->EraseAfter(savePos, pos);
-            throw;
+            return pos;
+        }
+        NodeAlias* nodes = this->CreateNodesInternal(size, [this, &first](T* data) {
+            this->GetTpAllocator().construct(data, *first);
+            ++first;
+        });
+        return this->LinkNodesAfterInternal(pos, nodes, size);
+    }
+
+    void FillInitializeInternal(SizeTypeAlias size, const T& value)
+    {
+        this->FillInsertAfterInternal(&this->LinkedListCore.NodeHead, size, value);
+    }
+
+    void DefaultInitializeInternal(SizeTypeAlias size)
+    {
+        this->DefaultInsertAfterInternal(this->GetConstBeginFromHead(), size);
+    }
+
+    void DefaultInsertAfterInternal(ConstIteratorAlias pos, SizeTypeAlias size)
+    {
+        if (size != 0)
+        {
+            NodeAlias* nodes =
+                this->CreateNodesInternal(size, [this](T* data) { this->GetTpAllocator().construct(data); });
+            this->LinkNodesAfterInternal(const_cast<NodeBaseAlias*>(pos.NodeBase), nodes, size);
         }
     }
 
@@ -915,6 +1397,10 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
 
         if (nextOtherNodeBase != end)
         {
+            if (this->LinkedListCore.NodeTail == temp)
+            {
+                this->LinkedListCore.NodeTail = end;
+            }
             return IteratorAlias(temp->TransferAfter(nextOtherNodeBase, end));
         }
         else
@@ -923,22 +1409,95 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         }
     }
 
+    /** Forward ranges are built in one slab; input ranges, which cannot be counted first, go node by node. */
     template <typename InputIterator> void RangeInitializeInternal(InputIterator first, InputIterator last)
     {
-        NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
-        while (first != last)
+        if constexpr (std::forward_iterator<InputIterator>)
         {
-            temp->PointerNext = this->CreateNodeInternal(*first);
-            temp = temp->PointerNext;
-            ++first;
+            this->RangeInsertAfterInternal(&this->LinkedListCore.NodeHead, first, last);
+        }
+        else
+        {
+            NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;
+            while (first != last)
+            {
+                temp->PointerNext = this->CreateNodeInternal(*first);
+                temp = temp->PointerNext;
+                this->LinkedListCore.NodeTail = temp;
+                ++first;
+            }
         }
     }
 
+    /**
+     * Relink the nodes of the count sorted lists given by sources(i) into this list, which is sources(0). A list given
+     * twice is merged once. If compare throws, the nodes not merged yet are appended unsorted, so none is lost.
+     */
+    template <typename TSources, typename TCompare>
+    void MergeAllInternal(TSources sources, SizeTypeAlias count, TCompare compare)
+    {
+        auto byValue = [&compare](const NodeBaseAlias* lhs, const NodeBaseAlias* rhs) {
+            return compare(*static_cast<const NodeAlias*>(lhs)->GetData(),
+                           *static_cast<const NodeAlias*>(rhs)->GetData());
+        };
+        LoserTree<NodeBaseAlias*, decltype(byValue)> tree(count, byValue);
+        Vector<NodeBaseAlias*> heads(count, nullptr);
+        for (SizeTypeAlias i = 0; i < count; ++i)
+        {
+            SList* list = sources(i);
+            heads[i] = std::exchange(list->LinkedListCore.NodeHead.PointerNext, nullptr);
+            list->LinkedListCore.NodeTail = &list->LinkedListCore.NodeHead;
+            if (heads[i] != nullptr)
+            {
+                tree.SetSource(i, heads[i]);
+            }
+        }
+
+        NodeBaseAlias* tail = &this->LinkedListCore.NodeHead;
+        try
+        {
+            tree.Build();
+            while (!tree.IsEmpty())
+            {
+                const SizeTypeAlias winner = tree.GetWinner();
+                NodeBaseAlias* node = heads[winner];
+                tail->PointerNext = node;
+                tail = node;
+                heads[winner] = node->PointerNext;
+                if (heads[winner] != nullptr)
+                {
+                    tree.ReplaceTop(heads[winner]);
+                }
+                else
+                {
+                    tree.PopTop();
+                }
+            }
+        }
+        catch (...)
+        {
+            for (SizeTypeAlias i = 0; i < count; ++i)
+            {
+                for (NodeBaseAlias* node = heads[i]; node != nullptr; node = node->PointerNext)
+                {
+                    tail->PointerNext = node;
+                    tail = node;
+                }
+            }
+            tail->PointerNext = nullptr;
+            this->LinkedListCore.NodeTail = tail;
+            throw;
+        }
+        tail->PointerNext = nullptr;
+        this->LinkedListCore.NodeTail = tail;
+    }
+
     void MoveAssignInternal(SList&& sll, std::true_type)
     {
         this->Clear();
         this->GetNodeAllocator() = std::move(sll.GetNodeAllocator());
         this->LinkedListCore.NodeHead = std::move(sll.LinkedListCore.NodeHead);
+        this->TakeTailInternal(sll);
     }
 
     void MoveAssignInternal(SList&& sll, std::false_type)
@@ -986,8 +1545,9 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
 
   public:
     // These sortable function are only used for DSA
-    template <typename TCompare> void InsertionSort(TCompare compare)
+    template <typename TCompare> void InsertionSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         // this is an insertion sort implementation
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
@@ -1000,16 +1560,19 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         while (sorted->PointerNext)
         {
             bool isInserted = false;
-            for (NodeBaseAlias* temp = &this->LinkedListCore.NodeHead; temp->PointerNext != sorted;
-                 temp = temp->PointerNext)
+            // sorted ends the sorted prefix, so a node not less than it is already in place
+            if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(), *static_cast<NodeAlias*>(sorted)->GetData()))
             {
-                if (compare(*static_cast<NodeAlias*>(temp->PointerNext)->GetData(),
-                            *static_cast<NodeAlias*>(unsorted)->GetData()))
+                for (NodeBaseAlias* temp = &this->LinkedListCore.NodeHead;; temp = temp->PointerNext)
                 {
-                    temp->TransferAfter(sorted, unsorted);
-                    unsorted = sorted->PointerNext;
-                    isInserted = true;
-                    break;
+                    if (compare(*static_cast<NodeAlias*>(unsorted)->GetData(),
+                                *static_cast<NodeAlias*>(temp->PointerNext)->GetData()))
+                    {
+                        temp->TransferAfter(sorted, unsorted);
+                        unsorted = sorted->PointerNext;
+                        isInserted = true;
+                        break;
+                    }
                 }
             }
 
@@ -1019,10 +1582,12 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
                 unsorted = sorted->PointerNext;
             }
         }
+        this->ResetTailInternal(sorted);
     }
 
-    template <typename TCompare> void SelectionSort(TCompare compare)
+    template <typename TCompare> void SelectionSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         // This is a selection sort implementation
 
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
@@ -1055,10 +1620,12 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
                 curr = curr->PointerNext;
             }
         }
+        this->ResetTailInternal(curr);
     }
 
-    template <typename TCompare> void BubbleSort(TCompare compare)
+    template <typename TCompare> void BubbleSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         // This is a bubble sort implementation
 
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
@@ -1084,6 +1651,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
             }
             if (!isSwapped)
             {
+                this->ResetTailInternal(curr);
                 break;
             }
         }
@@ -1108,6 +1676,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
     template <typename TCompare>
     IteratorAlias PartitionForQuickSortHelper(TCompare compare, IteratorAlias begin, IteratorAlias end)
     {
+        using std::swap;
         IteratorAlias pivot = begin;
         IteratorAlias i = begin;
         IteratorAlias j = begin.PointerNext();
@@ -1117,12 +1686,12 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
             if (compare(*j, *pivot))
             {
                 ++i;
-                std::swap(*i, *j);
+                swap(*i, *j);
             }
             ++j;
         }
 
-        std::swap(*i, *pivot);
+        swap(*i, *pivot);
 
         return i;
     }
@@ -1152,6 +1721,7 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
 
     void SwapForHeapSort(SizeTypeAlias root, SizeTypeAlias left)
     {
+        using std::swap;
         IteratorAlias rootIter = this->GetBegin();
         IteratorAlias leftIter = this->GetBegin();
 
@@ -1165,22 +1735,25 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
             ++leftIter;
         }
 
-        std::swap(*rootIter, *leftIter);
+        swap(*rootIter, *leftIter);
     }
 
     IteratorAlias FindForHeapSortHelper(SizeTypeAlias index)
     {
         IteratorAlias iter = this->GetBegin();
-        for (SizeTypeAlias i = 0; i < index && iter != this->GetEnd(); i++)
+        SizeTypeAlias i = 0;
+        for (; i < index && iter != this->GetEnd(); i++)
         {
             ++iter;
         }
+        Utilities::InstrumentationHooks<SList>::OnNodeWalks(i);
         return iter;
     }
 
   public:
-    template <typename TCompare> void QuickSort(TCompare compare)
+    template <typename TCompare> void QuickSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         if (this->IsEmpty() || this->GetBegin().PointerNext() == this->GetEnd())
         {
             return;
@@ -1189,8 +1762,9 @@ template <typename T, typename Alloc = Allocator<T>> class SList : protected SLi
         QuickSortHelper(compare, this->GetBegin(), this->GetEnd());
     }
 
-    template <typename TCompare> void HeapSort(TCompare compare)
+    template <typename TCompare> void HeapSort(TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<SList>(userCompare);
         SizeTypeAlias length = this->GetSize();
 
         if (length <= 1)
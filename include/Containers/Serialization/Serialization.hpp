@@ -0,0 +1,346 @@
+#ifndef DSA_LIBRARIES_SERIALIZATION_HPP
+#define DSA_LIBRARIES_SERIALIZATION_HPP
+#include "../CompactList/CompactList.hpp"
+#include "../DList/DList.hpp"
+#include "../List/List.hpp"
+#include "../SList/SList.hpp"
+#include "../Vector/Vector.hpp"
+#include "SerializationExceptions.hpp"
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sys/uio.h>
+#include <type_traits>
+#include <unistd.h>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Header in front of every snapshot: the records follow it back to back, Count of them, as the raw bytes of
+ * T. Vector and list snapshots share the format, so either can be read back into the other.
+ */
+struct SerializationHeader
+{
+    static constexpr std::uint32_t MagicValue = 0x53415344; // "DSAS"
+    static constexpr std::uint16_t CurrentVersion = 1;
+    static constexpr std::uint16_t ByteOrderValue = 0x0102;
+
+    std::uint32_t Magic = MagicValue;
+    std::uint16_t Version = CurrentVersion;
+    std::uint16_t ByteOrder = ByteOrderValue;
+    std::uint32_t ElementSize = 0;
+    std::uint32_t ElementAlignment = 0;
+    std::uint64_t Count = 0;
+    std::uint64_t Reserved = 0;
+
+    template <typename T> static SerializationHeader Make(std::uint64_t count) noexcept
+    {
+        SerializationHeader header;
+        header.ElementSize = sizeof(T);
+        header.ElementAlignment = alignof(T);
+        header.Count = count;
+        return header;
+    }
+
+    template <typename T> [[nodiscard]] bool IsValidFor() const noexcept
+    {
+        return Magic == MagicValue && Version == CurrentVersion && ByteOrder == ByteOrderValue &&
+               ElementSize == sizeof(T) && ElementAlignment == alignof(T);
+    }
+};
+
+static_assert(sizeof(SerializationHeader) == 32, "The records start 32 bytes into a snapshot");
+
+namespace SerializationDetail
+{
+constexpr std::size_t BlockBytes = 64 * 1024;
+
+inline void WriteAll(int file, iovec *parts, int count)
+{
+    while (count > 0)
+    {
+        const ssize_t written = ::writev(file, parts, count);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw SerializationIOException(__FILE__, __LINE__);
+        }
+        auto remaining = static_cast<std::size_t>(written);
+        while (count > 0 && remaining >= parts->iov_len)
+        {
+            remaining -= parts->iov_len;
+            ++parts;
+            --count;
+        }
+        if (count > 0)
+        {
+            parts->iov_base = static_cast<char *>(parts->iov_base) + remaining;
+            parts->iov_len -= remaining;
+        }
+    }
+}
+
+inline void ReadAll(int file, void *data, std::size_t bytes)
+{
+    auto *cursor = static_cast<char *>(data);
+    while (bytes > 0)
+    {
+        const ssize_t result = ::read(file, cursor, bytes);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw SerializationIOException(__FILE__, __LINE__);
+        }
+        if (result == 0)
+        {
+            throw SerializationFormatException(__FILE__, __LINE__);
+        }
+        cursor += result;
+        bytes -= static_cast<std::size_t>(result);
+    }
+}
+
+template <typename T> SerializationHeader ReadHeader(int file)
+{
+    SerializationHeader header;
+    ReadAll(file, &header, sizeof(header));
+    if (!header.template IsValidFor<T>())
+    {
+        throw SerializationFormatException(__FILE__, __LINE__);
+    }
+    return header;
+}
+
+/**
+ * @brief Stream the list through a block buffer, so a snapshot costs one write per 64 KiB, not one per element.
+ */
+template <typename T, typename TList> void SerializeList(int file, const TList &list)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots store records as raw bytes");
+    constexpr std::size_t blockRecords = BlockBytes / sizeof(T) > 0 ? BlockBytes / sizeof(T) : 1;
+
+    SerializationHeader header = SerializationHeader::Make<T>(list.GetSize());
+    Vector<T> block;
+    block.Reverse(blockRecords);
+    bool isHeaderWritten = false;
+    auto flush = [&]() {
+        iovec parts[2] = {{&header, sizeof(header)}, {block.GetData(), block.GetSize() * sizeof(T)}};
+        WriteAll(file, isHeaderWritten ? parts + 1 : parts, isHeaderWritten ? 1 : 2);
+        isHeaderWritten = true;
+        block.Clear();
+    };
+    for (auto it = list.GetConstBegin(); it != list.GetConstEnd(); ++it)
+    {
+        block.PushBack(*it);
+        if (block.GetSize() == blockRecords)
+        {
+            flush();
+        }
+    }
+    if (!isHeaderWritten || !block.IsEmpty())
+    {
+        flush();
+    }
+}
+
+template <typename T, typename TList> void DeserializeList(int file, TList &list)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots store records as raw bytes");
+    constexpr std::size_t blockRecords = BlockBytes / sizeof(T) > 0 ? BlockBytes / sizeof(T) : 1;
+
+    const SerializationHeader header = ReadHeader<T>(file);
+    list.Clear();
+    Vector<T> block(blockRecords);
+    auto last = list.GetBeginFromHead();
+    for (std::uint64_t remaining = header.Count; remaining > 0;)
+    {
+        const std::size_t count = remaining < blockRecords ? static_cast<std::size_t>(remaining) : blockRecords;
+        ReadAll(file, block.GetData(), count * sizeof(T));
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            last = list.EmplaceAfter(last, block[i]);
+        }
+        remaining -= count;
+    }
+}
+} // namespace SerializationDetail
+
+/**
+ * @brief Write a snapshot of vector to file: the header and the whole element array in one writev.
+ */
+template <typename T, typename Alloc> void Serialize(int file, const Vector<T, Alloc> &vector)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots store records as raw bytes");
+    SerializationHeader header = SerializationHeader::Make<T>(vector.GetSize());
+    iovec parts[2] = {{&header, sizeof(header)},
+                      {const_cast<T *>(vector.GetData()), vector.GetSize() * sizeof(T)}};
+    SerializationDetail::WriteAll(file, parts, 2);
+}
+
+/**
+ * @brief Replace the contents of vector with the snapshot read from file, in one read into its storage.
+ */
+template <typename T, typename Alloc> void Deserialize(int file, Vector<T, Alloc> &vector)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots store records as raw bytes");
+    const SerializationHeader header = SerializationDetail::ReadHeader<T>(file);
+    vector.Clear();
+    vector.Resize(static_cast<std::size_t>(header.Count));
+    SerializationDetail::ReadAll(file, vector.GetData(), vector.GetSize() * sizeof(T));
+}
+
+template <typename T, typename Alloc> void Serialize(int file, const SList<T, Alloc> &list)
+{
+    SerializationDetail::SerializeList<T>(file, list);
+}
+
+template <typename T, typename Alloc> void Deserialize(int file, SList<T, Alloc> &list)
+{
+    SerializationDetail::DeserializeList<T>(file, list);
+}
+
+template <typename T, typename Alloc> void Serialize(int file, const DList<T, Alloc> &list)
+{
+    SerializationDetail::SerializeList<T>(file, list);
+}
+
+template <typename T, typename Alloc> void Deserialize(int file, DList<T, Alloc> &list)
+{
+    SerializationDetail::DeserializeList<T>(file, list);
+}
+
+template <typename T, typename Index, typename Alloc> void Serialize(int file, const CompactList<T, Index, Alloc> &list)
+{
+    SerializationDetail::SerializeList<T>(file, list);
+}
+
+template <typename T, typename Index, typename Alloc> void Deserialize(int file, CompactList<T, Index, Alloc> &list)
+{
+    SerializationDetail::DeserializeList<T>(file, list);
+}
+
+template <typename T, typename Alloc> void Serialize(int file, const List<T, Alloc> &list)
+{
+    SerializationDetail::SerializeList<T>(file, list);
+}
+
+template <typename T, typename Alloc> void Deserialize(int file, List<T, Alloc> &list)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots store records as raw bytes");
+    constexpr std::size_t blockRecords =
+        SerializationDetail::BlockBytes / sizeof(T) > 0 ? SerializationDetail::BlockBytes / sizeof(T) : 1;
+
+    const SerializationHeader header = SerializationDetail::ReadHeader<T>(file);
+    list.Clear();
+    Vector<T> block(blockRecords);
+    for (std::uint64_t remaining = header.Count; remaining > 0;)
+    {
+        const std::size_t count = remaining < blockRecords ? static_cast<std::size_t>(remaining) : blockRecords;
+        SerializationDetail::ReadAll(file, block.GetData(), count * sizeof(T));
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            list.PushBack(block[i]);
+        }
+        remaining -= count;
+    }
+}
+
+/**
+ * @brief Read-only view of the records of a snapshot that is already in memory, typically a MappedVector of bytes;
+ * nothing is copied. The buffer must outlive the view.
+ */
+template <typename T> class SerializedView
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots store records as raw bytes");
+
+  public:
+    using ValueTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using ConstReferenceAlias = const T &;
+    using ConstPointerAlias = const T *;
+    using ConstIteratorAlias = const T *;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+    using const_reference = ConstReferenceAlias;
+    using const_pointer = ConstPointerAlias;
+    using const_iterator = ConstIteratorAlias;
+
+  private:
+    ConstPointerAlias _data = nullptr;
+    SizeTypeAlias _size = 0;
+
+  public:
+    SerializedView() noexcept = default;
+
+    /**
+     * @param data Start of the snapshot; the records must land aligned for T, which holds for any buffer aligned to
+     * 32 bytes or alignof(T).
+     */
+    SerializedView(const void *data, SizeTypeAlias bytes)
+    {
+        SerializationHeader header;
+        if (data == nullptr || bytes < sizeof(header))
+        {
+            throw SerializationFormatException(__FILE__, __LINE__);
+        }
+        std::memcpy(&header, data, sizeof(header));
+        const SizeTypeAlias available = (bytes - sizeof(header)) / sizeof(T);
+        const auto *records = static_cast<const unsigned char *>(data) + sizeof(header);
+        if (!header.template IsValidFor<T>() || header.Count > available ||
+            reinterpret_cast<std::uintptr_t>(records) % alignof(T) != 0)
+        {
+            throw SerializationFormatException(__FILE__, __LINE__);
+        }
+        _data = reinterpret_cast<ConstPointerAlias>(records);
+        _size = static_cast<SizeTypeAlias>(header.Count);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] ConstPointerAlias GetData() const noexcept
+    {
+        return _data;
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return _data;
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return _data + _size;
+    }
+
+    ConstReferenceAlias operator[](SizeTypeAlias index) const noexcept
+    {
+        return _data[index];
+    }
+
+    ConstReferenceAlias At(SizeTypeAlias index) const
+    {
+        if (index >= _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return _data[index];
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_SERIALIZATION_HPP
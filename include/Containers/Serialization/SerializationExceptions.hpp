@@ -0,0 +1,32 @@
+#ifndef DSA_LIBRARIES_SERIALIZATION_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_SERIALIZATION_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class SerializationException : public Utilities::Exception
+{
+  public:
+    SerializationException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class SerializationIOException : public SerializationException
+{
+  public:
+    SerializationIOException(string_type fileText, numeric_type line)
+        : SerializationException("Failed to write or read the snapshot", std::move(fileText), line)
+    {
+    }
+};
+class SerializationFormatException : public SerializationException
+{
+  public:
+    SerializationFormatException(string_type fileText, numeric_type line)
+        : SerializationException("Snapshot header does not match the element type or is truncated",
+                                 std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
@@ -0,0 +1,458 @@
+#ifndef DSA_LIBRARIES_CONCURRENT_SKIP_LIST_HPP
+#define DSA_LIBRARIES_CONCURRENT_SKIP_LIST_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/EpochReclamation.hpp"
+#include "ConcurrentSkipListIterator.hpp"
+#include "ConcurrentSkipListNode.hpp"
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Lock-free ordered map.
+ *
+ * Insert links a node bottom-up with CAS, Erase marks the tower top-down (logical delete) and lets the search path
+ * unlink marked nodes (physical delete). Unlinked nodes are retired to an epoch manager and freed once no reader can
+ * still observe them. Tower heights are geometric with p = 1/2.
+ *
+ * @tparam K Key type, ordered by TCompare.
+ * @tparam V Value type. Values are immutable once published; Find copies them out.
+ */
+template <typename K, typename V, typename TCompare = std::less<K>, typename Alloc = Utilities::Allocator<K>>
+class ConcurrentSkipList
+{
+  public:
+    using KeyTypeAlias = K;
+    using ValueTypeAlias = V;
+    using SizeTypeAlias = std::size_t;
+    using CompareAlias = TCompare;
+    using NodeBaseAlias = ConcurrentSkipListNodeBase;
+    using NodeAlias = ConcurrentSkipListNode<K, V>;
+    using LinkAlias = typename NodeBaseAlias::LinkAlias;
+    using IteratorAlias = ConcurrentSkipListIterator<K, V>;
+    using ConstIteratorAlias = ConcurrentSkipListIterator<K, V>;
+    using GuardAlias = Utilities::EpochManager::Guard;
+    using AllocatorTypeAlias = Alloc;
+    using NodeAllocatorTypeAlias = typename std::allocator_traits<Alloc>::template rebind_alloc<NodeAlias>;
+
+    // Adaptive alias
+    using key_type = KeyTypeAlias;
+    using mapped_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+
+    static constexpr std::uint32_t MaxLevel = 32;
+    static constexpr SizeTypeAlias CollectInterval = 64;
+
+  private:
+    NodeAllocatorTypeAlias _nodeAllocator;
+    CompareAlias _compare;
+    NodeAlias *_head;
+    alignas(64) std::atomic<SizeTypeAlias> _size{0};
+    std::atomic<SizeTypeAlias> _retiredSinceCollect{0};
+    mutable Utilities::EpochManager _epochs;
+
+  public:
+    explicit ConcurrentSkipList(const CompareAlias &compare = CompareAlias(),
+                                const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : _nodeAllocator(allocator), _compare(compare), _head(this->GetNodeInternal(MaxLevel))
+    {
+    }
+
+    ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+    ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+    ~ConcurrentSkipList()
+    {
+        NodeBaseAlias *current = _head->GetNext(0);
+        while (current)
+        {
+            NodeBaseAlias *next = current->GetNext(0);
+            this->DestroyNodeInternal(static_cast<NodeAlias *>(current));
+            current = next;
+        }
+        _epochs.Drain([this](Utilities::EpochRetiredNode *retired) {
+            this->DestroyNodeInternal(static_cast<NodeAlias *>(static_cast<NodeBaseAlias *>(retired)));
+        });
+        this->PutNodeInternal(_head);
+    }
+
+    /**
+     * @brief Pin the calling thread. Iterators are only valid while a guard returned from here is alive.
+     * @throw Utilities::EpochParticipantsExhaustedException if EpochManager::MaxParticipants guards are already live.
+     */
+    [[nodiscard]] GuardAlias Pin() const
+    {
+        return _epochs.Pin();
+    }
+
+    IteratorAlias GetBegin() const noexcept
+    {
+        return IteratorAlias(_head->GetNext(0));
+    }
+
+    IteratorAlias GetEnd() const noexcept
+    {
+        return IteratorAlias(nullptr);
+    }
+
+    IteratorAlias begin() const noexcept
+    {
+        return this->GetBegin();
+    }
+
+    IteratorAlias end() const noexcept
+    {
+        return this->GetEnd();
+    }
+
+    /**
+     * @brief Number of live elements. Exact when the list is quiescent, a momentary snapshot otherwise.
+     */
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return this->GetSize() == 0;
+    }
+
+    /**
+     * @brief Insert a key if it is not present yet.
+     * @return false if the key already exists; the list is left unchanged.
+     */
+    bool Insert(const KeyTypeAlias &key, const ValueTypeAlias &value)
+    {
+        return this->EmplaceInternal(key, value);
+    }
+
+    bool Insert(const KeyTypeAlias &key, ValueTypeAlias &&value)
+    {
+        return this->EmplaceInternal(key, std::move(value));
+    }
+
+    template <typename... Args> bool Emplace(const KeyTypeAlias &key, Args &&...args)
+    {
+        return this->EmplaceInternal(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Copy the value stored under key into value.
+     * @return false if the key is absent.
+     */
+    bool Find(const KeyTypeAlias &key, ValueTypeAlias &value) const
+    {
+        GuardAlias guard = _epochs.Pin();
+        const NodeBaseAlias *nodeBase = this->FindWaitFreeInternal(key);
+        if (!nodeBase)
+        {
+            return false;
+        }
+        value = *static_cast<const NodeAlias *>(nodeBase)->GetData();
+        return true;
+    }
+
+    bool Contains(const KeyTypeAlias &key) const
+    {
+        GuardAlias guard = _epochs.Pin();
+        return this->FindWaitFreeInternal(key) != nullptr;
+    }
+
+    /**
+     * @brief Remove key from the list.
+     * @return false if the key was absent or another thread removed it first.
+     */
+    bool Erase(const KeyTypeAlias &key)
+    {
+        NodeBaseAlias *preds[MaxLevel];
+        NodeBaseAlias *succs[MaxLevel];
+
+        GuardAlias guard = _epochs.Pin();
+        if (!this->FindInternal(key, preds, succs))
+        {
+            return false;
+        }
+
+        NodeBaseAlias *victim = succs[0];
+        for (std::uint32_t level = victim->Height - 1; level > 0; --level)
+        {
+            victim->MarkNext(level);
+        }
+
+        if (!victim->MarkNext(0))
+        {
+            return false;
+        }
+
+        _size.fetch_sub(1, std::memory_order_relaxed);
+        this->FindInternal(key, preds, succs);
+        this->FinishInternal(victim, NodeBaseAlias::RemoveFinishedFlag);
+        return true;
+    }
+
+    /**
+     * @brief Release retired nodes that no pinned reader can observe anymore. Called automatically every
+     * CollectInterval removals.
+     */
+    SizeTypeAlias Collect()
+    {
+        return _epochs.Collect([this](Utilities::EpochRetiredNode *retired) {
+            this->DestroyNodeInternal(static_cast<NodeAlias *>(static_cast<NodeBaseAlias *>(retired)));
+        });
+    }
+
+  protected:
+    NodeAlias *GetNodeInternal(std::uint32_t height)
+    {
+        NodeAlias *node = std::allocator_traits<NodeAllocatorTypeAlias>::allocate(
+            _nodeAllocator, NodeAlias::GetAllocationUnits(height));
+        ::new (static_cast<void *>(node)) NodeAlias();
+        node->InitializeTower(height);
+        return node;
+    }
+
+    void PutNodeInternal(NodeAlias *node) noexcept
+    {
+        const std::uint32_t height = node->Height;
+        node->~NodeAlias();
+        std::allocator_traits<NodeAllocatorTypeAlias>::deallocate(_nodeAllocator, node,
+                                                                  NodeAlias::GetAllocationUnits(height));
+    }
+
+    template <typename... Args> NodeAlias *CreateNodeInternal(const KeyTypeAlias &key, Args &&...args)
+    {
+        NodeAlias *node = this->GetNodeInternal(RandomHeightInternal());
+        try
+        {
+            ::new (static_cast<void *>(node->GetKey())) KeyTypeAlias(key);
+            try
+            {
+                ::new (static_cast<void *>(node->GetData())) ValueTypeAlias(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node->GetKey()->~KeyTypeAlias();
+                throw;
+            }
+        }
+        catch (...)
+        {
+            this->PutNodeInternal(node);
+            throw;
+        }
+        return node;
+    }
+
+    void DestroyNodeInternal(NodeAlias *node) noexcept
+    {
+        node->GetData()->~ValueTypeAlias();
+        node->GetKey()->~KeyTypeAlias();
+        this->PutNodeInternal(node);
+    }
+
+    static std::uint32_t RandomHeightInternal() noexcept
+    {
+        thread_local std::uint64_t state =
+            static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+            reinterpret_cast<std::uintptr_t>(&state) ^ 0x9E3779B97F4A7C15ULL;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const std::uint64_t bits = state | (std::uint64_t(1) << (MaxLevel - 1));
+        return static_cast<std::uint32_t>(std::countr_zero(bits)) + 1;
+    }
+
+    bool LessInternal(const NodeBaseAlias *nodeBase, const KeyTypeAlias &key) const
+    {
+        return _compare(*static_cast<const NodeAlias *>(nodeBase)->GetKey(), key);
+    }
+
+    bool EqualInternal(const NodeBaseAlias *nodeBase, const KeyTypeAlias &key) const
+    {
+        return nodeBase && !_compare(key, *static_cast<const NodeAlias *>(nodeBase)->GetKey());
+    }
+
+    /**
+     * @brief Locate the window (preds[level], succs[level]) around key on every level, unlinking every marked node
+     * met on the way.
+     * @return true if an unmarked node holding key is linked at the bottom level.
+     */
+    bool FindInternal(const KeyTypeAlias &key, NodeBaseAlias **preds, NodeBaseAlias **succs) const
+    {
+    retry:
+        NodeBaseAlias *pred = _head;
+        for (std::uint32_t level = MaxLevel; level-- > 0;)
+        {
+            NodeBaseAlias *current = pred->GetNext(level);
+            while (current)
+            {
+                LinkAlias succLink = current->LoadNext(level);
+                while (NodeBaseAlias::IsMarked(succLink))
+                {
+                    LinkAlias expected = NodeBaseAlias::MakeLink(current);
+                    if (!pred->CompareExchangeNext(level, expected, succLink & ~NodeBaseAlias::MarkBit))
+                    {
+                        goto retry;
+                    }
+                    current = NodeBaseAlias::GetPointer(succLink);
+                    if (!current)
+                    {
+                        break;
+                    }
+                    succLink = current->LoadNext(level);
+                }
+
+                if (!current || !this->LessInternal(current, key))
+                {
+                    break;
+                }
+                pred = current;
+                current = NodeBaseAlias::GetPointer(succLink);
+            }
+            preds[level] = pred;
+            succs[level] = current;
+        }
+        return this->EqualInternal(succs[0], key);
+    }
+
+    /**
+     * @brief Read-only search that never writes to shared memory; marked nodes are stepped over instead of unlinked.
+     */
+    const NodeBaseAlias *FindWaitFreeInternal(const KeyTypeAlias &key) const
+    {
+        const NodeBaseAlias *pred = _head;
+        const NodeBaseAlias *current = nullptr;
+        for (std::uint32_t level = MaxLevel; level-- > 0;)
+        {
+            current = pred->GetNext(level);
+            while (current)
+            {
+                LinkAlias succLink = current->LoadNext(level);
+                while (NodeBaseAlias::IsMarked(succLink))
+                {
+                    current = NodeBaseAlias::GetPointer(succLink);
+                    if (!current)
+                    {
+                        break;
+                    }
+                    succLink = current->LoadNext(level);
+                }
+
+                if (!current || !this->LessInternal(current, key))
+                {
+                    break;
+                }
+                pred = current;
+                current = NodeBaseAlias::GetPointer(succLink);
+            }
+        }
+        return this->EqualInternal(current, key) ? current : nullptr;
+    }
+
+    template <typename... Args> bool EmplaceInternal(const KeyTypeAlias &key, Args &&...args)
+    {
+        NodeBaseAlias *preds[MaxLevel];
+        NodeBaseAlias *succs[MaxLevel];
+        NodeAlias *node = nullptr;
+
+        GuardAlias guard = _epochs.Pin();
+        while (true)
+        {
+            if (this->FindInternal(key, preds, succs))
+            {
+                if (node)
+                {
+                    this->DestroyNodeInternal(node);
+                }
+                return false;
+            }
+
+            if (!node)
+            {
+                node = this->CreateNodeInternal(key, std::forward<Args>(args)...);
+            }
+
+            for (std::uint32_t level = 0; level < node->Height; ++level)
+            {
+                node->PointerNext[level].store(NodeBaseAlias::MakeLink(succs[level]), std::memory_order_relaxed);
+            }
+
+            LinkAlias expected = NodeBaseAlias::MakeLink(succs[0]);
+            if (preds[0]->CompareExchangeNext(0, expected, NodeBaseAlias::MakeLink(node)))
+            {
+                break;
+            }
+        }
+
+        _size.fetch_add(1, std::memory_order_relaxed);
+
+        for (std::uint32_t level = 1; level < node->Height; ++level)
+        {
+            while (true)
+            {
+                LinkAlias nodeNext = node->LoadNext(level);
+                if (NodeBaseAlias::IsMarked(nodeNext))
+                {
+                    goto finished;
+                }
+                if (NodeBaseAlias::GetPointer(nodeNext) != succs[level] &&
+                    !node->CompareExchangeNext(level, nodeNext, NodeBaseAlias::MakeLink(succs[level])))
+                {
+                    continue;
+                }
+
+                LinkAlias expected = NodeBaseAlias::MakeLink(succs[level]);
+                if (preds[level]->CompareExchangeNext(level, expected, NodeBaseAlias::MakeLink(node)))
+                {
+                    break;
+                }
+
+                this->FindInternal(key, preds, succs);
+                if (succs[0] != node)
+                {
+                    goto finished;
+                }
+            }
+        }
+
+    finished:
+        this->FinishInternal(node, NodeBaseAlias::InsertFinishedFlag);
+        return true;
+    }
+
+    /**
+     * @brief The inserting and the removing thread both report here. Whoever comes second knows the tower is final,
+     * sweeps it off every level and retires it.
+     */
+    void FinishInternal(NodeBaseAlias *nodeBase, std::uint8_t flag)
+    {
+        const std::uint8_t other = flag == NodeBaseAlias::InsertFinishedFlag ? NodeBaseAlias::RemoveFinishedFlag
+                                                                             : NodeBaseAlias::InsertFinishedFlag;
+        if ((nodeBase->State.fetch_or(flag, std::memory_order_acq_rel) & other) == 0)
+        {
+            return;
+        }
+
+        NodeBaseAlias *preds[MaxLevel];
+        NodeBaseAlias *succs[MaxLevel];
+        this->FindInternal(*static_cast<NodeAlias *>(nodeBase)->GetKey(), preds, succs);
+
+        _epochs.Retire(nodeBase);
+        if (_retiredSinceCollect.fetch_add(1, std::memory_order_relaxed) + 1 >= CollectInterval)
+        {
+            _retiredSinceCollect.store(0, std::memory_order_relaxed);
+            this->Collect();
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_CONCURRENT_SKIP_LIST_HPP
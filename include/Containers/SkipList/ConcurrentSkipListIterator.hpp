@@ -0,0 +1,87 @@
+#ifndef DSA_LIBRARIES_CONCURRENT_SKIP_LIST_ITERATOR_HPP
+#define DSA_LIBRARIES_CONCURRENT_SKIP_LIST_ITERATOR_HPP
+#include "ConcurrentSkipListNode.hpp"
+#include <iterator>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Weakly consistent forward iterator over the bottom level. Logically deleted nodes are skipped. The owning
+ * list must be pinned (ConcurrentSkipList::Pin) for as long as the iterator is in use.
+ */
+template <typename K, typename V> struct ConcurrentSkipListIterator
+{
+    const ConcurrentSkipListNodeBase *NodeBase;
+
+    using SelfAlias = ConcurrentSkipListIterator<K, V>;
+    using NodeAlias = ConcurrentSkipListNode<K, V>;
+    using KeyTypeAlias = K;
+    using ValueTypeAlias = V;
+    using PointerAlias = const V *;
+    using ReferenceAlias = const V &;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    ConcurrentSkipListIterator() noexcept : NodeBase()
+    {
+    }
+
+    explicit ConcurrentSkipListIterator(const ConcurrentSkipListNodeBase *nodeBase) noexcept
+        : NodeBase(SkipMarkedInternal(nodeBase))
+    {
+    }
+
+    ReferenceAlias operator*() const noexcept
+    {
+        return *static_cast<const NodeAlias *>(this->NodeBase)->GetData();
+    }
+
+    PointerAlias operator->() const noexcept
+    {
+        return static_cast<const NodeAlias *>(this->NodeBase)->GetData();
+    }
+
+    const KeyTypeAlias &GetKey() const noexcept
+    {
+        return *static_cast<const NodeAlias *>(this->NodeBase)->GetKey();
+    }
+
+    SelfAlias &operator++() noexcept
+    {
+        this->NodeBase = SkipMarkedInternal(this->NodeBase->GetNext(0));
+        return *this;
+    }
+
+    SelfAlias operator++(int) noexcept
+    {
+        SelfAlias temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    friend bool operator!=(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.NodeBase != rhs.NodeBase;
+    }
+
+    friend bool operator==(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.NodeBase == rhs.NodeBase;
+    }
+
+  private:
+    static const ConcurrentSkipListNodeBase *SkipMarkedInternal(const ConcurrentSkipListNodeBase *nodeBase) noexcept
+    {
+        while (nodeBase && nodeBase->IsMarked())
+        {
+            nodeBase = nodeBase->GetNext(0);
+        }
+        return nodeBase;
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_CONCURRENT_SKIP_LIST_ITERATOR_HPP
@@ -0,0 +1,133 @@
+#ifndef DSA_LIBRARIES_CONCURRENT_SKIP_LIST_NODE_HPP
+#define DSA_LIBRARIES_CONCURRENT_SKIP_LIST_NODE_HPP
+#include "../../Utilities/AlignedBuffer.hpp"
+#include "../../Utilities/EpochReclamation.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Tower of a skip list node. Every level holds a marked link: the low bit of PointerNext[level] flags the
+ * owning node as logically deleted at that level, so a successor can never be CAS-linked behind a dying node.
+ */
+struct ConcurrentSkipListNodeBase : public Utilities::EpochRetiredNode
+{
+    using LinkAlias = std::uintptr_t;
+
+    static constexpr LinkAlias MarkBit = 1;
+    static constexpr std::uint8_t InsertFinishedFlag = 1;
+    static constexpr std::uint8_t RemoveFinishedFlag = 2;
+
+    std::atomic<LinkAlias> *PointerNext = nullptr;
+    std::uint32_t Height = 0;
+    std::atomic<std::uint8_t> State{0};
+
+    ConcurrentSkipListNodeBase() = default;
+    ConcurrentSkipListNodeBase(const ConcurrentSkipListNodeBase &) = delete;
+    ConcurrentSkipListNodeBase &operator=(const ConcurrentSkipListNodeBase &) = delete;
+
+    static ConcurrentSkipListNodeBase *GetPointer(LinkAlias link) noexcept
+    {
+        return reinterpret_cast<ConcurrentSkipListNodeBase *>(link & ~MarkBit);
+    }
+
+    static bool IsMarked(LinkAlias link) noexcept
+    {
+        return (link & MarkBit) != 0;
+    }
+
+    static LinkAlias MakeLink(const ConcurrentSkipListNodeBase *nodeBase, bool marked = false) noexcept
+    {
+        return reinterpret_cast<LinkAlias>(nodeBase) | (marked ? MarkBit : 0);
+    }
+
+    LinkAlias LoadNext(std::uint32_t level) const noexcept
+    {
+        return this->PointerNext[level].load(std::memory_order_acquire);
+    }
+
+    ConcurrentSkipListNodeBase *GetNext(std::uint32_t level) const noexcept
+    {
+        return GetPointer(this->LoadNext(level));
+    }
+
+    bool IsMarked() const noexcept
+    {
+        return IsMarked(this->LoadNext(0));
+    }
+
+    bool CompareExchangeNext(std::uint32_t level, LinkAlias &expected, LinkAlias desired) noexcept
+    {
+        return this->PointerNext[level].compare_exchange_strong(expected, desired, std::memory_order_acq_rel,
+                                                                std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Set the mark bit at the given level.
+     * @return true if this call was the one that marked the level.
+     */
+    bool MarkNext(std::uint32_t level) noexcept
+    {
+        LinkAlias link = this->LoadNext(level);
+        while (!IsMarked(link))
+        {
+            if (this->PointerNext[level].compare_exchange_weak(link, link | MarkBit, std::memory_order_acq_rel,
+                                                               std::memory_order_acquire))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Node with a key, a value and a variable height tower. The tower lives in the same allocation, right after
+ * the node, so that a node costs a single allocation regardless of its height.
+ */
+template <typename K, typename V> struct ConcurrentSkipListNode : public ConcurrentSkipListNodeBase
+{
+    ConcurrentSkipListNode() = default;
+
+    Utilities::AlignedBuffer<K> key;
+    Utilities::AlignedBuffer<V> data;
+
+    static constexpr std::size_t GetAllocationUnits(std::uint32_t height) noexcept
+    {
+        const std::size_t towerBytes = height * sizeof(std::atomic<LinkAlias>);
+        return 1 + (towerBytes + sizeof(ConcurrentSkipListNode) - 1) / sizeof(ConcurrentSkipListNode);
+    }
+
+    void InitializeTower(std::uint32_t height) noexcept
+    {
+        this->Height = height;
+        this->PointerNext = reinterpret_cast<std::atomic<LinkAlias> *>(this + 1);
+        for (std::uint32_t level = 0; level < height; ++level)
+        {
+            ::new (static_cast<void *>(this->PointerNext + level)) std::atomic<LinkAlias>(0);
+        }
+    }
+
+    K *GetKey() noexcept
+    {
+        return key.Pointer();
+    }
+
+    const K *GetKey() const noexcept
+    {
+        return key.Pointer();
+    }
+
+    V *GetData() noexcept
+    {
+        return data.Pointer();
+    }
+
+    const V *GetData() const noexcept
+    {
+        return data.Pointer();
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_CONCURRENT_SKIP_LIST_NODE_HPP
@@ -5,9 +5,12 @@
 #ifndef DSA_LIBRARIES_STACK_H
 #define DSA_LIBRARIES_STACK_H
 
+#include "../../Utilities/Allocator.hpp"
 #include "../../Utilities/Exception.hpp"
 #include "StackExceptions.hpp"
 #include <algorithm>
+#include <cstddef>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -24,7 +27,7 @@ class StackBase
 
     [[nodiscard]] bool IsEmpty() const
     {
-        return TopIndex == 0;
+        return CurrentSize == 0;
     }
 
     [[nodiscard]] bool IsFull() const
@@ -244,6 +247,11 @@ template <typename T> class IterStack : public Containers::StackBase
         }
     }
 
+    T* GetBufferInternal() const noexcept
+    {
+        return _bufferInternal;
+    }
+
     IterStack(T* buffer, SizeTypeAlias capacity)
         : _stackBaseAlias(capacity), _bufferInternal(buffer){
 
@@ -297,6 +305,41 @@ template <typename T, const size_t SIZE> class Stack : public Containers::IterSt
         return *this;
     }
 };
+
+/**
+ * @brief Stack whose capacity is chosen at run time. The buffer is allocated once, up front, so Push never
+ * reallocates; useful when the worst-case depth is known (e.g. the vertex count of a graph walk).
+ */
+template <typename T, typename Alloc = Utilities::Allocator<T>> class BoundedStack : public Containers::IterStack<T>
+{
+  private:
+    typedef std::allocator_traits<Alloc> AllocatorTraitsAlias;
+
+    Alloc _allocator;
+
+    static T* AllocateInternal(Alloc allocator, size_t capacity)
+    {
+        return capacity != 0 ? AllocatorTraitsAlias::allocate(allocator, capacity) : nullptr;
+    }
+
+  public:
+    explicit BoundedStack(size_t capacity, const Alloc& allocator = Alloc())
+        : Containers::IterStack<T>(AllocateInternal(allocator, capacity), capacity), _allocator(allocator)
+    {
+    }
+
+    BoundedStack(const BoundedStack&) = delete;
+    BoundedStack& operator=(const BoundedStack&) = delete;
+
+    ~BoundedStack()
+    {
+        Containers::IterStack<T>::Clear();
+        if (T* buffer = this->GetBufferInternal())
+        {
+            AllocatorTraitsAlias::deallocate(_allocator, buffer, this->GetMaxSize());
+        }
+    }
+};
 } // namespace DSALibraries
 
 #endif // LIBRARIES_STACK_H
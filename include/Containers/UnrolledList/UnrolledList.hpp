@@ -0,0 +1,569 @@
+#ifndef DSA_LIBRARIES_UNROLLED_LIST_HPP
+#define DSA_LIBRARIES_UNROLLED_LIST_HPP
+#include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Memory.hpp"
+#include "UnrolledListExceptions.hpp"
+#include "UnrolledListIterator.hpp"
+#include "UnrolledListNode.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Doubly linked list that packs several elements into each node, so a traversal takes one cache miss per
+ * node instead of one per element and the link overhead is shared by the whole node.
+ *
+ * Each node holds up to ElementsPerNode elements, sized so the node fills about NodeBytes. Inserting into a full node
+ * splits it in half; a node that falls below half full on erase merges with its successor when both fit in one
+ * node and borrows the successor's first element otherwise. Inserting or erasing invalidates iterators into the nodes
+ * it touches.
+ */
+template <typename T, std::size_t NodeBytes = 256, typename Alloc = Utilities::Allocator<T>> class UnrolledList
+{
+  public:
+    static constexpr std::size_t ElementsPerNode =
+        NodeBytes > sizeof(UnrolledListNodeBase) + 2 * sizeof(T)
+            ? (NodeBytes - sizeof(UnrolledListNodeBase)) / sizeof(T)
+            : 2;
+
+    using NodeAlias = UnrolledListNode<T, ElementsPerNode>;
+    using ValueTypeAlias = T;
+    using PointerAlias = T *;
+    using ConstPointerAlias = const T *;
+    using ReferenceAlias = T &;
+    using ConstReferenceAlias = const T &;
+    using IteratorAlias = UnrolledListIterator<T, ElementsPerNode>;
+    using ConstIteratorAlias = UnrolledListConstIterator<T, ElementsPerNode>;
+    using SizeTypeAlias = std::size_t;
+    using DifferenceTypeAlias = std::ptrdiff_t;
+    using AllocatorTypeAlias = Alloc;
+    using NodeAllocatorTypeAlias = typename std::allocator_traits<Alloc>::template rebind_alloc<NodeAlias>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using pointer = PointerAlias;
+    using const_pointer = ConstPointerAlias;
+    using reference = ReferenceAlias;
+    using const_reference = ConstReferenceAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+    using size_type = SizeTypeAlias;
+    using difference_type = DifferenceTypeAlias;
+    using allocator_type = AllocatorTypeAlias;
+
+  private:
+    UnrolledListNodeBase _head;
+    SizeTypeAlias _size = 0;
+    NodeAllocatorTypeAlias _nodeAllocator;
+
+    static PointerAlias DataInternal(UnrolledListNodeBase *nodeBase) noexcept
+    {
+        return static_cast<NodeAlias *>(nodeBase)->GetData();
+    }
+
+    UnrolledListNodeBase *CreateNodeBeforeInternal(UnrolledListNodeBase *position)
+    {
+        NodeAlias *node = ::new (static_cast<void *>(_nodeAllocator.allocate(1))) NodeAlias();
+        node->HookBeforeInternal(position);
+        return node;
+    }
+
+    void DestroyNodeInternal(UnrolledListNodeBase *nodeBase) noexcept
+    {
+        auto *node = static_cast<NodeAlias *>(nodeBase);
+        Utilities::DestroyElements(node->GetData(), node->Count);
+        node->UnhookInternal();
+        node->~NodeAlias();
+        _nodeAllocator.deallocate(node, 1);
+    }
+
+    /** Move the elements of source from index on to the end of target. */
+    static void MoveTailInternal(UnrolledListNodeBase *source, SizeTypeAlias index, UnrolledListNodeBase *target)
+    {
+        PointerAlias from = DataInternal(source);
+        PointerAlias to = DataInternal(target);
+        for (SizeTypeAlias i = index; i < source->Count; ++i)
+        {
+            ::new (static_cast<void *>(to + target->Count)) ValueTypeAlias(std::move(from[i]));
+            ++target->Count;
+        }
+        Utilities::DestroyElements(from + index, source->Count - index);
+        source->Count = index;
+    }
+
+    /** Split nodeBase at index, leaving the elements from index on in a new node right after it. */
+    UnrolledListNodeBase *SplitInternal(UnrolledListNodeBase *nodeBase, SizeTypeAlias index)
+    {
+        UnrolledListNodeBase *node = CreateNodeBeforeInternal(nodeBase->PointerNext);
+        MoveTailInternal(nodeBase, index, node);
+        return node;
+    }
+
+    template <typename... Args>
+    IteratorAlias EmplaceInternal(UnrolledListNodeBase *nodeBase, SizeTypeAlias index, Args &&...args)
+    {
+        // Built up front, so arguments referring into this list stay valid while elements are shifted.
+        ValueTypeAlias value(std::forward<Args>(args)...);
+        UnrolledListNodeBase *previous = nodeBase->PointerPrev;
+        if (index == 0 && previous != &_head && previous->Count < ElementsPerNode)
+        {
+            nodeBase = previous;
+            index = previous->Count;
+        }
+        else if (nodeBase == &_head)
+        {
+            nodeBase = CreateNodeBeforeInternal(&_head);
+        }
+        else if (nodeBase->Count == ElementsPerNode)
+        {
+            const SizeTypeAlias half = ElementsPerNode / 2;
+            UnrolledListNodeBase *upper = SplitInternal(nodeBase, half);
+            if (index > half)
+            {
+                nodeBase = upper;
+                index -= half;
+            }
+        }
+        PointerAlias data = DataInternal(nodeBase);
+        const SizeTypeAlias count = nodeBase->Count;
+        if (index == count)
+        {
+            ::new (static_cast<void *>(data + count)) ValueTypeAlias(std::move(value));
+        }
+        else
+        {
+            ::new (static_cast<void *>(data + count)) ValueTypeAlias(std::move(data[count - 1]));
+            std::move_backward(data + index, data + count - 1, data + count);
+            data[index] = std::move(value);
+        }
+        ++nodeBase->Count;
+        ++_size;
+        return IteratorAlias(nodeBase, index);
+    }
+
+    IteratorAlias EraseInternal(UnrolledListNodeBase *nodeBase, SizeTypeAlias index)
+    {
+        PointerAlias data = DataInternal(nodeBase);
+        std::move(data + index + 1, data + nodeBase->Count, data + index);
+        Utilities::DestroyAt(data + nodeBase->Count - 1);
+        --nodeBase->Count;
+        --_size;
+        UnrolledListNodeBase *next = nodeBase->PointerNext;
+        if (nodeBase->Count == 0)
+        {
+            DestroyNodeInternal(nodeBase);
+            return IteratorAlias(next, 0);
+        }
+        if (next != &_head && nodeBase->Count < ElementsPerNode / 2)
+        {
+            if (nodeBase->Count + next->Count <= ElementsPerNode)
+            {
+                MoveTailInternal(next, 0, nodeBase);
+                DestroyNodeInternal(next);
+            }
+            else
+            {
+                // Borrow the successor's first element, which keeps every node but the last at least half full.
+                PointerAlias nextData = DataInternal(next);
+                ::new (static_cast<void *>(data + nodeBase->Count)) ValueTypeAlias(std::move(nextData[0]));
+                ++nodeBase->Count;
+                std::move(nextData + 1, nextData + next->Count, nextData);
+                Utilities::DestroyAt(nextData + next->Count - 1);
+                --next->Count;
+            }
+        }
+        if (index < nodeBase->Count)
+        {
+            return IteratorAlias(nodeBase, index);
+        }
+        return IteratorAlias(nodeBase->PointerNext, 0);
+    }
+
+    /** Move the chain hanging off source onto target, which must not hold one; source is left empty. */
+    static void RelinkInternal(UnrolledListNodeBase &target, UnrolledListNodeBase &source) noexcept
+    {
+        if (source.PointerNext == &source)
+        {
+            target.PointerNext = target.PointerPrev = &target;
+            return;
+        }
+        target.PointerNext = source.PointerNext;
+        target.PointerPrev = source.PointerPrev;
+        target.PointerNext->PointerPrev = &target;
+        target.PointerPrev->PointerNext = &target;
+        source.PointerNext = source.PointerPrev = &source;
+    }
+
+    void SpliceInternal(ConstIteratorAlias position, UnrolledList &list)
+    {
+        if (&list == this || list._size == 0)
+        {
+            return;
+        }
+        auto *nodeBase = const_cast<UnrolledListNodeBase *>(position.NodeBase);
+        if (position.Index > 0)
+        {
+            nodeBase = SplitInternal(nodeBase, position.Index);
+        }
+        UnrolledListNodeBase *first = list._head.PointerNext;
+        UnrolledListNodeBase *last = list._head.PointerPrev;
+        first->PointerPrev = nodeBase->PointerPrev;
+        nodeBase->PointerPrev->PointerNext = first;
+        last->PointerNext = nodeBase;
+        nodeBase->PointerPrev = last;
+        _size += list._size;
+        list._head.PointerNext = list._head.PointerPrev = &list._head;
+        list._size = 0;
+    }
+
+  public:
+    UnrolledList() = default;
+
+    explicit UnrolledList(const AllocatorTypeAlias &allocator) : _nodeAllocator(allocator)
+    {
+    }
+
+    UnrolledList(std::initializer_list<ValueTypeAlias> init, const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : _nodeAllocator(allocator)
+    {
+        for (const auto &value : init)
+        {
+            PushBack(value);
+        }
+    }
+
+    template <std::input_iterator InputIterator>
+    UnrolledList(InputIterator begin, InputIterator end, const AllocatorTypeAlias &allocator = AllocatorTypeAlias())
+        : _nodeAllocator(allocator)
+    {
+        for (; begin != end; ++begin)
+        {
+            PushBack(*begin);
+        }
+    }
+
+    UnrolledList(const UnrolledList &list)
+        : _nodeAllocator(std::allocator_traits<NodeAllocatorTypeAlias>::select_on_container_copy_construction(
+              list._nodeAllocator))
+    {
+        for (const auto &value : list)
+        {
+            PushBack(value);
+        }
+    }
+
+    UnrolledList(UnrolledList &&list) noexcept : _nodeAllocator(std::move(list._nodeAllocator))
+    {
+        RelinkInternal(_head, list._head);
+        _size = std::exchange(list._size, 0);
+    }
+
+    UnrolledList &operator=(const UnrolledList &list)
+    {
+        if (this != &list)
+        {
+            UnrolledList temp(list);
+            Swap(temp);
+        }
+        return *this;
+    }
+
+    UnrolledList &operator=(UnrolledList &&list) noexcept
+    {
+        if (this != &list)
+        {
+            Clear();
+            _nodeAllocator = std::move(list._nodeAllocator);
+            RelinkInternal(_head, list._head);
+            _size = std::exchange(list._size, 0);
+        }
+        return *this;
+    }
+
+    ~UnrolledList()
+    {
+        Clear();
+    }
+
+    AllocatorTypeAlias GetAllocator() const noexcept
+    {
+        return AllocatorTypeAlias(_nodeAllocator);
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() noexcept
+    {
+        return GetBegin();
+    }
+
+    ConstIteratorAlias begin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cbegin() const noexcept
+    {
+        return GetConstBegin();
+    }
+
+    IteratorAlias end() noexcept
+    {
+        return GetEnd();
+    }
+
+    ConstIteratorAlias end() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias cend() const noexcept
+    {
+        return GetConstEnd();
+    }
+
+    [[maybe_unused]] IteratorAlias before_begin() noexcept
+    {
+        return GetBeginFromHead();
+    }
+
+    [[maybe_unused]] ConstIteratorAlias before_begin() const noexcept
+    {
+        return GetConstBeginFromHead();
+    }
+    // End Zone Adaptive Iterator
+
+    /** The position before the first element, which is the end position as in DList. */
+    IteratorAlias GetBeginFromHead() noexcept
+    {
+        return IteratorAlias(&_head, 0);
+    }
+
+    ConstIteratorAlias GetConstBeginFromHead() const noexcept
+    {
+        return ConstIteratorAlias(&_head, 0);
+    }
+
+    IteratorAlias GetBegin() noexcept
+    {
+        return IteratorAlias(_head.PointerNext, 0);
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return ConstIteratorAlias(_head.PointerNext, 0);
+    }
+
+    IteratorAlias GetEnd() noexcept
+    {
+        return IteratorAlias(&_head, 0);
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return ConstIteratorAlias(&_head, 0);
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** Number of nodes in use; GetSize() / GetNodeCount() is the fill the split and merge policy maintains. */
+    [[nodiscard]] SizeTypeAlias GetNodeCount() const noexcept
+    {
+        SizeTypeAlias count = 0;
+        for (const UnrolledListNodeBase *node = _head.PointerNext; node != &_head; node = node->PointerNext)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    ReferenceAlias GetItemFront()
+    {
+        if (IsEmpty())
+        {
+            throw UnrolledListEmptyException(__FILE__, __LINE__);
+        }
+        return *GetBegin();
+    }
+
+    ConstReferenceAlias GetItemFront() const
+    {
+        if (IsEmpty())
+        {
+            throw UnrolledListEmptyException(__FILE__, __LINE__);
+        }
+        return *GetConstBegin();
+    }
+
+    ReferenceAlias GetItemBack()
+    {
+        if (IsEmpty())
+        {
+            throw UnrolledListEmptyException(__FILE__, __LINE__);
+        }
+        return DataInternal(_head.PointerPrev)[_head.PointerPrev->Count - 1];
+    }
+
+    ConstReferenceAlias GetItemBack() const
+    {
+        if (IsEmpty())
+        {
+            throw UnrolledListEmptyException(__FILE__, __LINE__);
+        }
+        return static_cast<const NodeAlias *>(_head.PointerPrev)->GetData()[_head.PointerPrev->Count - 1];
+    }
+
+    void PushBack(const ValueTypeAlias &value)
+    {
+        EmplaceInternal(&_head, 0, value);
+    }
+
+    void PushBack(ValueTypeAlias &&value)
+    {
+        EmplaceInternal(&_head, 0, std::move(value));
+    }
+
+    template <typename... Args> ReferenceAlias EmplaceBack(Args &&...args)
+    {
+        return *EmplaceInternal(&_head, 0, std::forward<Args>(args)...);
+    }
+
+    void PushFront(const ValueTypeAlias &value)
+    {
+        EmplaceInternal(_head.PointerNext, 0, value);
+    }
+
+    void PushFront(ValueTypeAlias &&value)
+    {
+        EmplaceInternal(_head.PointerNext, 0, std::move(value));
+    }
+
+    template <typename... Args> ReferenceAlias EmplaceFront(Args &&...args)
+    {
+        return *EmplaceInternal(_head.PointerNext, 0, std::forward<Args>(args)...);
+    }
+
+    void PopBack()
+    {
+        if (IsEmpty())
+        {
+            throw UnrolledListEmptyException(__FILE__, __LINE__);
+        }
+        EraseInternal(_head.PointerPrev, _head.PointerPrev->Count - 1);
+    }
+
+    void PopFront()
+    {
+        if (IsEmpty())
+        {
+            throw UnrolledListEmptyException(__FILE__, __LINE__);
+        }
+        EraseInternal(_head.PointerNext, 0);
+    }
+
+    /** Insert before position and return an iterator to the new element. */
+    IteratorAlias Insert(ConstIteratorAlias position, const ValueTypeAlias &value)
+    {
+        return Emplace(position, value);
+    }
+
+    IteratorAlias Insert(ConstIteratorAlias position, ValueTypeAlias &&value)
+    {
+        return Emplace(position, std::move(value));
+    }
+
+    template <typename... Args> IteratorAlias Emplace(ConstIteratorAlias position, Args &&...args)
+    {
+        IteratorAlias target = position.ConstCast();
+        return EmplaceInternal(target.NodeBase, target.Index, std::forward<Args>(args)...);
+    }
+
+    /** Insert after position, where GetBeginFromHead() inserts at the front, as in DList. */
+    template <typename... Args> IteratorAlias EmplaceAfter(ConstIteratorAlias position, Args &&...args)
+    {
+        IteratorAlias target = position.NodeBase == &_head ? GetBegin() : std::next(position.ConstCast());
+        return EmplaceInternal(target.NodeBase, target.Index, std::forward<Args>(args)...);
+    }
+
+    IteratorAlias InsertAfter(ConstIteratorAlias position, const ValueTypeAlias &value)
+    {
+        return EmplaceAfter(position, value);
+    }
+
+    /** Erase the element at position and return an iterator to the element that followed it. */
+    IteratorAlias Erase(ConstIteratorAlias position)
+    {
+        IteratorAlias target = position.ConstCast();
+        return EraseInternal(target.NodeBase, target.Index);
+    }
+
+    IteratorAlias Erase(ConstIteratorAlias first, ConstIteratorAlias last)
+    {
+        // Merges move elements between nodes, so last is not stable across the loop; count instead.
+        auto count = std::distance(first, last);
+        IteratorAlias current = first.ConstCast();
+        for (; count > 0; --count)
+        {
+            current = EraseInternal(current.NodeBase, current.Index);
+        }
+        return current;
+    }
+
+    void Clear() noexcept
+    {
+        while (_head.PointerNext != &_head)
+        {
+            DestroyNodeInternal(_head.PointerNext);
+        }
+        _size = 0;
+    }
+
+    /**
+     * Move all elements of list before position in O(1) plus at most one node split; list is left empty. The
+     * allocators must compare equal.
+     */
+    void Splice(ConstIteratorAlias position, UnrolledList &&list)
+    {
+        SpliceInternal(position, list);
+    }
+
+    void Splice(ConstIteratorAlias position, UnrolledList &list)
+    {
+        SpliceInternal(position, list);
+    }
+
+    /** Move all elements of list after position, where GetBeginFromHead() splices at the front, as in DList. */
+    void SpliceAfter(ConstIteratorAlias position, UnrolledList &&list)
+    {
+        SpliceAfter(position, list);
+    }
+
+    void SpliceAfter(ConstIteratorAlias position, UnrolledList &list)
+    {
+        SpliceInternal(position.NodeBase == &_head ? GetConstBegin() : std::next(position), list);
+    }
+
+    void Swap(UnrolledList &list) noexcept
+    {
+        UnrolledListNodeBase temp;
+        RelinkInternal(temp, _head);
+        RelinkInternal(_head, list._head);
+        RelinkInternal(list._head, temp);
+        std::swap(_size, list._size);
+        std::swap(_nodeAllocator, list._nodeAllocator);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_UNROLLED_LIST_HPP
@@ -0,0 +1,23 @@
+#ifndef DSA_LIBRARIES_UNROLLED_LIST_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_UNROLLED_LIST_EXCEPTIONS_HPP
+#include "../../Utilities/Exception.hpp"
+namespace DSALibraries::Containers
+{
+class UnrolledListException : public Utilities::Exception
+{
+  public:
+    UnrolledListException(string_type message, string_type fileText, int line)
+        : Exception(std::move(message), std::move(fileText), line)
+    {
+    }
+};
+class UnrolledListEmptyException : public UnrolledListException
+{
+  public:
+    UnrolledListEmptyException(string_type fileText, numeric_type line)
+        : UnrolledListException("Unrolled list is empty", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
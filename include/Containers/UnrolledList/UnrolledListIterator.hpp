@@ -0,0 +1,187 @@
+#ifndef DSA_LIBRARIES_UNROLLED_LIST_ITERATOR_HPP
+#define DSA_LIBRARIES_UNROLLED_LIST_ITERATOR_HPP
+#include "UnrolledListNode.hpp"
+#include <cstddef>
+#include <iterator>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Position of an element as its node and its index in the node; the end is index 0 of the sentinel.
+ */
+template <typename T, std::size_t Capacity> struct UnrolledListIterator
+{
+    UnrolledListNodeBase *NodeBase;
+    std::size_t Index;
+
+    using SelfAlias = UnrolledListIterator<T, Capacity>;
+    using NodeAlias = UnrolledListNode<T, Capacity>;
+    using ValueTypeAlias = T;
+    using PointerAlias = T *;
+    using ReferenceAlias = T &;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    UnrolledListIterator() noexcept : NodeBase(), Index()
+    {
+    }
+
+    UnrolledListIterator(UnrolledListNodeBase *nodeBase, std::size_t index) noexcept
+        : NodeBase(nodeBase), Index(index)
+    {
+    }
+
+    ReferenceAlias operator*() const noexcept
+    {
+        return static_cast<NodeAlias *>(this->NodeBase)->GetData()[this->Index];
+    }
+
+    PointerAlias operator->() const noexcept
+    {
+        return static_cast<NodeAlias *>(this->NodeBase)->GetData() + this->Index;
+    }
+
+    SelfAlias &operator++() noexcept
+    {
+        if (++this->Index == this->NodeBase->Count)
+        {
+            this->NodeBase = this->NodeBase->PointerNext;
+            this->Index = 0;
+        }
+        return *this;
+    }
+
+    SelfAlias operator++(int) noexcept
+    {
+        SelfAlias temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    SelfAlias &operator--() noexcept
+    {
+        if (this->Index == 0)
+        {
+            this->NodeBase = this->NodeBase->PointerPrev;
+            this->Index = this->NodeBase->Count;
+        }
+        --this->Index;
+        return *this;
+    }
+
+    SelfAlias operator--(int) noexcept
+    {
+        SelfAlias temp(*this);
+        --*this;
+        return temp;
+    }
+
+    friend bool operator==(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.NodeBase == rhs.NodeBase && lhs.Index == rhs.Index;
+    }
+
+    friend bool operator!=(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <typename T, std::size_t Capacity> struct UnrolledListConstIterator
+{
+    const UnrolledListNodeBase *NodeBase;
+    std::size_t Index;
+
+    using SelfAlias = UnrolledListConstIterator<T, Capacity>;
+    using NodeAlias = UnrolledListNode<T, Capacity>;
+    using IteratorAlias = UnrolledListIterator<T, Capacity>;
+    using ValueTypeAlias = T;
+    using PointerAlias = const T *;
+    using ReferenceAlias = const T &;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    UnrolledListConstIterator() noexcept : NodeBase(), Index()
+    {
+    }
+
+    UnrolledListConstIterator(const UnrolledListNodeBase *nodeBase, std::size_t index) noexcept
+        : NodeBase(nodeBase), Index(index)
+    {
+    }
+
+    UnrolledListConstIterator(const IteratorAlias &iter) noexcept : NodeBase(iter.NodeBase), Index(iter.Index)
+    {
+    }
+
+    [[nodiscard]] IteratorAlias ConstCast() const noexcept
+    {
+        return IteratorAlias(const_cast<UnrolledListNodeBase *>(this->NodeBase), this->Index);
+    }
+
+    ReferenceAlias operator*() const noexcept
+    {
+        return static_cast<const NodeAlias *>(this->NodeBase)->GetData()[this->Index];
+    }
+
+    PointerAlias operator->() const noexcept
+    {
+        return static_cast<const NodeAlias *>(this->NodeBase)->GetData() + this->Index;
+    }
+
+    SelfAlias &operator++() noexcept
+    {
+        if (++this->Index == this->NodeBase->Count)
+        {
+            this->NodeBase = this->NodeBase->PointerNext;
+            this->Index = 0;
+        }
+        return *this;
+    }
+
+    SelfAlias operator++(int) noexcept
+    {
+        SelfAlias temp(*this);
+        ++*this;
+        return temp;
+    }
+
+    SelfAlias &operator--() noexcept
+    {
+        if (this->Index == 0)
+        {
+            this->NodeBase = this->NodeBase->PointerPrev;
+            this->Index = this->NodeBase->Count;
+        }
+        --this->Index;
+        return *this;
+    }
+
+    SelfAlias operator--(int) noexcept
+    {
+        SelfAlias temp(*this);
+        --*this;
+        return temp;
+    }
+
+    friend bool operator==(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return lhs.NodeBase == rhs.NodeBase && lhs.Index == rhs.Index;
+    }
+
+    friend bool operator!=(const SelfAlias &lhs, const SelfAlias &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_UNROLLED_LIST_ITERATOR_HPP
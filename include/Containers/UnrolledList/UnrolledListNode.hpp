@@ -0,0 +1,53 @@
+#ifndef DSA_LIBRARIES_UNROLLED_LIST_NODE_HPP
+#define DSA_LIBRARIES_UNROLLED_LIST_NODE_HPP
+#include <cstddef>
+#include <new>
+namespace DSALibraries::Containers
+{
+struct UnrolledListNodeBase
+{
+    UnrolledListNodeBase *PointerNext = this;
+    UnrolledListNodeBase *PointerPrev = this;
+    /** Constructed elements, packed at the front of the node; always 0 for the sentinel. */
+    std::size_t Count = 0;
+
+    UnrolledListNodeBase() = default;
+    UnrolledListNodeBase(const UnrolledListNodeBase &) = delete;
+    UnrolledListNodeBase &operator=(const UnrolledListNodeBase &) = delete;
+
+    void HookBeforeInternal(UnrolledListNodeBase *nodeBase) noexcept
+    {
+        this->PointerNext = nodeBase;
+        this->PointerPrev = nodeBase->PointerPrev;
+        nodeBase->PointerPrev->PointerNext = this;
+        nodeBase->PointerPrev = this;
+    }
+
+    void UnhookInternal() noexcept
+    {
+        this->PointerPrev->PointerNext = this->PointerNext;
+        this->PointerNext->PointerPrev = this->PointerPrev;
+    }
+};
+
+/**
+ * @brief Node holding up to Capacity elements in place, so a traversal touches one node per Capacity elements.
+ */
+template <typename T, std::size_t Capacity> struct UnrolledListNode : public UnrolledListNodeBase
+{
+    UnrolledListNode() = default;
+
+    alignas(T) unsigned char Storage[Capacity * sizeof(T)];
+
+    T *GetData() noexcept
+    {
+        return std::launder(reinterpret_cast<T *>(Storage));
+    }
+
+    const T *GetData() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T *>(Storage));
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_UNROLLED_LIST_NODE_HPP
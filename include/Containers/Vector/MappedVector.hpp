@@ -0,0 +1,453 @@
+#ifndef DSA_LIBRARIES_MAPPED_VECTOR_HPP
+#define DSA_LIBRARIES_MAPPED_VECTOR_HPP
+#include "MappedVectorExceptions.hpp"
+#include "VectorExceptions.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+namespace DSALibraries::Containers
+{
+enum class MappedVectorMode
+{
+    ReadOnly,
+    /** Open the file, creating it if missing, and keep its records. */
+    ReadWrite,
+    /** Open the file, creating it if missing, and drop its records. */
+    Truncate
+};
+
+/** Access pattern hints forwarded to madvise. */
+enum class MappedAdvice
+{
+    Normal,
+    Sequential,
+    Random,
+    WillNeed,
+    DontNeed,
+    HugePage
+};
+
+/**
+ * @brief Vector of fixed-layout records living in a shared file mapping.
+ *
+ * Opening maps the file without reading it, so pages load lazily on first touch. Growth extends the file with
+ * ftruncate and the mapping with mremap (a fresh mmap outside Linux); the file is trimmed back to the
+ * records in use when the vector is closed. Records are the raw bytes of T, so the file is only portable between
+ * builds with the same layout and byte order.
+ */
+template <typename T> class MappedVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "MappedVector stores records as raw bytes");
+
+  public:
+    using ValueTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using ReferenceAlias = T &;
+    using ConstReferenceAlias = const T &;
+    using PointerAlias = T *;
+    using ConstPointerAlias = const T *;
+    using IteratorAlias = T *;
+    using ConstIteratorAlias = const T *;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+    using reference = ReferenceAlias;
+    using const_reference = ConstReferenceAlias;
+    using pointer = PointerAlias;
+    using const_pointer = ConstPointerAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+
+  private:
+    int _file = -1;
+    PointerAlias _data = nullptr;
+    SizeTypeAlias _size = 0;
+    SizeTypeAlias _capacity = 0;
+    bool _isReadOnly = false;
+    MappedAdvice _advice = MappedAdvice::Normal;
+
+  public:
+    MappedVector() noexcept = default;
+
+    explicit MappedVector(const std::filesystem::path &path, MappedVectorMode mode = MappedVectorMode::ReadWrite)
+    {
+        this->Open(path, mode);
+    }
+
+    MappedVector(const MappedVector &) = delete;
+    MappedVector &operator=(const MappedVector &) = delete;
+
+    MappedVector(MappedVector &&other) noexcept
+    {
+        this->Swap(other);
+    }
+
+    MappedVector &operator=(MappedVector &&other) noexcept
+    {
+        if (this != &other)
+        {
+            this->Close();
+            this->Swap(other);
+        }
+        return *this;
+    }
+
+    ~MappedVector()
+    {
+        this->Close();
+    }
+
+    /**
+     * @brief Map path; whatever was open before is closed first.
+     */
+    void Open(const std::filesystem::path &path, MappedVectorMode mode = MappedVectorMode::ReadWrite)
+    {
+        this->Close();
+        int flags = O_RDONLY;
+        if (mode == MappedVectorMode::ReadWrite)
+        {
+            flags = O_RDWR | O_CREAT;
+        }
+        else if (mode == MappedVectorMode::Truncate)
+        {
+            flags = O_RDWR | O_CREAT | O_TRUNC;
+        }
+        const int file = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (file < 0)
+        {
+            throw MappedVectorIOException(__FILE__, __LINE__);
+        }
+
+        struct stat status{};
+        if (::fstat(file, &status) != 0)
+        {
+            ::close(file);
+            throw MappedVectorIOException(__FILE__, __LINE__);
+        }
+        const auto bytes = static_cast<SizeTypeAlias>(status.st_size);
+        if (bytes % sizeof(T) != 0)
+        {
+            ::close(file);
+            throw MappedVectorInvalidFileException(__FILE__, __LINE__);
+        }
+
+        _file = file;
+        _isReadOnly = mode == MappedVectorMode::ReadOnly;
+        _advice = MappedAdvice::Normal;
+        if (bytes > 0)
+        {
+            void *data = ::mmap(nullptr, bytes, this->GetProtectionInternal(), MAP_SHARED, _file, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(_file);
+                _file = -1;
+                throw MappedVectorIOException(__FILE__, __LINE__);
+            }
+            _data = static_cast<PointerAlias>(data);
+        }
+        _size = _capacity = bytes / sizeof(T);
+    }
+
+    /**
+     * @brief Unmap, trim the file to the records in use and close it. Unflushed pages are still written back by the
+     * kernel; call Sync first to wait for them.
+     */
+    void Close() noexcept
+    {
+        if (_file < 0)
+        {
+            return;
+        }
+        if (_data)
+        {
+            ::munmap(_data, _capacity * sizeof(T));
+        }
+        if (!_isReadOnly && _size != _capacity)
+        {
+            static_cast<void>(::ftruncate(_file, static_cast<off_t>(_size * sizeof(T))));
+        }
+        ::close(_file);
+        _file = -1;
+        _data = nullptr;
+        _size = _capacity = 0;
+    }
+
+    [[nodiscard]] bool IsOpen() const noexcept
+    {
+        return _file >= 0;
+    }
+
+    [[nodiscard]] bool IsReadOnly() const noexcept
+    {
+        return _isReadOnly;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCapacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] PointerAlias GetData() noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] ConstPointerAlias GetData() const noexcept
+    {
+        return _data;
+    }
+
+    IteratorAlias GetBegin() noexcept
+    {
+        return _data;
+    }
+
+    IteratorAlias GetEnd() noexcept
+    {
+        return _data + _size;
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return _data;
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return _data + _size;
+    }
+
+    ReferenceAlias operator[](SizeTypeAlias index) noexcept
+    {
+        return _data[index];
+    }
+
+    ConstReferenceAlias operator[](SizeTypeAlias index) const noexcept
+    {
+        return _data[index];
+    }
+
+    ReferenceAlias At(SizeTypeAlias index)
+    {
+        if (index >= _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return _data[index];
+    }
+
+    void PushBack(const ValueTypeAlias &value)
+    {
+        this->CheckWritableInternal();
+        if (_size == _capacity)
+        {
+            this->RemapInternal(this->GetGrowthInternal());
+        }
+        _data[_size++] = value;
+    }
+
+    void PopBack()
+    {
+        this->CheckWritableInternal();
+        if (_size == 0)
+        {
+            throw VectorEmptyException(__FILE__, __LINE__);
+        }
+        --_size;
+    }
+
+    /**
+     * @brief Grow or shrink to size records; new records are value-initialized.
+     */
+    void Resize(SizeTypeAlias size)
+    {
+        this->CheckWritableInternal();
+        if (size > _capacity)
+        {
+            this->RemapInternal(size);
+        }
+        for (SizeTypeAlias i = _size; i < size; ++i)
+        {
+            _data[i] = ValueTypeAlias();
+        }
+        _size = size;
+    }
+
+    /** Reserve room for size records in the file and the mapping. */
+    void Reverse(SizeTypeAlias size)
+    {
+        this->CheckWritableInternal();
+        if (size > _capacity)
+        {
+            this->RemapInternal(size);
+        }
+    }
+
+    void ShrinkToFit()
+    {
+        this->CheckWritableInternal();
+        if (_size != _capacity)
+        {
+            this->RemapInternal(_size);
+        }
+    }
+
+    void Clear()
+    {
+        this->CheckWritableInternal();
+        _size = 0;
+    }
+
+    /**
+     * @brief Hint the access pattern of the whole mapping. Sequential, Random and HugePage are kept across growth;
+     * WillNeed starts readahead and DontNeed drops the cached pages now.
+     * @return Whether the kernel accepted the hint; HugePage needs a filesystem with huge page support.
+     */
+    bool Advise(MappedAdvice advice) noexcept
+    {
+        _advice = advice;
+        return _data == nullptr || this->AdviseInternal(advice);
+    }
+
+    /**
+     * @brief Write dirty pages back to the file; with isAsync the write is only scheduled.
+     */
+    void Sync(bool isAsync = false)
+    {
+        if (_data && ::msync(_data, _capacity * sizeof(T), isAsync ? MS_ASYNC : MS_SYNC) != 0)
+        {
+            throw MappedVectorIOException(__FILE__, __LINE__);
+        }
+    }
+
+    void Swap(MappedVector &other) noexcept
+    {
+        std::swap(_file, other._file);
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        std::swap(_capacity, other._capacity);
+        std::swap(_isReadOnly, other._isReadOnly);
+        std::swap(_advice, other._advice);
+    }
+
+  private:
+    int GetProtectionInternal() const noexcept
+    {
+        return _isReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    }
+
+    void CheckWritableInternal() const
+    {
+        if (_file < 0 || _isReadOnly)
+        {
+            throw MappedVectorReadOnlyException(__FILE__, __LINE__);
+        }
+    }
+
+    SizeTypeAlias GetGrowthInternal() const noexcept
+    {
+        const SizeTypeAlias page = static_cast<SizeTypeAlias>(::sysconf(_SC_PAGESIZE));
+        const SizeTypeAlias minimum = page / sizeof(T) > 0 ? page / sizeof(T) : 1;
+        return 2 * _capacity > minimum ? 2 * _capacity : minimum;
+    }
+
+    bool AdviseInternal(MappedAdvice advice) noexcept
+    {
+        int value = MADV_NORMAL;
+        switch (advice)
+        {
+        case MappedAdvice::Sequential:
+            value = MADV_SEQUENTIAL;
+            break;
+        case MappedAdvice::Random:
+            value = MADV_RANDOM;
+            break;
+        case MappedAdvice::WillNeed:
+            value = MADV_WILLNEED;
+            break;
+        case MappedAdvice::DontNeed:
+            value = MADV_DONTNEED;
+            break;
+        case MappedAdvice::HugePage:
+#ifdef MADV_HUGEPAGE
+            value = MADV_HUGEPAGE;
+            break;
+#else
+            return false;
+#endif
+        default:
+            break;
+        }
+        return ::madvise(_data, _capacity * sizeof(T), value) == 0;
+    }
+
+    /**
+     * @brief Resize the file and the mapping to capacity records. The file grows before the mapping and shrinks
+     * after it, so no mapped page ever lies past the end of the file.
+     */
+    void RemapInternal(SizeTypeAlias capacity)
+    {
+        const SizeTypeAlias oldBytes = _capacity * sizeof(T);
+        const SizeTypeAlias bytes = capacity * sizeof(T);
+        if (capacity > _capacity && ::ftruncate(_file, static_cast<off_t>(bytes)) != 0)
+        {
+            throw MappedVectorIOException(__FILE__, __LINE__);
+        }
+
+        void *data = nullptr;
+        if (bytes == 0)
+        {
+            ::munmap(_data, oldBytes);
+        }
+        else if (_data == nullptr)
+        {
+            data = ::mmap(nullptr, bytes, this->GetProtectionInternal(), MAP_SHARED, _file, 0);
+        }
+        else
+        {
+#ifdef __linux__
+            data = ::mremap(_data, oldBytes, bytes, MREMAP_MAYMOVE);
+#else
+            data = ::mmap(nullptr, bytes, this->GetProtectionInternal(), MAP_SHARED, _file, 0);
+            if (data != MAP_FAILED)
+            {
+                ::munmap(_data, oldBytes);
+            }
+#endif
+        }
+        if (data == MAP_FAILED)
+        {
+            throw MappedVectorIOException(__FILE__, __LINE__);
+        }
+        _data = static_cast<PointerAlias>(data);
+        _capacity = capacity;
+
+        if (bytes < oldBytes && ::ftruncate(_file, static_cast<off_t>(bytes)) != 0)
+        {
+            throw MappedVectorIOException(__FILE__, __LINE__);
+        }
+        if (_data && (_advice == MappedAdvice::Sequential || _advice == MappedAdvice::Random ||
+                      _advice == MappedAdvice::HugePage))
+        {
+            this->AdviseInternal(_advice);
+        }
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_MAPPED_VECTOR_HPP
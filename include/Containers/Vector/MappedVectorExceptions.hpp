@@ -0,0 +1,31 @@
+#ifndef DSA_LIBRARIES_MAPPED_VECTOR_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_MAPPED_VECTOR_EXCEPTIONS_HPP
+#include "VectorExceptions.hpp"
+namespace DSALibraries::Containers
+{
+class MappedVectorIOException : public VectorException
+{
+  public:
+    MappedVectorIOException(string_type fileText, numeric_type line)
+        : VectorException("Failed to open, resize or map the backing file", std::move(fileText), line)
+    {
+    }
+};
+class MappedVectorInvalidFileException : public VectorException
+{
+  public:
+    MappedVectorInvalidFileException(string_type fileText, numeric_type line)
+        : VectorException("Backing file size is not a whole number of records", std::move(fileText), line)
+    {
+    }
+};
+class MappedVectorReadOnlyException : public VectorException
+{
+  public:
+    MappedVectorReadOnlyException(string_type fileText, numeric_type line)
+        : VectorException("Mapped vector is read-only", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
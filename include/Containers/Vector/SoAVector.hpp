@@ -0,0 +1,651 @@
+#ifndef DSA_LIBRARIES_SOA_VECTOR_HPP
+#define DSA_LIBRARIES_SOA_VECTOR_HPP
+#include "../../Utilities/Memory.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "Span.hpp"
+#include "VectorExceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief Proxy for one row of an SoAVector: a reference into each column. Assigning to it writes through, and it
+ * converts to the row's value, a std::tuple of the fields, so sorts can hold rows in temporaries.
+ */
+template <typename... TFields> class SoAReference
+{
+  public:
+    using ValueTypeAlias = std::tuple<std::remove_const_t<TFields>...>;
+
+  private:
+    std::tuple<TFields &...> _fields;
+
+    template <typename TRow, std::size_t... I> void AssignInternal(TRow &&row, std::index_sequence<I...>) const
+    {
+        ((std::get<I>(_fields) = std::get<I>(std::forward<TRow>(row))), ...);
+    }
+
+    template <std::size_t... I> void MoveAssignInternal(const SoAReference &other, std::index_sequence<I...>) const
+    {
+        ((std::get<I>(_fields) = std::move(std::get<I>(other._fields))), ...);
+    }
+
+    template <std::size_t... I> void SwapInternal(const SoAReference &other, std::index_sequence<I...>) const
+    {
+        using std::swap;
+        (swap(std::get<I>(_fields), std::get<I>(other._fields)), ...);
+    }
+
+  public:
+    explicit SoAReference(TFields &...fields) noexcept : _fields(fields...)
+    {
+    }
+
+    SoAReference(const SoAReference &) noexcept = default;
+
+    const SoAReference &operator=(const SoAReference &other) const
+    {
+        this->AssignInternal(other._fields, std::index_sequence_for<TFields...>());
+        return *this;
+    }
+
+    const SoAReference &operator=(SoAReference &&other) const
+    {
+        this->MoveAssignInternal(other, std::index_sequence_for<TFields...>());
+        return *this;
+    }
+
+    const SoAReference &operator=(const ValueTypeAlias &value) const
+    {
+        this->AssignInternal(value, std::index_sequence_for<TFields...>());
+        return *this;
+    }
+
+    const SoAReference &operator=(ValueTypeAlias &&value) const
+    {
+        this->AssignInternal(std::move(value), std::index_sequence_for<TFields...>());
+        return *this;
+    }
+
+    operator ValueTypeAlias() const &
+    {
+        return ValueTypeAlias(_fields);
+    }
+
+    /** Converting an rvalue proxy, as std::move(*it) gives, moves the fields out of the columns. */
+    operator ValueTypeAlias() &&
+    {
+        return std::apply([](auto &...fields) { return ValueTypeAlias(std::move(fields)...); }, _fields);
+    }
+
+    template <std::size_t I> std::tuple_element_t<I, std::tuple<TFields...>> &Get() const noexcept
+    {
+        return std::get<I>(_fields);
+    }
+
+    friend void swap(SoAReference lhs, SoAReference rhs)
+    {
+        lhs.SwapInternal(rhs, std::index_sequence_for<TFields...>());
+    }
+};
+
+/** Field I of a row, whether a proxy into an SoAVector or a row value held by a sort. */
+template <std::size_t I, typename... TFields> decltype(auto) GetField(const SoAReference<TFields...> &row) noexcept
+{
+    return row.template Get<I>();
+}
+
+template <std::size_t I, typename... TFields> const auto &GetField(const std::tuple<TFields...> &row) noexcept
+{
+    return std::get<I>(row);
+}
+
+/**
+ * @brief Orders rows by field Key alone.
+ */
+template <std::size_t Key, typename TCompare = std::less<>> struct SoAColumnCompare
+{
+    TCompare Compare;
+
+    template <typename TLeft, typename TRight> bool operator()(const TLeft &lhs, const TRight &rhs) const
+    {
+        return Compare(GetField<Key>(lhs), GetField<Key>(rhs));
+    }
+};
+
+/**
+ * @brief Random access iterator over the rows of an SoAVector; dereferencing yields an SoAReference.
+ */
+template <typename... TFields> class SoAIterator
+{
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<std::remove_const_t<TFields>...>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = SoAReference<TFields...>;
+
+  private:
+    std::tuple<TFields *...> _columns;
+    difference_type _index = 0;
+
+  public:
+    SoAIterator() noexcept = default;
+
+    SoAIterator(std::tuple<TFields *...> columns, difference_type index) noexcept : _columns(columns), _index(index)
+    {
+    }
+
+    template <typename... UFields, typename = std::enable_if_t<(std::is_convertible_v<UFields *, TFields *> && ...)>>
+    SoAIterator(const SoAIterator<UFields...> &other) noexcept
+        : _columns(other.GetColumns()), _index(other.GetIndex())
+    {
+    }
+
+    [[nodiscard]] const std::tuple<TFields *...> &GetColumns() const noexcept
+    {
+        return _columns;
+    }
+
+    [[nodiscard]] difference_type GetIndex() const noexcept
+    {
+        return _index;
+    }
+
+    reference operator*() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    reference operator[](difference_type offset) const noexcept
+    {
+        return std::apply([this, offset](auto *...columns) { return reference(columns[_index + offset]...); },
+                          _columns);
+    }
+
+    SoAIterator &operator++() noexcept
+    {
+        ++_index;
+        return *this;
+    }
+
+    SoAIterator operator++(int) noexcept
+    {
+        SoAIterator temp = *this;
+        ++_index;
+        return temp;
+    }
+
+    SoAIterator &operator--() noexcept
+    {
+        --_index;
+        return *this;
+    }
+
+    SoAIterator operator--(int) noexcept
+    {
+        SoAIterator temp = *this;
+        --_index;
+        return temp;
+    }
+
+    SoAIterator &operator+=(difference_type offset) noexcept
+    {
+        _index += offset;
+        return *this;
+    }
+
+    SoAIterator &operator-=(difference_type offset) noexcept
+    {
+        _index -= offset;
+        return *this;
+    }
+
+    friend SoAIterator operator+(SoAIterator it, difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    friend SoAIterator operator+(difference_type offset, SoAIterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    friend SoAIterator operator-(SoAIterator it, difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    friend difference_type operator-(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index - rhs._index;
+    }
+
+    friend bool operator==(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index == rhs._index;
+    }
+
+    friend bool operator!=(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index != rhs._index;
+    }
+
+    friend bool operator<(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index < rhs._index;
+    }
+
+    friend bool operator>(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index > rhs._index;
+    }
+
+    friend bool operator<=(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index <= rhs._index;
+    }
+
+    friend bool operator>=(const SoAIterator &lhs, const SoAIterator &rhs) noexcept
+    {
+        return lhs._index >= rhs._index;
+    }
+};
+
+/**
+ * @brief Vector of records stored as one contiguous array per field, so a scan over one field reads only that field.
+ *
+ * All columns share one size, one capacity and one allocation, each column starting on a 64-byte boundary so
+ * GetColumn can hand SIMD kernels aligned Spans. Rows are reached through SoAReference proxies. The Vector sorts
+ * take comparators over rows; SortByColumn orders every column by one key column. A row is built field by field;
+ * if a field's constructor throws, the fields already built are destroyed and the vector keeps its old size.
+ */
+template <typename... Fields> class SoAVector : public SpanSortBase<SoAVector<Fields...>>
+{
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+    static_assert((std::is_nothrow_move_constructible_v<Fields> && ...),
+                  "Columns are moved on growth and cannot be rolled back");
+
+  public:
+    using ValueTypeAlias = std::tuple<Fields...>;
+    using SizeTypeAlias = std::size_t;
+    using ReferenceAlias = SoAReference<Fields...>;
+    using ConstReferenceAlias = SoAReference<const Fields...>;
+    using IteratorAlias = SoAIterator<Fields...>;
+    using ConstIteratorAlias = SoAIterator<const Fields...>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using size_type = SizeTypeAlias;
+    using reference = ReferenceAlias;
+    using const_reference = ConstReferenceAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+
+    static constexpr SizeTypeAlias ColumnCount = sizeof...(Fields);
+    static constexpr SizeTypeAlias ColumnAlignment = (std::max)({SizeTypeAlias(64), alignof(Fields)...});
+
+    template <std::size_t I> using FieldTypeAlias = std::tuple_element_t<I, ValueTypeAlias>;
+
+  private:
+    using ColumnsAlias = std::tuple<Fields *...>;
+    using IndicesAlias = std::index_sequence_for<Fields...>;
+
+    unsigned char *_block = nullptr;
+    ColumnsAlias _columns{};
+    SizeTypeAlias _size = 0;
+    SizeTypeAlias _capacity = 0;
+
+  public:
+    SoAVector() noexcept = default;
+
+    explicit SoAVector(SizeTypeAlias size)
+    {
+        try
+        {
+            this->Resize(size);
+        }
+        catch (...)
+        {
+            this->FreeInternal(_block);
+            throw;
+        }
+    }
+
+    SoAVector(const SoAVector &other)
+    {
+        try
+        {
+            this->Reverse(other._size);
+            this->CopyFromInternal(other, IndicesAlias());
+        }
+        catch (...)
+        {
+            this->FreeInternal(_block);
+            throw;
+        }
+    }
+
+    SoAVector(SoAVector &&other) noexcept
+    {
+        this->Swap(other);
+    }
+
+    SoAVector &operator=(SoAVector other) noexcept
+    {
+        this->Swap(other);
+        return *this;
+    }
+
+    ~SoAVector()
+    {
+        this->Clear();
+        this->FreeInternal(_block);
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() noexcept
+    {
+        return this->GetBegin();
+    }
+
+    ConstIteratorAlias begin() const noexcept
+    {
+        return this->GetConstBegin();
+    }
+
+    IteratorAlias end() noexcept
+    {
+        return this->GetEnd();
+    }
+
+    ConstIteratorAlias end() const noexcept
+    {
+        return this->GetConstEnd();
+    }
+    // End Zone Adaptive Iterator
+
+    IteratorAlias GetBegin() noexcept
+    {
+        return IteratorAlias(_columns, 0);
+    }
+
+    IteratorAlias GetEnd() noexcept
+    {
+        return IteratorAlias(_columns, static_cast<std::ptrdiff_t>(_size));
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return ConstIteratorAlias(IteratorAlias(_columns, 0));
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return ConstIteratorAlias(IteratorAlias(_columns, static_cast<std::ptrdiff_t>(_size)));
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetCapacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    ReferenceAlias operator[](SizeTypeAlias index) noexcept
+    {
+        return this->GetBegin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    ConstReferenceAlias operator[](SizeTypeAlias index) const noexcept
+    {
+        return this->GetConstBegin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    ReferenceAlias At(SizeTypeAlias index)
+    {
+        if (index >= _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return (*this)[index];
+    }
+
+    /** Field I of every row, contiguous and aligned to ColumnAlignment. */
+    template <std::size_t I> Span<FieldTypeAlias<I>> GetColumn() noexcept
+    {
+        return Span<FieldTypeAlias<I>>(std::get<I>(_columns), _size);
+    }
+
+    template <std::size_t I> Span<const FieldTypeAlias<I>> GetColumn() const noexcept
+    {
+        return Span<const FieldTypeAlias<I>>(std::get<I>(_columns), _size);
+    }
+
+    void PushBack(const Fields &...fields)
+    {
+        if (_size == _capacity)
+        {
+            // The arguments may be fields of this vector; copy them before growth frees the columns.
+            ValueTypeAlias row(fields...);
+            this->Reverse(this->GetGrowthInternal());
+            this->ConstructRowInternal(_size, std::move(row), IndicesAlias());
+        }
+        else
+        {
+            this->ConstructRowInternal(_size, std::forward_as_tuple(fields...), IndicesAlias());
+        }
+        ++_size;
+    }
+
+    void PushBack(const ValueTypeAlias &row)
+    {
+        std::apply([this](const auto &...fields) { this->PushBack(fields...); }, row);
+    }
+
+    void PopBack()
+    {
+        if (_size == 0)
+        {
+            throw VectorEmptyException(__FILE__, __LINE__);
+        }
+        --_size;
+        this->DestroyInternal(_size, _size + 1, IndicesAlias());
+    }
+
+    void Reverse(SizeTypeAlias capacity)
+    {
+        if (capacity > _capacity)
+        {
+            this->ReallocateInternal(capacity, IndicesAlias());
+        }
+    }
+
+    void Resize(SizeTypeAlias size)
+    {
+        if (size > _capacity)
+        {
+            this->ReallocateInternal(size, IndicesAlias());
+        }
+        if (size > _size)
+        {
+            this->DefaultConstructInternal(_size, size, IndicesAlias());
+        }
+        else
+        {
+            this->DestroyInternal(size, _size, IndicesAlias());
+        }
+        _size = size;
+    }
+
+    void ShrinkToFit()
+    {
+        if (_size == 0)
+        {
+            this->FreeInternal(_block);
+            _block = nullptr;
+            _columns = ColumnsAlias();
+            _capacity = 0;
+        }
+        else if (_size < _capacity)
+        {
+            this->ReallocateInternal(_size, IndicesAlias());
+        }
+    }
+
+    void Clear() noexcept
+    {
+        this->DestroyInternal(0, _size, IndicesAlias());
+        _size = 0;
+    }
+
+    void Swap(SoAVector &other) noexcept
+    {
+        std::swap(_block, other._block);
+        std::swap(_columns, other._columns);
+        std::swap(_size, other._size);
+        std::swap(_capacity, other._capacity);
+    }
+
+    /**
+     * @brief Reorder every column by field Key with AdaptiveSort; rows move together.
+     */
+    template <std::size_t Key, typename TCompare = std::less<>>
+    Utilities::SortStrategy SortByColumn(TCompare compare = TCompare())
+    {
+        return this->AdaptiveSort(SoAColumnCompare<Key, TCompare>{compare});
+    }
+
+  private:
+    static constexpr SizeTypeAlias AlignUpInternal(SizeTypeAlias bytes) noexcept
+    {
+        return (bytes + ColumnAlignment - 1) & ~(ColumnAlignment - 1);
+    }
+
+    /** Byte offset of each column in a block of capacity rows; the last entry is the block size. */
+    static std::array<SizeTypeAlias, ColumnCount + 1> GetOffsetsInternal(SizeTypeAlias capacity) noexcept
+    {
+        constexpr SizeTypeAlias sizes[] = {sizeof(Fields)...};
+        std::array<SizeTypeAlias, ColumnCount + 1> offsets{};
+        for (SizeTypeAlias i = 0; i < ColumnCount; ++i)
+        {
+            offsets[i + 1] = AlignUpInternal(offsets[i] + capacity * sizes[i]);
+        }
+        return offsets;
+    }
+
+    static void FreeInternal(unsigned char *block) noexcept
+    {
+        if (block)
+        {
+            ::operator delete(block, std::align_val_t(ColumnAlignment));
+        }
+    }
+
+    SizeTypeAlias GetGrowthInternal() const noexcept
+    {
+        return _capacity < 8 ? 8 : 2 * _capacity;
+    }
+
+    template <std::size_t... I> void ReallocateInternal(SizeTypeAlias capacity, std::index_sequence<I...>)
+    {
+        const auto offsets = GetOffsetsInternal(capacity);
+        auto *block = static_cast<unsigned char *>(::operator new(offsets[ColumnCount], std::align_val_t(ColumnAlignment)));
+        ColumnsAlias columns(reinterpret_cast<Fields *>(block + offsets[I])...);
+        (Utilities::UninitializedMove(std::get<I>(_columns), std::get<I>(_columns) + _size, std::get<I>(columns)), ...);
+        (Utilities::Destroy(std::get<I>(_columns), std::get<I>(_columns) + _size), ...);
+        this->FreeInternal(_block);
+        _block = block;
+        _columns = columns;
+        _capacity = capacity;
+    }
+
+    template <typename TRow, std::size_t... I>
+    void ConstructRowInternal(SizeTypeAlias index, TRow &&row, std::index_sequence<I...>)
+    {
+        SizeTypeAlias built = 0;
+        try
+        {
+            ((::new (static_cast<void *>(std::get<I>(_columns) + index)) Fields(std::get<I>(std::forward<TRow>(row))),
+              ++built),
+             ...);
+        }
+        catch (...)
+        {
+            this->DestroyColumnsInternal(built, index, index + 1, IndicesAlias());
+            throw;
+        }
+    }
+
+    template <std::size_t... I>
+    void DefaultConstructInternal(SizeTypeAlias first, SizeTypeAlias last, std::index_sequence<I...>)
+    {
+        SizeTypeAlias index = first;
+        SizeTypeAlias built = 0;
+        try
+        {
+            for (; index < last; ++index)
+            {
+                built = 0;
+                ((::new (static_cast<void *>(std::get<I>(_columns) + index)) Fields(), ++built), ...);
+            }
+        }
+        catch (...)
+        {
+            this->DestroyColumnsInternal(built, index, index + 1, IndicesAlias());
+            this->DestroyInternal(first, index, IndicesAlias());
+            throw;
+        }
+    }
+
+    template <std::size_t... I>
+    void DestroyInternal(SizeTypeAlias first, SizeTypeAlias last, std::index_sequence<I...>) noexcept
+    {
+        (Utilities::Destroy(std::get<I>(_columns) + first, std::get<I>(_columns) + last), ...);
+    }
+
+    /** Destroy rows [first, last) of the first columns columns only, undoing a row or copy that threw part way. */
+    template <std::size_t... I>
+    void DestroyColumnsInternal(SizeTypeAlias columns, SizeTypeAlias first, SizeTypeAlias last,
+                                std::index_sequence<I...>) noexcept
+    {
+        ((I < columns ? Utilities::Destroy(std::get<I>(_columns) + first, std::get<I>(_columns) + last) : void()), ...);
+    }
+
+    template <std::size_t... I> void CopyFromInternal(const SoAVector &other, std::index_sequence<I...>)
+    {
+        SizeTypeAlias built = 0;
+        try
+        {
+            // std::uninitialized_copy cleans up the column it was copying.
+            ((std::uninitialized_copy(std::get<I>(other._columns), std::get<I>(other._columns) + other._size,
+                                      std::get<I>(_columns)),
+              ++built),
+             ...);
+        }
+        catch (...)
+        {
+            this->DestroyColumnsInternal(built, 0, other._size, IndicesAlias());
+            throw;
+        }
+        _size = other._size;
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_SOA_VECTOR_HPP
@@ -0,0 +1,651 @@
+#ifndef DSA_LIBRARIES_SPAN_HPP
+#define DSA_LIBRARIES_SPAN_HPP
+#include "../../Utilities/Instrumentation.hpp"
+#include "../../Utilities/Sort.hpp"
+#include "SpanExceptions.hpp"
+#include "VectorExceptions.hpp"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Containers
+{
+/**
+ * @brief The sorts of Vector, over a view's iterators; TDerived provides GetBegin, GetEnd and GetSize. DSASort takes
+ * the same choices as Vector::DSASort, and comparisons are counted under Instrumentation<TDerived>.
+ */
+template <typename TDerived> class SpanSortBase
+{
+  private:
+    TDerived &GetDerivedInternal() noexcept
+    {
+        return static_cast<TDerived &>(*this);
+    }
+
+  public:
+    template <typename TCompare> Utilities::SortStrategy AdaptiveSort(TCompare userComp)
+    {
+        auto comp = Utilities::InstrumentCompare<TDerived>(userComp);
+        return Utilities::AdaptiveSortRange(GetDerivedInternal().GetBegin(), GetDerivedInternal().GetEnd(), userComp,
+                                            comp);
+    }
+
+    template <typename TCompare> void PartialSort(std::size_t count, TCompare userComp)
+    {
+        if (count > GetDerivedInternal().GetSize())
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        auto comp = Utilities::InstrumentCompare<TDerived>(userComp);
+        auto first = GetDerivedInternal().GetBegin();
+        Utilities::PartialSortRange(first, first + count, GetDerivedInternal().GetEnd(), comp);
+    }
+
+    template <typename TCompare> void NthElement(std::size_t index, TCompare userComp)
+    {
+        if (index >= GetDerivedInternal().GetSize())
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        auto comp = Utilities::InstrumentCompare<TDerived>(userComp);
+        auto first = GetDerivedInternal().GetBegin();
+        Utilities::NthElementRange(first, first + index, GetDerivedInternal().GetEnd(), comp);
+    }
+
+    template <typename TCompare> void DSASort(unsigned choice, TCompare userCompare)
+    {
+        auto compare = Utilities::InstrumentCompare<TDerived>(userCompare);
+        auto first = GetDerivedInternal().GetBegin();
+        auto last = GetDerivedInternal().GetEnd();
+        switch (choice)
+        {
+        case 1:
+            Utilities::InsertionSortRange(first, last, compare);
+            break;
+        case 2:
+            Utilities::SelectionSortRange(first, last, compare);
+            break;
+        case 3:
+            Utilities::BubbleSortRange(first, last, compare);
+            break;
+        case 4:
+            Utilities::QuickSortRange(first, last, compare);
+            break;
+        case 5:
+            Utilities::HeapSortRange(first, last, compare);
+            break;
+        case 6:
+            this->AdaptiveSort(userCompare);
+            break;
+        default:
+            Utilities::RunMergeSortRange(first, last, compare);
+            break;
+        }
+    }
+};
+
+/**
+ * @brief Random access iterator that visits every stride-th element. It keeps a base and an index rather than a
+ * pointer, so the end of a strided view never points past its storage.
+ */
+template <typename T> class StridedSpanIterator
+{
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+  private:
+    T *_base = nullptr;
+    difference_type _index = 0;
+    difference_type _stride = 1;
+
+  public:
+    StridedSpanIterator() noexcept = default;
+
+    StridedSpanIterator(T *base, difference_type index, difference_type stride) noexcept
+        : _base(base), _index(index), _stride(stride)
+    {
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    StridedSpanIterator(const StridedSpanIterator<U> &other) noexcept
+        : _base(other.GetBase()), _index(other.GetIndex()), _stride(other.GetStride())
+    {
+    }
+
+    [[nodiscard]] T *GetBase() const noexcept
+    {
+        return _base;
+    }
+
+    [[nodiscard]] difference_type GetIndex() const noexcept
+    {
+        return _index;
+    }
+
+    [[nodiscard]] difference_type GetStride() const noexcept
+    {
+        return _stride;
+    }
+
+    reference operator*() const noexcept
+    {
+        return _base[_index * _stride];
+    }
+
+    pointer operator->() const noexcept
+    {
+        return _base + _index * _stride;
+    }
+
+    reference operator[](difference_type offset) const noexcept
+    {
+        return _base[(_index + offset) * _stride];
+    }
+
+    StridedSpanIterator &operator++() noexcept
+    {
+        ++_index;
+        return *this;
+    }
+
+    StridedSpanIterator operator++(int) noexcept
+    {
+        StridedSpanIterator temp = *this;
+        ++_index;
+        return temp;
+    }
+
+    StridedSpanIterator &operator--() noexcept
+    {
+        --_index;
+        return *this;
+    }
+
+    StridedSpanIterator operator--(int) noexcept
+    {
+        StridedSpanIterator temp = *this;
+        --_index;
+        return temp;
+    }
+
+    StridedSpanIterator &operator+=(difference_type offset) noexcept
+    {
+        _index += offset;
+        return *this;
+    }
+
+    StridedSpanIterator &operator-=(difference_type offset) noexcept
+    {
+        _index -= offset;
+        return *this;
+    }
+
+    friend StridedSpanIterator operator+(StridedSpanIterator it, difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    friend StridedSpanIterator operator+(difference_type offset, StridedSpanIterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    friend StridedSpanIterator operator-(StridedSpanIterator it, difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    friend difference_type operator-(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index - rhs._index;
+    }
+
+    friend bool operator==(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index == rhs._index;
+    }
+
+    friend bool operator!=(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index != rhs._index;
+    }
+
+    friend bool operator<(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index < rhs._index;
+    }
+
+    friend bool operator>(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index > rhs._index;
+    }
+
+    friend bool operator<=(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index <= rhs._index;
+    }
+
+    friend bool operator>=(const StridedSpanIterator &lhs, const StridedSpanIterator &rhs) noexcept
+    {
+        return lhs._index >= rhs._index;
+    }
+};
+
+template <typename T> class StridedSpan;
+template <typename T> class SpanChunks;
+
+/**
+ * @brief Non-owning view of contiguous elements: a Vector, a MappedVector, a slice of either, or any pointer and
+ * size. Slicing, striding and chunking return new views without copying; the storage must outlive them, and a
+ * Vector that reallocates invalidates its views.
+ */
+template <typename T> class Span : public SpanSortBase<Span<T>>
+{
+  public:
+    using ValueTypeAlias = std::remove_cv_t<T>;
+    using ElementTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using ReferenceAlias = T &;
+    using PointerAlias = T *;
+    using IteratorAlias = T *;
+    using ConstIteratorAlias = const T *;
+    using ReverseIteratorAlias = std::reverse_iterator<IteratorAlias>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using element_type = ElementTypeAlias;
+    using size_type = SizeTypeAlias;
+    using reference = ReferenceAlias;
+    using pointer = PointerAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+
+  private:
+    PointerAlias _data = nullptr;
+    SizeTypeAlias _size = 0;
+
+  public:
+    Span() noexcept = default;
+
+    Span(PointerAlias data, SizeTypeAlias size) noexcept : _data(data), _size(size)
+    {
+    }
+
+    Span(PointerAlias first, PointerAlias last) noexcept : _data(first), _size(static_cast<SizeTypeAlias>(last - first))
+    {
+    }
+
+    /**
+     * @brief View every element of a container with GetData and GetSize.
+     */
+    template <typename TContainer,
+              typename = std::enable_if_t<!std::is_base_of_v<SpanSortBase<Span>, std::remove_cv_t<TContainer>> &&
+                                          std::is_convertible_v<decltype(std::declval<TContainer &>().GetData()),
+                                                                PointerAlias>>>
+    Span(TContainer &container) noexcept : _data(container.GetData()), _size(container.GetSize())
+    {
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    Span(const Span<U> &other) noexcept : _data(other.GetData()), _size(other.GetSize())
+    {
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() const noexcept
+    {
+        return this->GetBegin();
+    }
+
+    IteratorAlias end() const noexcept
+    {
+        return this->GetEnd();
+    }
+    // End Zone Adaptive Iterator
+
+    [[nodiscard]] PointerAlias GetData() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetSizeBytes() const noexcept
+    {
+        return _size * sizeof(T);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    IteratorAlias GetBegin() const noexcept
+    {
+        return _data;
+    }
+
+    IteratorAlias GetEnd() const noexcept
+    {
+        return _data + _size;
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return _data;
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return _data + _size;
+    }
+
+    ReverseIteratorAlias GetReverseBegin() const noexcept
+    {
+        return ReverseIteratorAlias(this->GetEnd());
+    }
+
+    ReverseIteratorAlias GetReverseEnd() const noexcept
+    {
+        return ReverseIteratorAlias(this->GetBegin());
+    }
+
+    ReferenceAlias operator[](SizeTypeAlias index) const noexcept
+    {
+        return _data[index];
+    }
+
+    ReferenceAlias At(SizeTypeAlias index) const
+    {
+        if (index >= _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return _data[index];
+    }
+
+    ReferenceAlias GetItemFront() const noexcept
+    {
+        return _data[0];
+    }
+
+    ReferenceAlias GetItemBack() const noexcept
+    {
+        return _data[_size - 1];
+    }
+
+    /** The count elements starting at offset. */
+    [[nodiscard]] Span Slice(SizeTypeAlias offset, SizeTypeAlias count) const
+    {
+        if (offset > _size || count > _size - offset)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return Span(_data + offset, count);
+    }
+
+    /** Everything from offset on. */
+    [[nodiscard]] Span Slice(SizeTypeAlias offset) const
+    {
+        if (offset > _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return Span(_data + offset, _size - offset);
+    }
+
+    [[nodiscard]] Span GetFirst(SizeTypeAlias count) const
+    {
+        return this->Slice(0, count);
+    }
+
+    [[nodiscard]] Span GetLast(SizeTypeAlias count) const
+    {
+        if (count > _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return Span(_data + (_size - count), count);
+    }
+
+    /** Elements offset, offset + stride, offset + 2 * stride and so on. */
+    [[nodiscard]] StridedSpan<T> Strided(SizeTypeAlias stride, SizeTypeAlias offset = 0) const
+    {
+        if (stride == 0)
+        {
+            throw SpanInvalidStepException(__FILE__, __LINE__);
+        }
+        if (offset > _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return StridedSpan<T>(_data + offset, (_size - offset + stride - 1) / stride, stride);
+    }
+
+    /** Consecutive views of size elements each; the last one holds the remainder. */
+    [[nodiscard]] SpanChunks<T> Chunks(SizeTypeAlias size) const
+    {
+        if (size == 0)
+        {
+            throw SpanInvalidStepException(__FILE__, __LINE__);
+        }
+        return SpanChunks<T>(*this, size);
+    }
+};
+
+template <typename TContainer>
+Span(TContainer &) -> Span<std::remove_pointer_t<decltype(std::declval<TContainer &>().GetData())>>;
+
+/**
+ * @brief Non-owning view of every stride-th element of contiguous storage, such as one field of interleaved
+ * records or one column of a row-major matrix.
+ */
+template <typename T> class StridedSpan : public SpanSortBase<StridedSpan<T>>
+{
+  public:
+    using ValueTypeAlias = std::remove_cv_t<T>;
+    using ElementTypeAlias = T;
+    using SizeTypeAlias = std::size_t;
+    using ReferenceAlias = T &;
+    using IteratorAlias = StridedSpanIterator<T>;
+    using ConstIteratorAlias = StridedSpanIterator<const T>;
+
+    // Adaptive alias
+    using value_type = ValueTypeAlias;
+    using element_type = ElementTypeAlias;
+    using size_type = SizeTypeAlias;
+    using reference = ReferenceAlias;
+    using iterator = IteratorAlias;
+    using const_iterator = ConstIteratorAlias;
+
+  private:
+    T *_base = nullptr;
+    SizeTypeAlias _size = 0;
+    SizeTypeAlias _stride = 1;
+
+  public:
+    StridedSpan() noexcept = default;
+
+    StridedSpan(T *base, SizeTypeAlias size, SizeTypeAlias stride) noexcept : _base(base), _size(size), _stride(stride)
+    {
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() const noexcept
+    {
+        return this->GetBegin();
+    }
+
+    IteratorAlias end() const noexcept
+    {
+        return this->GetEnd();
+    }
+    // End Zone Adaptive Iterator
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] SizeTypeAlias GetStride() const noexcept
+    {
+        return _stride;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    IteratorAlias GetBegin() const noexcept
+    {
+        return IteratorAlias(_base, 0, static_cast<std::ptrdiff_t>(_stride));
+    }
+
+    IteratorAlias GetEnd() const noexcept
+    {
+        return IteratorAlias(_base, static_cast<std::ptrdiff_t>(_size), static_cast<std::ptrdiff_t>(_stride));
+    }
+
+    ConstIteratorAlias GetConstBegin() const noexcept
+    {
+        return this->GetBegin();
+    }
+
+    ConstIteratorAlias GetConstEnd() const noexcept
+    {
+        return this->GetEnd();
+    }
+
+    ReferenceAlias operator[](SizeTypeAlias index) const noexcept
+    {
+        return _base[index * _stride];
+    }
+
+    ReferenceAlias At(SizeTypeAlias index) const
+    {
+        if (index >= _size)
+        {
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
+        }
+        return _base[index * _stride];
+    }
+};
+
+/**
+ * @brief The chunks of a Span, as an indexable and iterable sequence of Spans.
+ */
+template <typename T> class SpanChunks
+{
+  public:
+    using SizeTypeAlias = std::size_t;
+
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Span<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Span<T>;
+
+      private:
+        const SpanChunks *_chunks = nullptr;
+        SizeTypeAlias _index = 0;
+
+      public:
+        Iterator() noexcept = default;
+
+        Iterator(const SpanChunks *chunks, SizeTypeAlias index) noexcept : _chunks(chunks), _index(index)
+        {
+        }
+
+        Span<T> operator*() const noexcept
+        {
+            return (*_chunks)[_index];
+        }
+
+        Iterator &operator++() noexcept
+        {
+            ++_index;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator temp = *this;
+            ++_index;
+            return temp;
+        }
+
+        friend bool operator==(const Iterator &lhs, const Iterator &rhs) noexcept
+        {
+            return lhs._index == rhs._index;
+        }
+
+        friend bool operator!=(const Iterator &lhs, const Iterator &rhs) noexcept
+        {
+            return lhs._index != rhs._index;
+        }
+    };
+
+    using IteratorAlias = Iterator;
+
+  private:
+    Span<T> _source;
+    SizeTypeAlias _chunkSize;
+
+  public:
+    SpanChunks(Span<T> source, SizeTypeAlias chunkSize) noexcept : _source(source), _chunkSize(chunkSize)
+    {
+    }
+
+    // Start Zone Adaptive Iterator
+    IteratorAlias begin() const noexcept
+    {
+        return this->GetBegin();
+    }
+
+    IteratorAlias end() const noexcept
+    {
+        return this->GetEnd();
+    }
+    // End Zone Adaptive Iterator
+
+    [[nodiscard]] SizeTypeAlias GetSize() const noexcept
+    {
+        return (_source.GetSize() + _chunkSize - 1) / _chunkSize;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return _source.IsEmpty();
+    }
+
+    IteratorAlias GetBegin() const noexcept
+    {
+        return IteratorAlias(this, 0);
+    }
+
+    IteratorAlias GetEnd() const noexcept
+    {
+        return IteratorAlias(this, this->GetSize());
+    }
+
+    Span<T> operator[](SizeTypeAlias index) const noexcept
+    {
+        const SizeTypeAlias offset = index * _chunkSize;
+        const SizeTypeAlias remaining = _source.GetSize() - offset;
+        return Span<T>(_source.GetData() + offset, remaining < _chunkSize ? remaining : _chunkSize);
+    }
+};
+} // namespace DSALibraries::Containers
+#endif // DSA_LIBRARIES_SPAN_HPP
@@ -0,0 +1,15 @@
+#ifndef DSA_LIBRARIES_SPAN_EXCEPTIONS_HPP
+#define DSA_LIBRARIES_SPAN_EXCEPTIONS_HPP
+#include "VectorExceptions.hpp"
+namespace DSALibraries::Containers
+{
+class SpanInvalidStepException : public VectorException
+{
+  public:
+    SpanInvalidStepException(string_type fileText, numeric_type line)
+        : VectorException("Stride and chunk size must be positive", std::move(fileText), line)
+    {
+    }
+};
+} // namespace DSALibraries::Containers
+#endif
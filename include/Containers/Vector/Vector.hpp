@@ -12,6 +12,8 @@
 #ifndef DSA_LIBRARIES_VECTOR_HPP
 #define DSA_LIBRARIES_VECTOR_HPP
 #include "../../Utilities/Allocator.hpp"
+#include "../../Utilities/Instrumentation.hpp"
+#include "../../Utilities/Sort.hpp"
 #include "VectorBase.hpp"
 #include "VectorExceptions.hpp"
 #include "VectorIterator.hpp"
@@ -113,7 +115,7 @@ class Vector : protected VectorBase<T, Alloc>
 
     constexpr Vector(SizeTypeAlias size, ConstReferenceAlias value,
                      const AllocatorTypeAlias &alloc = AllocatorTypeAlias())
-        : Base(size, value, alloc)
+        : Base(size, alloc)
     {
         this->FillInitialize(size, value);
     }
@@ -131,8 +133,6 @@ class Vector : protected VectorBase<T, Alloc>
             Utilities::UninitializedCopy(vector.GetConstBegin(), vector.GetConstEnd(), this->VectorData.PointerStart);
     }
 
-    Vector(Vector &&vector) = default;
-
   private:
     constexpr Vector(Vector &&other, const AllocatorTypeAlias &alloc, std::true_type) noexcept
         : Base(std::move(other), alloc)
@@ -413,7 +413,19 @@ class Vector : protected VectorBase<T, Alloc>
             const SizeTypeAlias oldSize = this->GetSize();
             PointerAlias temp;
 
-            temp = this->AllocateAndCopy(size, this->VectorData.PointerStart, this->VectorData.PointerFinish);
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            {
+                temp = this->AllocateAndCopy(size, std::make_move_iterator(this->VectorData.PointerStart),
+                                             std::make_move_iterator(this->VectorData.PointerFinish));
+            }
+            else
+            {
+                temp = this->AllocateAndCopy(size, this->VectorData.PointerStart, this->VectorData.PointerFinish);
+            }
+            if (this->VectorData.PointerStart)
+            {
+                Utilities::InstrumentationHooks<Vector>::OnReallocation(oldSize);
+            }
             Utilities::Destroy(this->VectorData.PointerStart, this->VectorData.PointerFinish);
 
             this->DeallocateInternal(this->VectorData.PointerStart,
@@ -544,9 +556,10 @@ class Vector : protected VectorBase<T, Alloc>
     constexpr void Swap(Vector &other) noexcept
     {
         this->VectorData.SwapDataInternal(other.VectorData);
-        if (AllocatorTraitsAlias::propagate_on_container_swap::value)
+        if constexpr (AllocatorTraitsAlias::propagate_on_container_swap::value)
         {
-            std::swap(this->GetAllocator(), other.GetAllocator());
+            using std::swap;
+            swap(this->GetTpAllocator(), other.GetTpAllocator());
         }
     }
     constexpr void Clear() noexcept
@@ -730,7 +743,7 @@ class Vector : protected VectorBase<T, Alloc>
                     newFinish = PointerAlias();
                     newFinish = Utilities::UninitializedMove(this->GetBegin(), position.Base(), newStart);
                     newFinish += size;
-                    newFinish = Utilities::UninitializedMove(position.Base(), this->VectorData.PointerStart, newFinish);
+                    newFinish = Utilities::UninitializedMove(position.Base(), this->VectorData.PointerFinish, newFinish);
                 }
                 catch (...)
                 {
@@ -742,9 +755,13 @@ class Vector : protected VectorBase<T, Alloc>
                     {
                         Utilities::Destroy(newStart, newFinish);
                     }
-                    AllocatorTraitsAlias::deallocate(this->VectorData, newStart, length);
+                    this->DeallocateInternal(newStart, length);
                     throw;
                 }
+                if (this->VectorData.PointerStart)
+                {
+                    Utilities::InstrumentationHooks<Vector>::OnReallocation(this->GetSize());
+                }
                 Utilities::Destroy(this->VectorData.PointerStart, this->VectorData.PointerFinish);
                 this->DeallocateInternal(this->VectorData.PointerStart,
                                          this->VectorData.PointerEndOfStorage - this->VectorData.PointerStart);
@@ -835,7 +852,12 @@ class Vector : protected VectorBase<T, Alloc>
                 catch (...)
                 {
                     Utilities::Destroy(newStart, newFinish);
-                    AllocatorTraitsAlias::deallocate(this->VectorData, newStart, length);
+                    this->DeallocateInternal(newStart, length);
+                    throw;
+                }
+                if (oldStart)
+                {
+                    Utilities::InstrumentationHooks<Vector>::OnReallocation(oldFinish - oldStart);
                 }
                 Utilities::Destroy(oldStart, oldFinish);
                 this->DeallocateInternal(oldStart, this->VectorData.PointerEndOfStorage - oldStart);
@@ -891,9 +913,13 @@ class Vector : protected VectorBase<T, Alloc>
                     {
                         Utilities::Destroy(destroyFrom, destroyFrom + size);
                     }
-                    AllocatorTraitsAlias::deallocate(this->VectorData, newStart, length);
+                    this->DeallocateInternal(newStart, length);
                     throw;
                 }
+                if (this->VectorData.PointerStart)
+                {
+                    Utilities::InstrumentationHooks<Vector>::OnReallocation(oldSize);
+                }
                 Utilities::Destroy(this->VectorData.PointerStart, this->VectorData.PointerFinish);
                 this->DeallocateInternal(this->VectorData.PointerStart,
                                          this->VectorData.PointerEndOfStorage - this->VectorData.PointerStart);
@@ -938,6 +964,7 @@ class Vector : protected VectorBase<T, Alloc>
             {
                 if (Storage)
                 {
+                    Utilities::InstrumentationHooks<Vector>::OnDeallocation(Length * sizeof(T));
                     AllocatorTraitsAlias::deallocate(Allocator, Storage, Length);
                 }
             }
@@ -982,6 +1009,10 @@ class Vector : protected VectorBase<T, Alloc>
             guardElms.First = oldStart;
             guardElms.Last = oldFinish;
 
+            if (oldStart)
+            {
+                Utilities::InstrumentationHooks<Vector>::OnReallocation(oldFinish - oldStart);
+            }
             guard.Storage = oldStart;
             guard.Length = this->VectorData.PointerEndOfStorage - oldStart;
         }
@@ -1014,6 +1045,7 @@ class Vector : protected VectorBase<T, Alloc>
             {
                 if (Storage)
                 {
+                    Utilities::InstrumentationHooks<Vector>::OnDeallocation(Length * sizeof(T));
                     AllocatorTraitsAlias::deallocate(Allocator, Storage, Length);
                 }
             }
@@ -1054,6 +1086,10 @@ class Vector : protected VectorBase<T, Alloc>
                 guardElms.Last = oldFinish;
             }
 
+            if (oldStart)
+            {
+                Utilities::InstrumentationHooks<Vector>::OnReallocation(oldFinish - oldStart);
+            }
             guard.Storage = oldStart;
             guard.Length = this->VectorData.PointerEndOfStorage - oldStart;
         }
@@ -1209,114 +1245,12 @@ class Vector : protected VectorBase<T, Alloc>
         }
     }
 
-  private:
-    // Zone of DSA
-    template <typename TCompare>
-    constexpr void MergeHelper(SizeTypeAlias leftStart, SizeTypeAlias mid, SizeTypeAlias rightEnd, TCompare comp)
-    {
-        SizeTypeAlias leftSize = mid - leftStart + 1;
-        SizeTypeAlias rightSize = rightEnd - mid;
-
-        Vector<ValueTypeAlias> left(leftSize);
-        Vector<ValueTypeAlias> right(rightSize);
-
-        for (SizeTypeAlias i = 0; i < leftSize; ++i)
-        {
-            left[i] = (*this)[leftStart + i];
-        }
-
-        for (SizeTypeAlias i = 0; i < rightSize; ++i)
-        {
-            right[i] = (*this)[mid + 1 + i];
-        }
-
-        SizeTypeAlias leftIndex = 0;
-        SizeTypeAlias rightIndex = 0;
-        SizeTypeAlias mergedIndex = leftStart;
-
-        while (leftIndex < leftSize && rightIndex < rightSize)
-        {
-            if (comp(left[leftIndex], right[rightIndex]))
-            {
-                (*this)[mergedIndex] = left[leftIndex];
-                ++leftIndex;
-            }
-            else
-            {
-                (*this)[mergedIndex] = right[rightIndex];
-                ++rightIndex;
-            }
-            ++mergedIndex;
-        }
-
-        while (leftIndex < leftSize)
-        {
-            (*this)[mergedIndex] = left[leftIndex];
-            ++leftIndex;
-            ++mergedIndex;
-        }
-
-        while (rightIndex < rightSize)
-        {
-            (*this)[mergedIndex] = right[rightIndex];
-            ++rightIndex;
-            ++mergedIndex;
-        }
-    }
-
-    template <typename TCompare> constexpr void QuickSortHelper(IteratorAlias begin, IteratorAlias end, TCompare comp)
-    {
-        if (begin < end)
-        {
-            IteratorAlias pivot = this->PartitionForQuickSortHelper(begin, end, comp);
-            this->QuickSortHelper(begin, pivot - 1, comp);
-            this->QuickSortHelper(pivot + 1, end, comp);
-        }
-    }
-
-    template <typename TCompare>
-    constexpr IteratorAlias PartitionForQuickSortHelper(IteratorAlias begin, IteratorAlias end, TCompare comp)
-    {
-        ValueTypeAlias pivot = *end;
-        IteratorAlias i = begin - 1;
-        for (IteratorAlias j = begin; j < end; ++j)
-        {
-            if (comp(*j, pivot))
-            {
-                ++i;
-                std::swap(*i, *j);
-            }
-        }
-        std::swap(*(i + 1), *end);
-        return i + 1;
-    }
-
-    template <typename TCompare> constexpr void HeapifyHelper(SizeTypeAlias size, SizeTypeAlias index, TCompare comp)
-    {
-        SizeTypeAlias largest = index;
-        SizeTypeAlias left = 2 * index + 1;
-        SizeTypeAlias right = 2 * index + 2;
-
-        if (left < size && !comp((*this)[left], (*this)[largest]))
-        {
-            largest = left;
-        }
-
-        if (right < size && !comp((*this)[right], (*this)[largest]))
-        {
-            largest = right;
-        }
-
-        if (largest != index)
-        {
-            std::swap((*this)[index], (*this)[largest]);
-            this->HeapifyHelper(size, largest, comp);
-        }
-    }
-
   public:
-    template <typename TCompare> constexpr void BubbleSort(TCompare comp)
+    // Zone of DSA
+    template <typename TCompare> constexpr void BubbleSort(TCompare userComp)
     {
+        using std::swap;
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
         if (this->GetSize() < 2)
         {
             return;
@@ -1328,14 +1262,16 @@ class Vector : protected VectorBase<T, Alloc>
             {
                 if (comp(*(j + 1), *j))
                 {
-                    std::swap(*j, *(j + 1));
+                    swap(*j, *(j + 1));
                 }
             }
         }
     }
 
-    template <typename TCompare> constexpr void SelectionSort(TCompare comp)
+    template <typename TCompare> constexpr void SelectionSort(TCompare userComp)
     {
+        using std::swap;
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
         if (this->GetSize() < 2)
         {
             return;
@@ -1351,12 +1287,13 @@ class Vector : protected VectorBase<T, Alloc>
                     min = j;
                 }
             }
-            std::swap(*i, *min);
+            swap(*i, *min);
         }
     }
 
-    template <typename TCompare> constexpr void InsertionSort(TCompare comp)
+    template <typename TCompare> constexpr void InsertionSort(TCompare userComp)
     {
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
         if (this->GetSize() < 2)
         {
             return;
@@ -1375,62 +1312,71 @@ class Vector : protected VectorBase<T, Alloc>
         }
     }
 
-    template <typename TCompare> constexpr void MergeSort(TCompare comp)
+    /** Stable: natural runs merged bottom-up through one buffer. */
+    template <typename TCompare> constexpr void MergeSort(TCompare userComp)
     {
-        if (this->GetSize() < 2)
-        {
-            return;
-        }
-
-        // iterative merge sort
-
-        for (SizeTypeAlias currSize = 1; currSize < this->GetSize(); currSize *= 2)
-        {
-            for (SizeTypeAlias leftStart = 0; leftStart < this->GetSize() - 1; leftStart += 2 * currSize)
-            {
-                SizeTypeAlias mid = (std::min)(leftStart + currSize - 1, this->GetSize() - 1);
-                SizeTypeAlias rightEnd = (std::min)(leftStart + 2 * currSize - 1, this->GetSize() - 1);
-
-                this->MergeHelper(leftStart, mid, rightEnd, comp);
-            }
-        }
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
+        Utilities::RunMergeSortRange(this->GetBegin(), this->GetEnd(), comp);
     }
 
-    template <typename TCompare> constexpr void QuickSort(TCompare comp)
+    template <typename TCompare> constexpr void QuickSort(TCompare userComp)
     {
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
         if (this->GetSize() < 2)
         {
             return;
         }
 
-        this->QuickSortHelper(this->GetBegin(), this->GetEnd() - 1, comp);
+        Utilities::QuickSortRange(this->GetBegin(), this->GetEnd(), comp);
     }
 
-    template <typename TCompare> constexpr void HeapSort(TCompare comp)
+    template <typename TCompare> constexpr void HeapSort(TCompare userComp)
     {
-        if (this->GetSize() < 2)
-        {
-            return;
-        }
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
+        Utilities::HeapSortRange(this->GetBegin(), this->GetEnd(), comp);
+    }
 
-        for (SizeTypeAlias i = this->GetSize() / 2 - 1; true; --i)
+    /**
+     * @brief Sort with the strategy that suits the input: insertion sort when tiny, run merging when presorted, radix
+     * sort for integral keys under std::less or std::greater and introsort otherwise. Not stable.
+     * @return The strategy used.
+     */
+    template <typename TCompare> Utilities::SortStrategy AdaptiveSort(TCompare userComp)
+    {
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
+        return Utilities::AdaptiveSortRange(this->GetBegin(), this->GetEnd(), userComp, comp);
+    }
+
+    /**
+     * @brief Sort the count least elements into the front; the order of the rest is unspecified. O(n + k log k).
+     */
+    template <typename TCompare> void PartialSort(SizeTypeAlias count, TCompare userComp)
+    {
+        if (count > this->GetSize())
         {
-            this->HeapifyHelper(this->GetSize(), i, comp);
-            if (i == 0)
-            {
-                break;
-            }
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
         }
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
+        Utilities::PartialSortRange(this->GetBegin(), this->GetBegin() + count, this->GetEnd(), comp);
+    }
 
-        for (SizeTypeAlias i = this->GetSize() - 1; i > 0; --i)
+    /**
+     * @brief Put at index the element a full sort would put there, with no greater element before it and no lesser
+     * one after. Introselect with a median-of-medians fallback, O(n) in the worst case.
+     */
+    template <typename TCompare> void NthElement(SizeTypeAlias index, TCompare userComp)
+    {
+        if (index >= this->GetSize())
         {
-            std::swap((*this)[0], (*this)[i]);
-            this->HeapifyHelper(i, 0, comp);
+            throw VectorOutOfBoundsException(__FILE__, __LINE__);
         }
+        auto comp = Utilities::InstrumentCompare<Vector>(userComp);
+        Utilities::NthElementRange(this->GetBegin(), this->GetBegin() + index, this->GetEnd(), comp);
     }
 
-    template <typename TCompare> void DSASort(unsigned choice, TCompare compare)
+    template <typename TCompare> void DSASort(unsigned choice, TCompare userCompare)
     {
+        auto compare = Utilities::InstrumentCompare<Vector>(userCompare);
         switch (choice)
         {
         case 1:
@@ -1448,6 +1394,9 @@ class Vector : protected VectorBase<T, Alloc>
         case 5:
             this->HeapSort(compare);
             break;
+        case 6:
+            this->AdaptiveSort(userCompare);
+            break;
         default:
             this->MergeSort(compare);
             break;
@@ -1458,7 +1407,7 @@ class Vector : protected VectorBase<T, Alloc>
 template <typename T, typename Alloc>
 constexpr inline bool operator==(const Vector<T, Alloc> &lhs, const Vector<T, Alloc> &rhs)
 {
-    return (lhs.GetSize() == rhs.GetSize() && std::equal(lhs.GetBegin(), lhs.GetEnd(), rhs.GetBegin()));
+    return (lhs.GetSize() == rhs.GetSize() && std::equal(lhs.GetConstBegin(), lhs.GetConstEnd(), rhs.GetConstBegin()));
 }
 
 template <typename T, typename Alloc>
@@ -1470,7 +1419,8 @@ constexpr inline bool operator!=(const Vector<T, Alloc> &lhs, const Vector<T, Al
 template <typename T, typename Alloc>
 constexpr inline bool operator<(const Vector<T, Alloc> &lhs, const Vector<T, Alloc> &rhs)
 {
-    return std::lexicographical_compare(lhs.GetBegin(), lhs.GetEnd(), rhs.GetBegin(), rhs.GetEnd());
+    return std::lexicographical_compare(lhs.GetConstBegin(), lhs.GetConstEnd(), rhs.GetConstBegin(),
+                                        rhs.GetConstEnd());
 }
 
 template <typename T, typename Alloc>
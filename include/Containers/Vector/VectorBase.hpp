@@ -1,6 +1,7 @@
 #ifndef DSA_LIBRARIES_VECTOR_BASE_HPP
 #define DSA_LIBRARIES_VECTOR_BASE_HPP
 #include "../../Utilities/Algorithm.hpp"
+#include "../../Utilities/Instrumentation.hpp"
 #include "../../Utilities/Memory.hpp"
 #include "VectorExceptions.hpp"
 #include <cstddef>
@@ -627,6 +628,8 @@ namespace DSALibraries::Containers
 // {
 //     return !(lhs < rhs);
 // }
+template <typename T, typename Alloc> class Vector;
+
 template <typename T, typename Alloc> struct VectorBase
 {
   protected:
@@ -747,15 +750,28 @@ template <typename T, typename Alloc> struct VectorBase
         }
     }
 
+    ~VectorBase()
+    {
+        DeallocateInternal(this->VectorData.PointerStart,
+                           this->VectorData.PointerEndOfStorage - this->VectorData.PointerStart);
+    }
+
     constexpr PointerTypeAlias AllocateInternal(size_t size)
     {
-        return size != 0 ? TypeAllocatorTraits::allocate(this->GetTpAllocator(), size) : PointerTypeAlias();
+        if (size == 0)
+        {
+            return PointerTypeAlias();
+        }
+        PointerTypeAlias pointer = TypeAllocatorTraits::allocate(this->GetTpAllocator(), size);
+        Utilities::InstrumentationHooks<Vector<T, Alloc>>::OnAllocation(size * sizeof(T));
+        return pointer;
     }
 
     constexpr void DeallocateInternal(PointerTypeAlias p, size_t size)
     {
         if (p != nullptr)
         {
+            Utilities::InstrumentationHooks<Vector<T, Alloc>>::OnDeallocation(size * sizeof(T));
             TypeAllocatorTraits::deallocate(this->GetTpAllocator(), p, size);
         }
     }
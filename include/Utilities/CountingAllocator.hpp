@@ -0,0 +1,67 @@
+#ifndef DSA_LIBRARIES_UTILITIES_COUNTING_ALLOCATOR_HPP
+#define DSA_LIBRARIES_UTILITIES_COUNTING_ALLOCATOR_HPP
+#include "Allocator.hpp"
+#include "Instrumentation.hpp"
+#include <cstddef>
+namespace DSALibraries::Utilities
+{
+/** Default tag of CountingAllocator: every instance that is not given its own tag counts here. */
+struct CountingAllocatorTag
+{
+};
+
+/**
+ * @brief Allocator that counts allocations, bytes and peak live bytes into Instrumentation<Tag>.
+ *
+ * Unlike the container hooks it counts whether or not DSA_LIBRARIES_ENABLE_INSTRUMENTATION is set: choosing this
+ * allocator is the opt-in. Rebinding keeps the tag, so the nodes of a list count under the list's tag.
+ */
+template <typename T, typename Tag = CountingAllocatorTag> class CountingAllocator : public Allocator<T>
+{
+  public:
+    using value_type = T;
+    using TagTypeAlias = Tag;
+
+    template <typename U> struct rebind
+    {
+        typedef CountingAllocator<U, Tag> other;
+    };
+
+    CountingAllocator() noexcept = default;
+
+    template <typename U> constexpr CountingAllocator(CountingAllocator<U, Tag> const &) noexcept
+    {
+    }
+
+    [[nodiscard]] value_type *allocate(std::size_t n, const void *hint = static_cast<const void *>(nullptr))
+    {
+        value_type *pointer = Allocator<T>::allocate(n, hint);
+        Instrumentation<Tag>::RecordAllocation(n * sizeof(value_type));
+        return pointer;
+    }
+
+    void deallocate(value_type *pValueType, std::size_t n) noexcept
+    {
+        Instrumentation<Tag>::RecordDeallocation(n * sizeof(value_type));
+        Allocator<T>::deallocate(pValueType, n);
+    }
+
+    CountingAllocator select_on_container_copy_construction() const noexcept
+    {
+        return *this;
+    }
+};
+
+template <typename T, typename U, typename Tag>
+bool operator==(CountingAllocator<T, Tag> const &, CountingAllocator<U, Tag> const &) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U, typename Tag>
+bool operator!=(CountingAllocator<T, Tag> const &x, CountingAllocator<U, Tag> const &y) noexcept
+{
+    return !(x == y);
+}
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_COUNTING_ALLOCATOR_HPP
@@ -0,0 +1,256 @@
+#ifndef DSA_LIBRARIES_UTILITIES_EPOCH_RECLAMATION_HPP
+#define DSA_LIBRARIES_UTILITIES_EPOCH_RECLAMATION_HPP
+#include "Exception.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+namespace DSALibraries::Utilities
+{
+/**
+ * @brief Intrusive hook for objects handed to an EpochManager. Nodes of lock-free containers derive from it so that
+ * retiring them never allocates.
+ */
+struct EpochRetiredNode
+{
+    EpochRetiredNode *PointerRetiredNext = nullptr;
+    std::uint64_t RetiredEpoch = 0;
+};
+
+class EpochParticipantsExhaustedException : public Exception
+{
+  public:
+    EpochParticipantsExhaustedException(string_type fileText, numeric_type line)
+        : Exception("Every epoch participant slot is pinned", std::move(fileText), line)
+    {
+    }
+};
+
+/**
+ * @brief Epoch-based memory reclamation.
+ *
+ * Readers pin the current global epoch for the duration of an operation. A retired node is handed back to its owner
+ * only once the global epoch has advanced twice past the epoch it was retired in, which guarantees that no pinned
+ * reader can still hold a pointer to it. The epoch advances when every pinned participant has observed it.
+ */
+class EpochManager
+{
+  public:
+    using SizeTypeAlias = std::size_t;
+    using EpochTypeAlias = std::uint64_t;
+
+    static constexpr SizeTypeAlias MaxParticipants = 256;
+    /** Full sweeps over the participant slots, yielding between them, before Pin gives up. */
+    static constexpr SizeTypeAlias MaxPinSweeps = 64;
+    static constexpr EpochTypeAlias InactiveEpoch = ~EpochTypeAlias(0);
+
+  private:
+    struct alignas(64) Participant
+    {
+        std::atomic<bool> InUse{false};
+        std::atomic<EpochTypeAlias> Epoch{InactiveEpoch};
+    };
+
+    alignas(64) std::atomic<EpochTypeAlias> _globalEpoch{0};
+    alignas(64) std::atomic<EpochRetiredNode *> _retiredHead{nullptr};
+    Participant _participants[MaxParticipants];
+
+  public:
+    class Guard
+    {
+      private:
+        EpochManager *_manager;
+        SizeTypeAlias _slot;
+
+      public:
+        explicit Guard(EpochManager &manager) : _manager(&manager), _slot(manager.PinInternal())
+        {
+        }
+
+        Guard(Guard &&other) noexcept : _manager(other._manager), _slot(other._slot)
+        {
+            other._manager = nullptr;
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+        Guard &operator=(Guard &&) = delete;
+
+        ~Guard()
+        {
+            if (_manager)
+            {
+                _manager->UnpinInternal(_slot);
+            }
+        }
+    };
+
+    EpochManager() = default;
+    EpochManager(const EpochManager &) = delete;
+    EpochManager &operator=(const EpochManager &) = delete;
+
+    /**
+     * @throw EpochParticipantsExhaustedException if all MaxParticipants slots stay pinned for MaxPinSweeps sweeps.
+     */
+    [[nodiscard]] Guard Pin()
+    {
+        return Guard(*this);
+    }
+
+    [[nodiscard]] EpochTypeAlias GetEpoch() const noexcept
+    {
+        return _globalEpoch.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Queue a node that is no longer reachable by new readers. The node is handed to the deleter of a later
+     * Collect or Drain call.
+     */
+    void Retire(EpochRetiredNode *node) noexcept
+    {
+        node->RetiredEpoch = _globalEpoch.load(std::memory_order_acquire);
+        EpochRetiredNode *head = _retiredHead.load(std::memory_order_relaxed);
+        do
+        {
+            node->PointerRetiredNext = head;
+        } while (!_retiredHead.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Try to advance the global epoch and pass every node that is safe to free to the deleter.
+     * @return The number of nodes released.
+     */
+    template <typename TDeleter> SizeTypeAlias Collect(TDeleter deleter)
+    {
+        this->TryAdvanceInternal();
+
+        EpochRetiredNode *node = _retiredHead.exchange(nullptr, std::memory_order_acquire);
+        const EpochTypeAlias epoch = _globalEpoch.load(std::memory_order_acquire);
+
+        EpochRetiredNode *keepHead = nullptr;
+        EpochRetiredNode *keepTail = nullptr;
+        SizeTypeAlias released = 0;
+
+        while (node)
+        {
+            EpochRetiredNode *next = node->PointerRetiredNext;
+            if (node->RetiredEpoch + 2 <= epoch)
+            {
+                deleter(node);
+                ++released;
+            }
+            else
+            {
+                node->PointerRetiredNext = keepHead;
+                keepHead = node;
+                if (!keepTail)
+                {
+                    keepTail = node;
+                }
+            }
+            node = next;
+        }
+
+        if (keepHead)
+        {
+            EpochRetiredNode *head = _retiredHead.load(std::memory_order_relaxed);
+            do
+            {
+                keepTail->PointerRetiredNext = head;
+            } while (!_retiredHead.compare_exchange_weak(head, keepHead, std::memory_order_release,
+                                                         std::memory_order_relaxed));
+        }
+
+        return released;
+    }
+
+    /**
+     * @brief Release every retired node regardless of epoch. Only valid once no other thread is pinned.
+     */
+    template <typename TDeleter> SizeTypeAlias Drain(TDeleter deleter)
+    {
+        EpochRetiredNode *node = _retiredHead.exchange(nullptr, std::memory_order_acquire);
+        SizeTypeAlias released = 0;
+        while (node)
+        {
+            EpochRetiredNode *next = node->PointerRetiredNext;
+            deleter(node);
+            ++released;
+            node = next;
+        }
+        return released;
+    }
+
+  private:
+    SizeTypeAlias AcquireSlotInternal() noexcept
+    {
+        SizeTypeAlias slot = std::hash<std::thread::id>()(std::this_thread::get_id()) % MaxParticipants;
+
+        for (SizeTypeAlias sweep = 0; sweep < MaxPinSweeps; ++sweep)
+        {
+            for (SizeTypeAlias i = 0; i < MaxParticipants; ++i)
+            {
+                Participant &participant = _participants[slot];
+                bool expected = false;
+                if (!participant.InUse.load(std::memory_order_relaxed) &&
+                    participant.InUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                {
+                    return slot;
+                }
+                slot = (slot + 1) % MaxParticipants;
+            }
+            std::this_thread::yield();
+        }
+        return MaxParticipants;
+    }
+
+    SizeTypeAlias PinInternal()
+    {
+        const SizeTypeAlias slot = this->AcquireSlotInternal();
+        if (slot == MaxParticipants)
+        {
+            throw EpochParticipantsExhaustedException(__FILE__, __LINE__);
+        }
+
+        Participant &participant = _participants[slot];
+        EpochTypeAlias epoch = _globalEpoch.load(std::memory_order_seq_cst);
+        while (true)
+        {
+            participant.Epoch.store(epoch, std::memory_order_seq_cst);
+            const EpochTypeAlias current = _globalEpoch.load(std::memory_order_seq_cst);
+            if (current == epoch)
+            {
+                break;
+            }
+            epoch = current;
+        }
+
+        return slot;
+    }
+
+    void UnpinInternal(SizeTypeAlias slot) noexcept
+    {
+        _participants[slot].Epoch.store(InactiveEpoch, std::memory_order_release);
+        _participants[slot].InUse.store(false, std::memory_order_release);
+    }
+
+    bool TryAdvanceInternal() noexcept
+    {
+        EpochTypeAlias epoch = _globalEpoch.load(std::memory_order_seq_cst);
+
+        for (const Participant &participant : _participants)
+        {
+            const EpochTypeAlias observed = participant.Epoch.load(std::memory_order_seq_cst);
+            if (observed != InactiveEpoch && observed != epoch)
+            {
+                return false;
+            }
+        }
+
+        return _globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    }
+};
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_EPOCH_RECLAMATION_HPP
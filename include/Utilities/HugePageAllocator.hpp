@@ -0,0 +1,125 @@
+#ifndef DSA_LIBRARIES_UTILITIES_HUGE_PAGE_ALLOCATOR_HPP
+#define DSA_LIBRARIES_UTILITIES_HUGE_PAGE_ALLOCATOR_HPP
+#include "Allocator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <sys/mman.h>
+namespace DSALibraries::Utilities
+{
+/** Size and alignment of a transparent or reserved huge page on x86-64 and most AArch64 kernels. */
+inline constexpr std::size_t HugePageSize = std::size_t(2) << 20;
+
+/**
+ * @brief Allocator that backs large blocks with huge pages, so scans and sorts over a big Vector take one TLB entry
+ * per 2 MiB instead of per 4 KiB.
+ *
+ * Requests of at least HugePageSize bytes are rounded up to whole huge pages and mapped directly: first from the
+ * reserved pool with MAP_HUGETLB, and when that is empty or missing, as an ordinary mapping aligned to 2 MiB and
+ * marked MADV_HUGEPAGE for transparent huge pages. Where neither flag exists the aligned mapping is still returned.
+ * Smaller requests go to Allocator<T>, so list nodes and small vectors are unaffected.
+ */
+template <typename T> class HugePageAllocator : public Allocator<T>
+{
+  public:
+    using value_type = T;
+
+    template <typename U> struct rebind
+    {
+        typedef HugePageAllocator<U> other;
+    };
+
+    HugePageAllocator() noexcept = default;
+
+    template <typename U> constexpr HugePageAllocator(HugePageAllocator<U> const &) noexcept
+    {
+    }
+
+    [[nodiscard]] value_type *allocate(std::size_t n, const void *hint = static_cast<const void *>(nullptr))
+    {
+        const std::size_t bytes = n * sizeof(value_type);
+        if (!IsLargeInternal(bytes))
+        {
+            return Allocator<T>::allocate(n, hint);
+        }
+        return static_cast<value_type *>(MapInternal(RoundUpInternal(bytes)));
+    }
+
+    void deallocate(value_type *pValueType, std::size_t n) noexcept
+    {
+        const std::size_t bytes = n * sizeof(value_type);
+        if (!IsLargeInternal(bytes))
+        {
+            Allocator<T>::deallocate(pValueType, n);
+            return;
+        }
+        ::munmap(pValueType, RoundUpInternal(bytes));
+    }
+
+    HugePageAllocator select_on_container_copy_construction() const noexcept
+    {
+        return *this;
+    }
+
+    /** Whether a request of n elements takes the huge page path. */
+    [[nodiscard]] static constexpr bool IsLarge(std::size_t n) noexcept
+    {
+        return IsLargeInternal(n * sizeof(value_type));
+    }
+
+  private:
+    static constexpr bool IsLargeInternal(std::size_t bytes) noexcept
+    {
+        return bytes >= HugePageSize;
+    }
+
+    static constexpr std::size_t RoundUpInternal(std::size_t bytes) noexcept
+    {
+        return (bytes + HugePageSize - 1) & ~(HugePageSize - 1);
+    }
+
+    static void *MapInternal(std::size_t bytes)
+    {
+#ifdef MAP_HUGETLB
+        void *reserved = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (reserved != MAP_FAILED)
+        {
+            return reserved;
+        }
+#endif
+        // Over-map by one huge page and trim both ends, which leaves a 2 MiB aligned block the kernel can back
+        // with whole huge pages.
+        auto *mapped = static_cast<unsigned char *>(
+            ::mmap(nullptr, bytes + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (mapped == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        const auto address = reinterpret_cast<std::uintptr_t>(mapped);
+        const std::size_t head = ((address + HugePageSize - 1) & ~(HugePageSize - 1)) - address;
+        unsigned char *aligned = mapped + head;
+        if (head > 0)
+        {
+            ::munmap(mapped, head);
+        }
+        ::munmap(aligned + bytes, HugePageSize - head);
+#ifdef MADV_HUGEPAGE
+        ::madvise(aligned, bytes, MADV_HUGEPAGE);
+#endif
+        return aligned;
+    }
+};
+
+template <typename T, typename U>
+bool operator==(HugePageAllocator<T> const &, HugePageAllocator<U> const &) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(HugePageAllocator<T> const &x, HugePageAllocator<U> const &y) noexcept
+{
+    return !(x == y);
+}
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_HUGE_PAGE_ALLOCATOR_HPP
@@ -0,0 +1,226 @@
+#ifndef DSA_LIBRARIES_UTILITIES_INSTRUMENTATION_HPP
+#define DSA_LIBRARIES_UTILITIES_INSTRUMENTATION_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Define to 1 (e.g. -DDSA_LIBRARIES_ENABLE_INSTRUMENTATION=1) to make the containers report to Instrumentation. When
+// it is 0 every hook is an empty inline function and the comparators passed to the sorts are not wrapped.
+#ifndef DSA_LIBRARIES_ENABLE_INSTRUMENTATION
+#define DSA_LIBRARIES_ENABLE_INSTRUMENTATION 0
+#endif
+
+namespace DSALibraries::Utilities
+{
+inline constexpr bool IsInstrumentationEnabled = DSA_LIBRARIES_ENABLE_INSTRUMENTATION != 0;
+
+/**
+ * @brief Counter values read at one point in time.
+ */
+struct InstrumentationSnapshot
+{
+    std::uint64_t Allocations = 0;
+    std::uint64_t Deallocations = 0;
+    std::uint64_t AllocatedBytes = 0;
+    std::uint64_t LiveBytes = 0;
+    std::uint64_t PeakBytes = 0;
+    std::uint64_t Reallocations = 0;
+    std::uint64_t ElementMoves = 0;
+    std::uint64_t NodeWalks = 0;
+    std::uint64_t Comparisons = 0;
+};
+
+/**
+ * @brief Counters of one container type. Relaxed atomics, so containers used from several threads can share them.
+ */
+struct InstrumentationCounters
+{
+    std::atomic<std::uint64_t> Allocations{0};
+    std::atomic<std::uint64_t> Deallocations{0};
+    std::atomic<std::uint64_t> AllocatedBytes{0};
+    std::atomic<std::uint64_t> LiveBytes{0};
+    std::atomic<std::uint64_t> PeakBytes{0};
+    std::atomic<std::uint64_t> Reallocations{0};
+    std::atomic<std::uint64_t> ElementMoves{0};
+    std::atomic<std::uint64_t> NodeWalks{0};
+    std::atomic<std::uint64_t> Comparisons{0};
+};
+
+/**
+ * @brief Process-wide counters keyed by a tag type, normally the container type itself: Instrumentation<Vector<int>>
+ * holds what every Vector<int> did.
+ *
+ * The Record functions always count; they are used directly by opt-in tools such as CountingAllocator. Containers
+ * report through InstrumentationHooks instead, which are compiled out unless DSA_LIBRARIES_ENABLE_INSTRUMENTATION is
+ * set.
+ */
+template <typename Tag> class Instrumentation
+{
+  private:
+    static InstrumentationCounters &GetCountersInternal() noexcept
+    {
+        static InstrumentationCounters counters;
+        return counters;
+    }
+
+  public:
+    [[nodiscard]] static InstrumentationSnapshot GetSnapshot() noexcept
+    {
+        const InstrumentationCounters &counters = GetCountersInternal();
+        InstrumentationSnapshot snapshot;
+        snapshot.Allocations = counters.Allocations.load(std::memory_order_relaxed);
+        snapshot.Deallocations = counters.Deallocations.load(std::memory_order_relaxed);
+        snapshot.AllocatedBytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+        snapshot.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+        snapshot.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+        snapshot.Reallocations = counters.Reallocations.load(std::memory_order_relaxed);
+        snapshot.ElementMoves = counters.ElementMoves.load(std::memory_order_relaxed);
+        snapshot.NodeWalks = counters.NodeWalks.load(std::memory_order_relaxed);
+        snapshot.Comparisons = counters.Comparisons.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    /**
+     * @brief Zero every counter. Live bytes are zeroed as well, so reset while nothing of this type is alive.
+     */
+    static void Reset() noexcept
+    {
+        InstrumentationCounters &counters = GetCountersInternal();
+        counters.Allocations.store(0, std::memory_order_relaxed);
+        counters.Deallocations.store(0, std::memory_order_relaxed);
+        counters.AllocatedBytes.store(0, std::memory_order_relaxed);
+        counters.LiveBytes.store(0, std::memory_order_relaxed);
+        counters.PeakBytes.store(0, std::memory_order_relaxed);
+        counters.Reallocations.store(0, std::memory_order_relaxed);
+        counters.ElementMoves.store(0, std::memory_order_relaxed);
+        counters.NodeWalks.store(0, std::memory_order_relaxed);
+        counters.Comparisons.store(0, std::memory_order_relaxed);
+    }
+
+    static void RecordAllocation(std::size_t bytes) noexcept
+    {
+        InstrumentationCounters &counters = GetCountersInternal();
+        counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.AllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+        const std::uint64_t live = counters.LiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        std::uint64_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+        while (peak < live && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    static void RecordDeallocation(std::size_t bytes) noexcept
+    {
+        InstrumentationCounters &counters = GetCountersInternal();
+        counters.Deallocations.fetch_add(1, std::memory_order_relaxed);
+        counters.LiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    static void RecordReallocation(std::size_t movedElements) noexcept
+    {
+        InstrumentationCounters &counters = GetCountersInternal();
+        counters.Reallocations.fetch_add(1, std::memory_order_relaxed);
+        counters.ElementMoves.fetch_add(movedElements, std::memory_order_relaxed);
+    }
+
+    static void RecordMoves(std::size_t count) noexcept
+    {
+        GetCountersInternal().ElementMoves.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void RecordNodeWalks(std::size_t count) noexcept
+    {
+        GetCountersInternal().NodeWalks.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void RecordComparisons(std::size_t count) noexcept
+    {
+        GetCountersInternal().Comparisons.fetch_add(count, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief The calls containers make; forwards to Instrumentation<Tag> only when instrumentation is enabled.
+ */
+template <typename Tag> struct InstrumentationHooks
+{
+    static void OnAllocation([[maybe_unused]] std::size_t bytes) noexcept
+    {
+        if constexpr (IsInstrumentationEnabled)
+        {
+            Instrumentation<Tag>::RecordAllocation(bytes);
+        }
+    }
+
+    static void OnDeallocation([[maybe_unused]] std::size_t bytes) noexcept
+    {
+        if constexpr (IsInstrumentationEnabled)
+        {
+            Instrumentation<Tag>::RecordDeallocation(bytes);
+        }
+    }
+
+    static void OnReallocation([[maybe_unused]] std::size_t movedElements) noexcept
+    {
+        if constexpr (IsInstrumentationEnabled)
+        {
+            Instrumentation<Tag>::RecordReallocation(movedElements);
+        }
+    }
+
+    static void OnNodeWalks([[maybe_unused]] std::size_t count) noexcept
+    {
+        if constexpr (IsInstrumentationEnabled)
+        {
+            Instrumentation<Tag>::RecordNodeWalks(count);
+        }
+    }
+};
+
+/**
+ * @brief Comparator that counts its calls into Instrumentation<Tag>.
+ */
+template <typename Tag, typename TCompare> class CountingCompare
+{
+  private:
+    TCompare _compare;
+
+  public:
+    explicit CountingCompare(TCompare compare) : _compare(std::move(compare))
+    {
+    }
+
+    template <typename TLeft, typename TRight> bool operator()(TLeft &&lhs, TRight &&rhs)
+    {
+        Instrumentation<Tag>::RecordComparisons(1);
+        return _compare(std::forward<TLeft>(lhs), std::forward<TRight>(rhs));
+    }
+};
+
+/**
+ * @brief The comparator a sort should use: compare wrapped in a CountingCompare when instrumentation is enabled,
+ * compare itself otherwise.
+ */
+template <typename Tag, typename TCompare> auto InstrumentCompare(TCompare compare)
+{
+    if constexpr (IsInstrumentationEnabled)
+    {
+        return CountingCompare<Tag, TCompare>(std::move(compare));
+    }
+    else
+    {
+        return compare;
+    }
+}
+
+/**
+ * @brief An already counting comparator is passed through, so nested sort entry points count each call once.
+ */
+template <typename Tag, typename OtherTag, typename TCompare>
+CountingCompare<OtherTag, TCompare> InstrumentCompare(CountingCompare<OtherTag, TCompare> compare)
+{
+    return compare;
+}
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_INSTRUMENTATION_HPP
@@ -0,0 +1,126 @@
+#ifndef DSA_LIBRARIES_UTILITIES_NODE_POOL_HPP
+#define DSA_LIBRARIES_UTILITIES_NODE_POOL_HPP
+#include "NodeSlabs.hpp"
+#include <cstddef>
+#include <new>
+namespace DSALibraries::Utilities
+{
+/**
+ * @brief Bounded free list of raw node storage kept by one list, so erasing and inserting in a steady state reuse
+ * nodes without calling the allocator.
+ *
+ * The pool holds no allocator; the owning list passes its node allocator in and must Release the pool before it is
+ * destroyed. The limit is 0 by default, which makes Push refuse every node and leaves the list's allocation pattern
+ * as it was. Moving a pool copies its limit only: cached nodes stay with, and are released by, the source.
+ */
+template <typename TNode, typename TAllocator> class NodePool
+{
+  private:
+    using NodeSlabsAlias = NodeSlabs<TNode, TAllocator>;
+
+    struct FreeNode
+    {
+        FreeNode *Next;
+    };
+
+    static_assert(sizeof(TNode) >= sizeof(FreeNode) && alignof(TNode) >= alignof(FreeNode),
+                  "A node must be able to hold a free list link");
+
+    FreeNode *_free = nullptr;
+    std::size_t _count = 0;
+    std::size_t _limit = 0;
+
+  public:
+    NodePool() noexcept = default;
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    NodePool(NodePool &&pool) noexcept : _limit(pool._limit)
+    {
+    }
+
+    ~NodePool() noexcept = default;
+
+    [[nodiscard]] std::size_t GetCount() const noexcept
+    {
+        return _count;
+    }
+
+    [[nodiscard]] std::size_t GetLimit() const noexcept
+    {
+        return _limit;
+    }
+
+    /** Take a cached node, or nullptr when the pool is empty. */
+    [[nodiscard]] TNode *Pop() noexcept
+    {
+        if (_free == nullptr)
+        {
+            return nullptr;
+        }
+        FreeNode *node = _free;
+        _free = node->Next;
+        --_count;
+        node->~FreeNode();
+        return reinterpret_cast<TNode *>(node);
+    }
+
+    /**
+     * Cache a node whose element is already destroyed. Returns false when the pool is full. The free list link only
+     * overlays the node's first link, so its SlabIndex survives the stay in the pool.
+     */
+    bool Push(TNode *node) noexcept
+    {
+        if (_count >= _limit)
+        {
+            return false;
+        }
+        _free = ::new (static_cast<void *>(node)) FreeNode{_free};
+        ++_count;
+        return true;
+    }
+
+    /**
+     * Cache at least count nodes, allocating the missing ones as one slab and raising the limit to count if needed.
+     * @return The bytes of the slab allocated, 0 when the pool already held count nodes.
+     */
+    std::size_t Reserve(TAllocator &allocator, std::size_t count)
+    {
+        if (count <= _count)
+        {
+            return 0;
+        }
+        const std::size_t missing = count - _count;
+        TNode *slab = NodeSlabsAlias::Allocate(allocator, missing);
+        _limit = count > _limit ? count : _limit;
+        for (std::size_t i = missing; i-- > 0;)
+        {
+            Push(slab + i);
+        }
+        return NodeSlabsAlias::GetSlabBytes(missing);
+    }
+
+    /**
+     * Set the limit, giving surplus nodes back to the allocator. onFree is called with what NodeSlabs::Deallocate
+     * returns for each node, so it sees 0 for a node whose slab is still in use.
+     */
+    template <typename TOnFree> void SetLimit(TAllocator &allocator, std::size_t limit, TOnFree onFree) noexcept
+    {
+        _limit = limit;
+        while (_count > _limit)
+        {
+            onFree(NodeSlabsAlias::Deallocate(allocator, Pop()));
+        }
+    }
+
+    /** Give every cached node back to the allocator, reporting each to onFree as SetLimit does; the limit is kept. */
+    template <typename TOnFree> void Release(TAllocator &allocator, TOnFree onFree) noexcept
+    {
+        const std::size_t limit = _limit;
+        SetLimit(allocator, 0, onFree);
+        _limit = limit;
+    }
+};
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_NODE_POOL_HPP
@@ -0,0 +1,139 @@
+#ifndef DSA_LIBRARIES_UTILITIES_NODE_SLABS_HPP
+#define DSA_LIBRARIES_UTILITIES_NODE_SLABS_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+namespace DSALibraries::Utilities
+{
+/**
+ * @brief Node slabs: arrays of list nodes taken from the node allocator in one call and handed out one node at a
+ * time.
+ *
+ * Every node records its place in its slab in SlabIndex, 0 for a node allocated on its own, and the slab keeps a
+ * header with its live node count just before its first node. Deallocate therefore finds a node's slab from the node
+ * alone, so a node spliced into another list is freed correctly by whichever list erases it, and lists share no
+ * state. The count is atomic only because two lists that split a slab may be used from different threads. The slab
+ * goes back to the allocator with its last node, so one long-lived node keeps the whole slab; Compact a list to move
+ * its nodes into a fresh slab. As with splicing, a node must be freed through an allocator equal to the one that
+ * allocated it.
+ */
+template <typename TNode, typename TAllocator> class NodeSlabs
+{
+  private:
+    using AllocatorTraitsAlias = std::allocator_traits<TAllocator>;
+
+    struct SlabHeader
+    {
+        std::atomic<std::size_t> Live;
+        std::size_t Count;
+    };
+
+    // Nodes' worth of storage in front of the first node that hold the header.
+    static constexpr std::size_t HeaderNodes = (sizeof(SlabHeader) + sizeof(TNode) - 1) / sizeof(TNode);
+
+    static_assert(alignof(TNode) >= alignof(SlabHeader), "A node slot must be able to hold the slab header");
+
+    static SlabHeader *GetHeaderInternal(TNode *node) noexcept
+    {
+        TNode *first = node - (node->SlabIndex - 1);
+        return std::launder(reinterpret_cast<SlabHeader *>(first - HeaderNodes));
+    }
+
+  public:
+    /** Most nodes in one slab, as SlabIndex is 32 bits wide. */
+    static constexpr std::size_t MaxCount = std::numeric_limits<std::uint32_t>::max();
+
+    /** Bytes one allocator call takes for a slab of count nodes, header included. */
+    [[nodiscard]] static constexpr std::size_t GetSlabBytes(std::size_t count) noexcept
+    {
+        return (HeaderNodes + count) * sizeof(TNode);
+    }
+
+    /** Allocate one node on its own. */
+    [[nodiscard]] static TNode *AllocateOne(TAllocator &allocator)
+    {
+        TNode *node = AllocatorTraitsAlias::allocate(allocator, 1);
+        node->SlabIndex = 0;
+        return node;
+    }
+
+    /**
+     * Allocate count contiguous nodes as one slab. The nodes are raw storage; each is later passed to Deallocate.
+     * @throw std::bad_array_new_length if count exceeds MaxCount.
+     */
+    [[nodiscard]] static TNode *Allocate(TAllocator &allocator, std::size_t count)
+    {
+        if (count > MaxCount)
+        {
+            throw std::bad_array_new_length();
+        }
+        TNode *storage = AllocatorTraitsAlias::allocate(allocator, HeaderNodes + count);
+        ::new (static_cast<void *>(storage)) SlabHeader{{count}, count};
+        TNode *first = storage + HeaderNodes;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            first[i].SlabIndex = static_cast<std::uint32_t>(i + 1);
+        }
+        return first;
+    }
+
+    /**
+     * Give back one node, whether it came from a slab or from AllocateOne.
+     * @return The bytes returned to the allocator: the node's own for a lone node, the whole slab's for the last
+     * live node of a slab, and 0 while other nodes of its slab are still in use.
+     */
+    static std::size_t Deallocate(TAllocator &allocator, TNode *node) noexcept
+    {
+        if (node->SlabIndex == 0)
+        {
+            AllocatorTraitsAlias::deallocate(allocator, node, 1);
+            return sizeof(TNode);
+        }
+        SlabHeader *header = GetHeaderInternal(node);
+        if (header->Live.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return 0;
+        }
+        const std::size_t count = header->Count;
+        header->~SlabHeader();
+        AllocatorTraitsAlias::deallocate(allocator, reinterpret_cast<TNode *>(header), HeaderNodes + count);
+        return GetSlabBytes(count);
+    }
+};
+
+/**
+ * @brief Measures how scattered a chain of nodes is: Visit each node in iteration order, then GetScatter gives the
+ * fraction of steps whose next node is not the one right after it in memory. 0 means laid out in order, 1 means no
+ * two neighbours are adjacent.
+ */
+template <typename TNode> class NodeScatter
+{
+  private:
+    const TNode *_previous = nullptr;
+    std::size_t _steps = 0;
+    std::size_t _jumps = 0;
+
+  public:
+    void Visit(const TNode *node) noexcept
+    {
+        if (_previous != nullptr)
+        {
+            ++_steps;
+            if (node != _previous + 1)
+            {
+                ++_jumps;
+            }
+        }
+        _previous = node;
+    }
+
+    [[nodiscard]] double GetScatter() const noexcept
+    {
+        return _steps == 0 ? 0.0 : static_cast<double>(_jumps) / static_cast<double>(_steps);
+    }
+};
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_NODE_SLABS_HPP
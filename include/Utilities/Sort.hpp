@@ -0,0 +1,888 @@
+#ifndef DSA_LIBRARIES_UTILITIES_SORT_HPP
+#define DSA_LIBRARIES_UTILITIES_SORT_HPP
+#include "Allocator.hpp"
+#include "Memory.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+namespace DSALibraries::Utilities
+{
+/** The algorithm AdaptiveSortRange, or a container's AdaptiveSort, picked for an input. */
+enum class SortStrategy
+{
+    Insertion,
+    RunMerge,
+    Radix,
+    IntroSort,
+    MergeSort,
+    /** The input was already in order, so a list's AdaptiveSort left it untouched. */
+    AlreadySorted
+};
+
+/**
+ * @brief What AdaptiveSortRange learned about its input before choosing a strategy.
+ */
+struct SortProfile
+{
+    std::size_t Size = 0;
+    /** Ascending or strictly descending runs, counted up to RunLimit + 1. */
+    std::size_t Runs = 0;
+    std::size_t RunLimit = 0;
+    /** Sampled elements equal to their successor once the sample is sorted. */
+    std::size_t SampleDuplicates = 0;
+    std::size_t SampleSize = 0;
+};
+
+/** Ranges up to this size are insertion sorted; larger for elements that are cheap to move. */
+template <typename T>
+inline constexpr std::size_t InsertionSortThreshold = std::is_trivially_copyable_v<T> && sizeof(T) <= 16 ? 32 : 16;
+
+/** Below this size radix sort's passes over the counts cost more than they save. */
+inline constexpr std::size_t RadixSortThreshold = 256;
+
+/**
+ * @brief Integral keys under std::less or std::greater, which LSD radix sort can order without comparisons.
+ */
+template <typename T, typename TCompare>
+inline constexpr bool IsRadixSortable =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+    (std::is_same_v<TCompare, std::less<T>> || std::is_same_v<TCompare, std::less<>> ||
+     std::is_same_v<TCompare, std::greater<T>> || std::is_same_v<TCompare, std::greater<>>);
+
+template <typename T, typename TCompare>
+inline constexpr bool IsDescendingCompare =
+    std::is_same_v<TCompare, std::greater<T>> || std::is_same_v<TCompare, std::greater<>>;
+
+/**
+ * @brief Uninitialized storage for up to capacity elements, with the constructed prefix destroyed on exit.
+ */
+template <typename T> class TemporaryBuffer
+{
+  private:
+    Allocator<T> _allocator;
+    T *_data = nullptr;
+    std::size_t _capacity = 0;
+    std::size_t _size = 0;
+
+  public:
+    explicit TemporaryBuffer(std::size_t capacity) : _data(_allocator.allocate(capacity)), _capacity(capacity)
+    {
+    }
+
+    TemporaryBuffer(const TemporaryBuffer &) = delete;
+    TemporaryBuffer &operator=(const TemporaryBuffer &) = delete;
+
+    ~TemporaryBuffer()
+    {
+        this->Clear();
+        _allocator.deallocate(_data, _capacity);
+    }
+
+    [[nodiscard]] T *GetData() const noexcept
+    {
+        return _data;
+    }
+
+    /**
+     * @brief Replace the contents with the elements of [first, last), moved in.
+     */
+    template <typename TIterator> T *MoveIn(TIterator first, TIterator last)
+    {
+        this->Clear();
+        T *end = UninitializedMove(first, last, _data);
+        _size = static_cast<std::size_t>(end - _data);
+        return end;
+    }
+
+    void Clear() noexcept
+    {
+        Destroy(_data, _data + _size);
+        _size = 0;
+    }
+};
+
+template <typename TIterator, typename TCompare> void InsertionSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    if (first == last)
+    {
+        return;
+    }
+    for (TIterator i = first + 1; i != last; ++i)
+    {
+        if (comp(*i, *first))
+        {
+            typename std::iterator_traits<TIterator>::value_type key = std::move(*i);
+            MoveBackward(first, i, i + 1);
+            *first = std::move(key);
+        }
+        else
+        {
+            // *first is a sentinel, so the inner loop needs no bounds check.
+            typename std::iterator_traits<TIterator>::value_type key = std::move(*i);
+            TIterator j = i;
+            for (TIterator previous = j - 1; comp(key, *previous); --previous)
+            {
+                *j = std::move(*previous);
+                j = previous;
+            }
+            *j = std::move(key);
+        }
+    }
+}
+
+template <typename TIterator, typename TCompare> void SelectionSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    for (; first != last; ++first)
+    {
+        TIterator least = first;
+        for (TIterator j = first + 1; j != last; ++j)
+        {
+            if (comp(*j, *least))
+            {
+                least = j;
+            }
+        }
+        if (least != first)
+        {
+            swap(*first, *least);
+        }
+    }
+}
+
+/** Stops after the first pass without a swap. */
+template <typename TIterator, typename TCompare> void BubbleSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    for (bool isSwapped = true; isSwapped && last - first > 1; --last)
+    {
+        isSwapped = false;
+        for (TIterator j = first; j + 1 != last; ++j)
+        {
+            if (comp(*(j + 1), *j))
+            {
+                swap(*j, *(j + 1));
+                isSwapped = true;
+            }
+        }
+    }
+}
+
+template <typename TIterator, typename TCompare>
+void SiftDownRange(TIterator first, std::ptrdiff_t size, std::ptrdiff_t index, TCompare comp)
+{
+    typename std::iterator_traits<TIterator>::value_type value = std::move(*(first + index));
+    for (std::ptrdiff_t child = 2 * index + 1; child < size; child = 2 * index + 1)
+    {
+        if (child + 1 < size && comp(*(first + child), *(first + child + 1)))
+        {
+            ++child;
+        }
+        if (!comp(value, *(first + child)))
+        {
+            break;
+        }
+        *(first + index) = std::move(*(first + child));
+        index = child;
+    }
+    *(first + index) = std::move(value);
+}
+
+template <typename TIterator, typename TCompare> void HeapSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    const std::ptrdiff_t size = last - first;
+    for (std::ptrdiff_t i = size / 2; i-- > 0;)
+    {
+        SiftDownRange(first, size, i, comp);
+    }
+    for (std::ptrdiff_t end = size - 1; end > 0; --end)
+    {
+        swap(*first, *(first + end));
+        SiftDownRange(first, end, 0, comp);
+    }
+}
+
+/**
+ * @brief Quick sort with a Lomuto partition around the last element, the algorithm behind Vector::QuickSort.
+ * O(n^2) on sorted input, so prefer IntroSortRange; the recursion takes the smaller side to keep the stack short.
+ */
+template <typename TIterator, typename TCompare> void QuickSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    while (last - first > 1)
+    {
+        TIterator pivot = last - 1;
+        TIterator store = first;
+        for (TIterator j = first; j != pivot; ++j)
+        {
+            if (comp(*j, *pivot))
+            {
+                swap(*store, *j);
+                ++store;
+            }
+        }
+        swap(*store, *pivot);
+        if (store - first < last - store)
+        {
+            QuickSortRange(first, store, comp);
+            first = store + 1;
+        }
+        else
+        {
+            QuickSortRange(store + 1, last, comp);
+            last = store;
+        }
+    }
+}
+
+template <typename TIterator, typename TCompare>
+void MedianOfThreeToFirst(TIterator first, TIterator a, TIterator b, TIterator c, TCompare comp)
+{
+    using std::swap;
+    TIterator median;
+    if (comp(*a, *b))
+    {
+        median = comp(*b, *c) ? b : (comp(*a, *c) ? c : a);
+    }
+    else
+    {
+        median = comp(*a, *c) ? a : (comp(*b, *c) ? c : b);
+    }
+    if (median != first)
+    {
+        swap(*first, *median);
+    }
+}
+
+/**
+ * @brief Move a median-of-three pivot (ninther for large ranges) to *first.
+ */
+template <typename TIterator, typename TCompare> void ChoosePivotRange(TIterator first, TIterator last, TCompare comp)
+{
+    const std::ptrdiff_t size = last - first;
+    TIterator middle = first + size / 2;
+    if (size > 128)
+    {
+        const std::ptrdiff_t step = size / 8;
+        MedianOfThreeToFirst(first + 1, first + 1, first + 1 + step, first + 1 + 2 * step, comp);
+        MedianOfThreeToFirst(middle, middle - step, middle, middle + step, comp);
+        MedianOfThreeToFirst(last - 1, last - 1 - 2 * step, last - 1 - step, last - 1, comp);
+        MedianOfThreeToFirst(first, first + 1, middle, last - 1, comp);
+    }
+    else
+    {
+        MedianOfThreeToFirst(first, first + 1, middle, last - 1, comp);
+    }
+}
+
+/**
+ * @brief Hoare partition around *first. Elements equal to the pivot stop both scans, so duplicates split evenly.
+ * @return Position of the pivot, with [first, pivot) not greater and (pivot, last) not less.
+ */
+template <typename TIterator, typename TCompare>
+TIterator PartitionRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    TIterator left = first + 1;
+    TIterator right = last - 1;
+    while (true)
+    {
+        while (left <= right && comp(*left, *first))
+        {
+            ++left;
+        }
+        while (left <= right && comp(*first, *right))
+        {
+            --right;
+        }
+        if (left >= right)
+        {
+            break;
+        }
+        swap(*left, *right);
+        ++left;
+        --right;
+    }
+    swap(*first, *right);
+    return right;
+}
+
+/**
+ * @brief Three-way partition around *first.
+ * @return [lower, upper) holds the elements equal to the pivot.
+ */
+template <typename TIterator, typename TCompare>
+std::pair<TIterator, TIterator> PartitionThreeWayRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    typename std::iterator_traits<TIterator>::value_type pivot = std::move(*first);
+    TIterator lower = first;
+    TIterator current = first + 1;
+    TIterator upper = last;
+    while (current < upper)
+    {
+        if (comp(*current, pivot))
+        {
+            // lower is a hole left by the pivot; the first equal element moves behind the equal run.
+            *lower = std::move(*current);
+            ++lower;
+            if (lower != current)
+            {
+                *current = std::move(*lower);
+            }
+            ++current;
+        }
+        else if (comp(pivot, *current))
+        {
+            --upper;
+            swap(*current, *upper);
+        }
+        else
+        {
+            ++current;
+        }
+    }
+    *lower = std::move(pivot);
+    return {lower, upper};
+}
+
+template <typename TIterator, typename TCompare>
+void IntroSortLoop(TIterator first, TIterator last, unsigned depth, bool isThreeWay, TCompare comp)
+{
+    constexpr std::ptrdiff_t threshold =
+        static_cast<std::ptrdiff_t>(InsertionSortThreshold<typename std::iterator_traits<TIterator>::value_type>);
+    while (last - first > threshold)
+    {
+        if (depth == 0)
+        {
+            HeapSortRange(first, last, comp);
+            return;
+        }
+        --depth;
+        ChoosePivotRange(first, last, comp);
+
+        TIterator leftEnd;
+        TIterator rightBegin;
+        if (isThreeWay)
+        {
+            const auto bounds = PartitionThreeWayRange(first, last, comp);
+            leftEnd = bounds.first;
+            rightBegin = bounds.second;
+        }
+        else
+        {
+            leftEnd = PartitionRange(first, last, comp);
+            rightBegin = leftEnd + 1;
+        }
+
+        // Recurse into the smaller side so the stack stays O(log n).
+        if (leftEnd - first < last - rightBegin)
+        {
+            IntroSortLoop(first, leftEnd, depth, isThreeWay, comp);
+            first = rightBegin;
+        }
+        else
+        {
+            IntroSortLoop(rightBegin, last, depth, isThreeWay, comp);
+            last = leftEnd;
+        }
+    }
+}
+
+/**
+ * @brief Quick sort with a depth limit of 2 log2 n, past which it switches to heap sort, and insertion sort for
+ * small partitions. O(n log n) worst case, not stable.
+ *
+ * @param isThreeWay Partition into less, equal and greater, which is O(n log k) for k distinct keys.
+ */
+template <typename TIterator, typename TCompare>
+void IntroSortRange(TIterator first, TIterator last, TCompare comp, bool isThreeWay = false)
+{
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size > 1)
+    {
+        IntroSortLoop(first, last, 2 * static_cast<unsigned>(std::bit_width(size)), isThreeWay, comp);
+        InsertionSortRange(first, last, comp);
+    }
+}
+
+/**
+ * @brief Move the median of the medians of groups of five to *first, a pivot that leaves at least 3/10 of the range
+ * on either side.
+ */
+template <typename TIterator, typename TCompare>
+void MedianOfMediansPivotRange(TIterator first, TIterator last, TCompare comp);
+
+template <typename TIterator, typename TCompare>
+void SelectRange(TIterator first, TIterator nth, TIterator last, TCompare comp, bool isMedianOfMedians)
+{
+    constexpr std::ptrdiff_t threshold = 16;
+    // Introselect: each partition should at least halve the range; after log2 n that did not, the pivots come from
+    // the median of medians, which bounds the rest to linear time.
+    unsigned budget = static_cast<unsigned>(std::bit_width(static_cast<std::size_t>(last - first)));
+    while (last - first > threshold)
+    {
+        const std::ptrdiff_t size = last - first;
+        if (isMedianOfMedians)
+        {
+            MedianOfMediansPivotRange(first, last, comp);
+        }
+        else
+        {
+            ChoosePivotRange(first, last, comp);
+        }
+
+        const TIterator pivot = PartitionRange(first, last, comp);
+        if (pivot == nth)
+        {
+            return;
+        }
+        if (nth < pivot)
+        {
+            last = pivot;
+        }
+        else
+        {
+            first = pivot + 1;
+        }
+
+        if (!isMedianOfMedians && 2 * (last - first) > size && --budget == 0)
+        {
+            isMedianOfMedians = true;
+        }
+    }
+    InsertionSortRange(first, last, comp);
+}
+
+template <typename TIterator, typename TCompare>
+void MedianOfMediansPivotRange(TIterator first, TIterator last, TCompare comp)
+{
+    using std::swap;
+    // Gather the group medians at the front; each lands in a group already visited.
+    TIterator medians = first;
+    for (TIterator group = first; group != last;)
+    {
+        const TIterator groupEnd = last - group > 5 ? group + 5 : last;
+        InsertionSortRange(group, groupEnd, comp);
+        swap(*medians, *(group + (groupEnd - group) / 2));
+        ++medians;
+        group = groupEnd;
+    }
+    const std::ptrdiff_t count = medians - first;
+    SelectRange(first, first + count / 2, medians, comp, true);
+    swap(*first, *(first + count / 2));
+}
+
+/**
+ * @brief Rearrange [first, last) so that *nth is the element a full sort would put there, nothing before it is
+ * greater and nothing after it is less. Introselect: O(n) on average and in the worst case.
+ */
+template <typename TIterator, typename TCompare>
+void NthElementRange(TIterator first, TIterator nth, TIterator last, TCompare comp)
+{
+    if (nth != last)
+    {
+        SelectRange(first, nth, last, comp, false);
+    }
+}
+
+/**
+ * @brief Sort the middle - first least elements of [first, last) into [first, middle); the rest is left in
+ * unspecified order. O(n + k log k) for k = middle - first.
+ */
+template <typename TIterator, typename TCompare>
+void PartialSortRange(TIterator first, TIterator middle, TIterator last, TCompare comp)
+{
+    if (first == middle)
+    {
+        return;
+    }
+    if (middle == last)
+    {
+        IntroSortRange(first, last, comp);
+        return;
+    }
+    NthElementRange(first, middle - 1, last, comp);
+    IntroSortRange(first, middle - 1, comp);
+}
+
+/**
+ * @brief End of the run that starts at first: ascending, or strictly descending and then reversed in place.
+ */
+template <typename TIterator, typename TCompare>
+TIterator ExtendRunRange(TIterator first, TIterator last, TCompare comp, bool isReversing)
+{
+    TIterator end = first + 1;
+    if (end == last)
+    {
+        return end;
+    }
+    if (comp(*end, *first))
+    {
+        while (end != last && comp(*end, *(end - 1)))
+        {
+            ++end;
+        }
+        if (isReversing)
+        {
+            std::reverse(first, end);
+        }
+    }
+    else
+    {
+        while (end != last && !comp(*end, *(end - 1)))
+        {
+            ++end;
+        }
+    }
+    return end;
+}
+
+/**
+ * @brief Number of runs in [first, last), counting no further than limit + 1.
+ */
+template <typename TIterator, typename TCompare>
+std::size_t CountRunsRange(TIterator first, TIterator last, TCompare comp, std::size_t limit)
+{
+    std::size_t runs = 0;
+    while (first != last && runs <= limit)
+    {
+        first = ExtendRunRange(first, last, comp, false);
+        ++runs;
+    }
+    return runs;
+}
+
+/**
+ * @brief Merge the sorted ranges [first, middle) and [middle, last), buffering the shorter one.
+ */
+template <typename TIterator, typename TCompare, typename T>
+void MergeAdjacentRange(TIterator first, TIterator middle, TIterator last, TCompare comp, TemporaryBuffer<T> &buffer)
+{
+    if (first == middle || middle == last || !comp(*middle, *(middle - 1)))
+    {
+        return;
+    }
+
+    if (middle - first <= last - middle)
+    {
+        T *bufferBegin = buffer.GetData();
+        T *bufferEnd = buffer.MoveIn(first, middle);
+        TIterator out = first;
+        while (bufferBegin != bufferEnd && middle != last)
+        {
+            // Ties take the left element, which keeps the merge stable.
+            if (comp(*middle, *bufferBegin))
+            {
+                *out = std::move(*middle);
+                ++middle;
+            }
+            else
+            {
+                *out = std::move(*bufferBegin);
+                ++bufferBegin;
+            }
+            ++out;
+        }
+        Move(bufferBegin, bufferEnd, out);
+    }
+    else
+    {
+        T *bufferBegin = buffer.GetData();
+        T *bufferEnd = buffer.MoveIn(middle, last);
+        TIterator out = last;
+        while (bufferBegin != bufferEnd && first != middle)
+        {
+            if (comp(*(bufferEnd - 1), *(middle - 1)))
+            {
+                --middle;
+                *--out = std::move(*middle);
+            }
+            else
+            {
+                --bufferEnd;
+                *--out = std::move(*bufferEnd);
+            }
+        }
+        MoveBackward(bufferBegin, bufferEnd, out);
+    }
+    buffer.Clear();
+}
+
+/**
+ * @brief Natural merge sort: reverse the strictly descending runs, then merge neighbouring runs pairwise until one
+ * is left. O(n log r) for r runs, stable.
+ */
+template <typename TIterator, typename TCompare> void RunMergeSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    using ValueAlias = typename std::iterator_traits<TIterator>::value_type;
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size < 2)
+    {
+        return;
+    }
+
+    std::size_t capacity = 16;
+    std::size_t count = 0;
+    auto bounds = std::make_unique<std::size_t[]>(capacity);
+    bounds[count++] = 0;
+    for (TIterator runBegin = first; runBegin != last;)
+    {
+        runBegin = ExtendRunRange(runBegin, last, comp, true);
+        if (count == capacity)
+        {
+            auto grown = std::make_unique<std::size_t[]>(capacity * 2);
+            std::copy(bounds.get(), bounds.get() + count, grown.get());
+            bounds = std::move(grown);
+            capacity *= 2;
+        }
+        bounds[count++] = static_cast<std::size_t>(runBegin - first);
+    }
+    if (count == 2)
+    {
+        return;
+    }
+
+    TemporaryBuffer<ValueAlias> buffer(size / 2 + 1);
+    while (count > 2)
+    {
+        std::size_t kept = 0;
+        std::size_t i = 0;
+        for (; i + 2 < count; i += 2)
+        {
+            MergeAdjacentRange(first + bounds[i], first + bounds[i + 1], first + bounds[i + 2], comp, buffer);
+            bounds[kept++] = bounds[i];
+        }
+        for (; i < count; ++i)
+        {
+            bounds[kept++] = bounds[i];
+        }
+        count = kept;
+    }
+}
+
+/**
+ * @brief Ascending LSD radix sort of integral keys, one byte per pass. Passes whose byte is the same in every key
+ * are skipped, so narrow key ranges cost few passes.
+ */
+template <typename TIterator> void RadixSortRange(TIterator first, TIterator last)
+{
+    using ValueAlias = typename std::iterator_traits<TIterator>::value_type;
+    using UnsignedAlias = std::make_unsigned_t<ValueAlias>;
+    static_assert(std::is_integral_v<ValueAlias>, "RadixSortRange sorts integral keys");
+
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size < 2)
+    {
+        return;
+    }
+
+    // Flipping the sign bit orders signed keys as unsigned ones.
+    constexpr UnsignedAlias flip = std::is_signed_v<ValueAlias> ? UnsignedAlias(1) << (8 * sizeof(ValueAlias) - 1) : 0;
+    auto keys = std::make_unique<UnsignedAlias[]>(size);
+    auto scratch = std::make_unique<UnsignedAlias[]>(size);
+    std::size_t index = 0;
+    for (TIterator it = first; it != last; ++it)
+    {
+        keys[index++] = static_cast<UnsignedAlias>(*it) ^ flip;
+    }
+
+    std::size_t counts[sizeof(ValueAlias)][256] = {};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        for (std::size_t pass = 0; pass < sizeof(ValueAlias); ++pass)
+        {
+            ++counts[pass][(keys[i] >> (8 * pass)) & 0xFF];
+        }
+    }
+
+    UnsignedAlias *from = keys.get();
+    UnsignedAlias *to = scratch.get();
+    for (std::size_t pass = 0; pass < sizeof(ValueAlias); ++pass)
+    {
+        std::size_t *count = counts[pass];
+        if (count[(from[0] >> (8 * pass)) & 0xFF] == size)
+        {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < 256; ++digit)
+        {
+            const std::size_t current = count[digit];
+            count[digit] = offset;
+            offset += current;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            to[count[(from[i] >> (8 * pass)) & 0xFF]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+
+    index = 0;
+    for (TIterator it = first; it != last; ++it)
+    {
+        *it = static_cast<ValueAlias>(from[index++] ^ flip);
+    }
+}
+
+/**
+ * @brief Size, presortedness and a duplicate estimate of [first, last), at a cost of at most about n / 32
+ * comparisons on random input.
+ */
+template <typename TIterator, typename TCompare>
+SortProfile ProfileRange(TIterator first, TIterator last, TCompare comp)
+{
+    SortProfile profile;
+    profile.Size = static_cast<std::size_t>(last - first);
+    profile.RunLimit = profile.Size / 64 > 1 ? profile.Size / 64 : 1;
+    profile.Runs = CountRunsRange(first, last, comp, profile.RunLimit);
+
+    // Sort iterators to an evenly spaced sample and count the equal neighbours.
+    constexpr std::size_t maxSample = 32;
+    TIterator sample[maxSample];
+    profile.SampleSize = profile.Size < maxSample ? profile.Size : maxSample;
+    for (std::size_t i = 0; i < profile.SampleSize; ++i)
+    {
+        sample[i] = first + static_cast<std::ptrdiff_t>(i * profile.Size / profile.SampleSize);
+    }
+    InsertionSortRange(sample, sample + profile.SampleSize,
+                       [&comp](const TIterator &lhs, const TIterator &rhs) { return comp(*lhs, *rhs); });
+    for (std::size_t i = 1; i < profile.SampleSize; ++i)
+    {
+        if (!comp(*sample[i - 1], *sample[i]))
+        {
+            ++profile.SampleDuplicates;
+        }
+    }
+    return profile;
+}
+
+/**
+ * @brief The strategy AdaptiveSortRange uses for a profiled input: insertion sort when tiny, run merging when
+ * presorted, radix sort for integral keys and introsort otherwise.
+ */
+template <typename T, typename TCompare> SortStrategy ChooseSortStrategy(const SortProfile &profile)
+{
+    if (profile.Size <= InsertionSortThreshold<T>)
+    {
+        return SortStrategy::Insertion;
+    }
+    if (profile.Runs <= profile.RunLimit)
+    {
+        return SortStrategy::RunMerge;
+    }
+    if constexpr (IsRadixSortable<T, TCompare>)
+    {
+        if (profile.Size >= RadixSortThreshold)
+        {
+            return SortStrategy::Radix;
+        }
+    }
+    return SortStrategy::IntroSort;
+}
+
+/**
+ * @brief Sort [first, last) with the strategy ChooseSortStrategy picks for it. Not stable.
+ *
+ * @param userCompare The caller's comparator, whose type decides whether radix sort applies.
+ * @param comp The comparator to sort with: userCompare itself, or userCompare wrapped for instrumentation.
+ * @return The strategy used.
+ */
+template <typename TIterator, typename TUserCompare, typename TCompare>
+SortStrategy AdaptiveSortRange(TIterator first, TIterator last, [[maybe_unused]] TUserCompare userCompare, TCompare comp)
+{
+    using ValueAlias = typename std::iterator_traits<TIterator>::value_type;
+    const auto size = static_cast<std::size_t>(last - first);
+    if (size <= InsertionSortThreshold<ValueAlias>)
+    {
+        InsertionSortRange(first, last, comp);
+        return SortStrategy::Insertion;
+    }
+
+    const SortProfile profile = ProfileRange(first, last, comp);
+    const SortStrategy strategy = ChooseSortStrategy<ValueAlias, TUserCompare>(profile);
+    switch (strategy)
+    {
+    case SortStrategy::RunMerge:
+        RunMergeSortRange(first, last, comp);
+        break;
+    case SortStrategy::Radix:
+        if constexpr (IsRadixSortable<ValueAlias, TUserCompare>)
+        {
+            RadixSortRange(first, last);
+            if constexpr (IsDescendingCompare<ValueAlias, TUserCompare>)
+            {
+                std::reverse(first, last);
+            }
+        }
+        break;
+    default:
+        // Half the sample repeating means few distinct keys, which three-way partitioning sorts in O(n log k).
+        IntroSortRange(first, last, comp, 2 * profile.SampleDuplicates >= profile.SampleSize);
+        break;
+    }
+    return strategy;
+}
+
+template <typename TIterator, typename TCompare>
+SortStrategy AdaptiveSortRange(TIterator first, TIterator last, TCompare comp)
+{
+    return AdaptiveSortRange(first, last, comp, comp);
+}
+
+/**
+ * @brief The AdaptiveSort of the linked lists. Tiny lists are insertion sorted in place and sorted ones are left
+ * alone; otherwise the values are moved into a contiguous buffer, sorted there by AdaptiveSortRange and moved back,
+ * which beats walking nodes for every strategy. Types that may throw on move are merge sorted by relinking. Not stable.
+ *
+ * @param list A list with GetSize, GetBegin, GetEnd, InsertionSort and Sort.
+ * @param userCompare The caller's comparator, whose type decides whether radix sort applies.
+ * @param comp The comparator to sort with: userCompare itself, or userCompare wrapped for instrumentation.
+ * @return The strategy used.
+ */
+template <typename TList, typename TUserCompare, typename TCompare>
+SortStrategy AdaptiveSortList(TList &list, TUserCompare userCompare, TCompare comp)
+{
+    using ValueAlias = typename TList::ValueTypeAlias;
+    const std::size_t size = list.GetSize();
+    if (size <= InsertionSortThreshold<ValueAlias>)
+    {
+        list.InsertionSort(comp);
+        return SortStrategy::Insertion;
+    }
+
+    auto previous = list.GetBegin();
+    auto current = previous;
+    for (++current; current != list.GetEnd() && !comp(*current, *previous); ++current)
+    {
+        previous = current;
+    }
+    if (current == list.GetEnd())
+    {
+        return SortStrategy::AlreadySorted;
+    }
+
+    if constexpr (std::is_nothrow_move_constructible_v<ValueAlias> && std::is_nothrow_move_assignable_v<ValueAlias>)
+    {
+        TemporaryBuffer<ValueAlias> buffer(size);
+        ValueAlias *end = buffer.MoveIn(list.GetBegin(), list.GetEnd());
+        const SortStrategy strategy = AdaptiveSortRange(buffer.GetData(), end, userCompare, comp);
+        Move(buffer.GetData(), end, list.GetBegin());
+        return strategy;
+    }
+    else
+    {
+        list.Sort(comp);
+        return SortStrategy::MergeSort;
+    }
+}
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_SORT_HPP
@@ -0,0 +1,443 @@
+#ifndef DSA_LIBRARIES_UTILITIES_TRACING_ALLOCATOR_HPP
+#define DSA_LIBRARIES_UTILITIES_TRACING_ALLOCATOR_HPP
+#include "Allocator.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <utility>
+namespace DSALibraries::Utilities
+{
+/** Default tag of TracingAllocator. */
+struct TracingAllocatorTag
+{
+};
+
+/**
+ * @brief Aggregated trace of one tag: log2 histograms of request sizes (bytes) and lifetimes (nanoseconds), and
+ * per call-site totals.
+ */
+struct AllocationTraceSnapshot
+{
+    static constexpr std::size_t BucketCount = 64;
+    static constexpr std::size_t MaxSites = 32;
+
+    struct SiteRecord
+    {
+        const char *Site = nullptr;
+        std::uint64_t Allocations = 0;
+        std::uint64_t Bytes = 0;
+    };
+
+    std::uint64_t Allocations = 0;
+    std::uint64_t Deallocations = 0;
+    std::uint64_t Bytes = 0;
+    /**
+     * SizeHistogram[b] counts requests with std::bit_width(bytes) == b, i.e. in [2^(b-1), 2^b). The last bucket
+     * also holds every larger request.
+     */
+    std::array<std::uint64_t, BucketCount> SizeHistogram{};
+    /** LifetimeHistogram[b] counts blocks freed after std::bit_width(nanoseconds) == b. */
+    std::array<std::uint64_t, BucketCount> LifetimeHistogram{};
+    std::array<SiteRecord, MaxSites> Sites{};
+    std::size_t SiteCount = 0;
+};
+
+/**
+ * @brief Process-wide trace of every TracingAllocator with the given tag.
+ *
+ * Each thread records into its own buffer. Only the owning thread writes a buffer, so recording is a few relaxed
+ * loads and stores with no read-modify-write and no lock; readers merge all buffers. Buffers are linked into a
+ * lock-free list and recycled when their thread exits, so a thread pool that churns threads does not grow the list.
+ */
+template <typename Tag> class AllocationTrace
+{
+  public:
+    static constexpr std::size_t BucketCount = AllocationTraceSnapshot::BucketCount;
+    static constexpr std::size_t MaxSites = AllocationTraceSnapshot::MaxSites;
+
+    /** Name reported for allocations made without a call-site tag. */
+    static constexpr const char *UntaggedSite = "(untagged)";
+
+    /** Name of the last site slot, which collects the sites that did not fit. */
+    static constexpr const char *OverflowSite = "(other)";
+
+  private:
+    struct SiteSlot
+    {
+        std::atomic<const char *> Site{nullptr};
+        std::atomic<std::uint64_t> Allocations{0};
+        std::atomic<std::uint64_t> Bytes{0};
+    };
+
+    struct alignas(64) ThreadBuffer
+    {
+        std::atomic<std::uint64_t> Allocations{0};
+        std::atomic<std::uint64_t> Deallocations{0};
+        std::atomic<std::uint64_t> Bytes{0};
+        std::array<std::atomic<std::uint64_t>, BucketCount> SizeHistogram{};
+        std::array<std::atomic<std::uint64_t>, BucketCount> LifetimeHistogram{};
+        std::array<SiteSlot, MaxSites> Sites{};
+        std::atomic<bool> IsInUse{true};
+        ThreadBuffer *Next = nullptr;
+    };
+
+    struct BufferLease
+    {
+        ThreadBuffer *Buffer;
+
+        BufferLease() : Buffer(AcquireBufferInternal())
+        {
+        }
+
+        ~BufferLease()
+        {
+            Buffer->IsInUse.store(false, std::memory_order_release);
+        }
+    };
+
+    static std::atomic<ThreadBuffer *> &GetHeadInternal() noexcept
+    {
+        static std::atomic<ThreadBuffer *> head{nullptr};
+        return head;
+    }
+
+    static ThreadBuffer *AcquireBufferInternal()
+    {
+        std::atomic<ThreadBuffer *> &head = GetHeadInternal();
+        for (ThreadBuffer *buffer = head.load(std::memory_order_acquire); buffer; buffer = buffer->Next)
+        {
+            bool expected = false;
+            if (!buffer->IsInUse.load(std::memory_order_relaxed) &&
+                buffer->IsInUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                return buffer;
+            }
+        }
+
+        // Buffers are never freed: a snapshot may be walking the list at any time.
+        auto *buffer = new ThreadBuffer();
+        buffer->Next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(buffer->Next, buffer, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        return buffer;
+    }
+
+    static ThreadBuffer &GetThreadBufferInternal()
+    {
+        static thread_local BufferLease lease;
+        return *lease.Buffer;
+    }
+
+    static void AddInternal(std::atomic<std::uint64_t> &counter, std::uint64_t value) noexcept
+    {
+        // Single writer: a plain load and store is enough and much cheaper than fetch_add.
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static std::size_t BucketInternal(std::uint64_t value) noexcept
+    {
+        // bit_width reaches 64 for values >= 2^63; fold those into the last bucket rather than wrapping to 0.
+        const auto bucket = static_cast<std::size_t>(std::bit_width(value));
+        return bucket < BucketCount ? bucket : BucketCount - 1;
+    }
+
+  public:
+    static std::uint64_t GetTimestamp() noexcept
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+    }
+
+    static void RecordAllocation(std::size_t bytes, const char *site)
+    {
+        ThreadBuffer &buffer = GetThreadBufferInternal();
+        AddInternal(buffer.Allocations, 1);
+        AddInternal(buffer.Bytes, bytes);
+        AddInternal(buffer.SizeHistogram[BucketInternal(bytes)], 1);
+
+        site = site ? site : UntaggedSite;
+        std::size_t slot = 0;
+        for (; slot + 1 < MaxSites; ++slot)
+        {
+            const char *current = buffer.Sites[slot].Site.load(std::memory_order_relaxed);
+            if (current == site)
+            {
+                break;
+            }
+            if (current == nullptr)
+            {
+                buffer.Sites[slot].Site.store(site, std::memory_order_release);
+                break;
+            }
+        }
+        if (slot + 1 == MaxSites)
+        {
+            buffer.Sites[slot].Site.store(OverflowSite, std::memory_order_release);
+        }
+        AddInternal(buffer.Sites[slot].Allocations, 1);
+        AddInternal(buffer.Sites[slot].Bytes, bytes);
+    }
+
+    static void RecordDeallocation(std::uint64_t lifetimeNanoseconds)
+    {
+        ThreadBuffer &buffer = GetThreadBufferInternal();
+        AddInternal(buffer.Deallocations, 1);
+        AddInternal(buffer.LifetimeHistogram[BucketInternal(lifetimeNanoseconds)], 1);
+    }
+
+    /**
+     * @brief Merge the buffers of all threads. Sites are matched by pointer, so tag with string literals.
+     */
+    [[nodiscard]] static AllocationTraceSnapshot GetSnapshot() noexcept
+    {
+        AllocationTraceSnapshot snapshot;
+        for (ThreadBuffer *buffer = GetHeadInternal().load(std::memory_order_acquire); buffer; buffer = buffer->Next)
+        {
+            snapshot.Allocations += buffer->Allocations.load(std::memory_order_relaxed);
+            snapshot.Deallocations += buffer->Deallocations.load(std::memory_order_relaxed);
+            snapshot.Bytes += buffer->Bytes.load(std::memory_order_relaxed);
+            for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                snapshot.SizeHistogram[bucket] += buffer->SizeHistogram[bucket].load(std::memory_order_relaxed);
+                snapshot.LifetimeHistogram[bucket] +=
+                    buffer->LifetimeHistogram[bucket].load(std::memory_order_relaxed);
+            }
+            for (std::size_t slot = 0; slot < MaxSites; ++slot)
+            {
+                const char *site = buffer->Sites[slot].Site.load(std::memory_order_acquire);
+                if (site == nullptr)
+                {
+                    break;
+                }
+                std::size_t index = 0;
+                while (index < snapshot.SiteCount && snapshot.Sites[index].Site != site)
+                {
+                    ++index;
+                }
+                if (index == snapshot.SiteCount)
+                {
+                    if (snapshot.SiteCount == MaxSites)
+                    {
+                        index = MaxSites - 1;
+                        snapshot.Sites[index].Site = OverflowSite;
+                    }
+                    else
+                    {
+                        snapshot.Sites[snapshot.SiteCount++].Site = site;
+                    }
+                }
+                snapshot.Sites[index].Allocations += buffer->Sites[slot].Allocations.load(std::memory_order_relaxed);
+                snapshot.Sites[index].Bytes += buffer->Sites[slot].Bytes.load(std::memory_order_relaxed);
+            }
+        }
+        return snapshot;
+    }
+
+    /**
+     * @brief Zero every buffer. Counts recorded concurrently with a reset may be lost.
+     */
+    static void Reset() noexcept
+    {
+        for (ThreadBuffer *buffer = GetHeadInternal().load(std::memory_order_acquire); buffer; buffer = buffer->Next)
+        {
+            buffer->Allocations.store(0, std::memory_order_relaxed);
+            buffer->Deallocations.store(0, std::memory_order_relaxed);
+            buffer->Bytes.store(0, std::memory_order_relaxed);
+            for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                buffer->SizeHistogram[bucket].store(0, std::memory_order_relaxed);
+                buffer->LifetimeHistogram[bucket].store(0, std::memory_order_relaxed);
+            }
+            for (std::size_t slot = 0; slot < MaxSites; ++slot)
+            {
+                buffer->Sites[slot].Allocations.store(0, std::memory_order_relaxed);
+                buffer->Sites[slot].Bytes.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static void WriteJson(std::ostream &stream)
+    {
+        const AllocationTraceSnapshot snapshot = GetSnapshot();
+        auto writeHistogram = [&stream](const std::array<std::uint64_t, BucketCount> &histogram) {
+            stream << '[';
+            for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                stream << (bucket ? "," : "") << histogram[bucket];
+            }
+            stream << ']';
+        };
+
+        stream << "{\"allocations\":" << snapshot.Allocations << ",\"deallocations\":" << snapshot.Deallocations
+               << ",\"bytes\":" << snapshot.Bytes << ",\"size_log2_histogram\":";
+        writeHistogram(snapshot.SizeHistogram);
+        stream << ",\"lifetime_ns_log2_histogram\":";
+        writeHistogram(snapshot.LifetimeHistogram);
+        stream << ",\"sites\":[";
+        for (std::size_t index = 0; index < snapshot.SiteCount; ++index)
+        {
+            stream << (index ? "," : "") << "{\"site\":\"";
+            for (const char *c = snapshot.Sites[index].Site; *c; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                {
+                    stream << '\\';
+                }
+                stream << *c;
+            }
+            stream << "\",\"allocations\":" << snapshot.Sites[index].Allocations
+                   << ",\"bytes\":" << snapshot.Sites[index].Bytes << '}';
+        }
+        stream << "]}";
+    }
+
+    /**
+     * @brief One row per non-empty bucket or site: kind,key,count,bytes.
+     */
+    static void WriteCsv(std::ostream &stream)
+    {
+        const AllocationTraceSnapshot snapshot = GetSnapshot();
+        stream << "kind,key,count,bytes\n";
+        for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+        {
+            if (snapshot.SizeHistogram[bucket])
+            {
+                stream << "size_log2," << bucket << ',' << snapshot.SizeHistogram[bucket] << ",\n";
+            }
+        }
+        for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+        {
+            if (snapshot.LifetimeHistogram[bucket])
+            {
+                stream << "lifetime_ns_log2," << bucket << ',' << snapshot.LifetimeHistogram[bucket] << ",\n";
+            }
+        }
+        for (std::size_t index = 0; index < snapshot.SiteCount; ++index)
+        {
+            stream << "site,\"" << snapshot.Sites[index].Site << "\"," << snapshot.Sites[index].Allocations << ','
+                   << snapshot.Sites[index].Bytes << '\n';
+        }
+    }
+};
+
+/**
+ * @brief Allocator that forwards to Upstream and records every request in AllocationTrace<Tag>.
+ *
+ * Each block carries a small header holding its allocation time, so that deallocate can record the lifetime. The
+ * call site is not stored per block: it is the string the allocator was constructed with, which survives rebinding,
+ * so the nodes of a list are attributed to the site of the list's allocator.
+ */
+template <typename T, typename Upstream = Allocator<T>, typename Tag = TracingAllocatorTag> class TracingAllocator
+{
+  private:
+    using ByteAllocatorAlias = typename std::allocator_traits<Upstream>::template rebind_alloc<unsigned char>;
+    using ByteTraitsAlias = std::allocator_traits<ByteAllocatorAlias>;
+
+    struct Header
+    {
+        std::uint64_t Timestamp;
+    };
+
+    // The upstream block is aligned for operator new, so a header of that size keeps the payload aligned for T.
+    static constexpr std::size_t HeaderSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    static_assert(sizeof(Header) <= HeaderSize);
+    static_assert(alignof(T) <= HeaderSize, "TracingAllocator does not support over-aligned types");
+
+    ByteAllocatorAlias _upstream;
+    const char *_site = nullptr;
+
+    template <typename, typename, typename> friend class TracingAllocator;
+
+  public:
+    using value_type = T;
+    using TagTypeAlias = Tag;
+    using TraceAlias = AllocationTrace<Tag>;
+
+    template <typename U> struct rebind
+    {
+        typedef TracingAllocator<U, typename std::allocator_traits<Upstream>::template rebind_alloc<U>, Tag> other;
+    };
+
+    TracingAllocator() = default;
+
+    explicit TracingAllocator(const char *site, const Upstream &upstream = Upstream())
+        : _upstream(upstream), _site(site)
+    {
+    }
+
+    template <typename U, typename UUpstream>
+    TracingAllocator(const TracingAllocator<U, UUpstream, Tag> &other) noexcept
+        : _upstream(other._upstream), _site(other._site)
+    {
+    }
+
+    [[nodiscard]] const char *GetSite() const noexcept
+    {
+        return _site;
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n, [[maybe_unused]] const void *hint = static_cast<const void *>(nullptr))
+    {
+        const std::size_t bytes = n * sizeof(T);
+        unsigned char *block = ByteTraitsAlias::allocate(_upstream, HeaderSize + bytes);
+        ::new (static_cast<void *>(block)) Header{TraceAlias::GetTimestamp()};
+        TraceAlias::RecordAllocation(bytes, _site);
+        return reinterpret_cast<T *>(block + HeaderSize);
+    }
+
+    void deallocate(T *pointer, std::size_t n) noexcept
+    {
+        unsigned char *block = reinterpret_cast<unsigned char *>(pointer) - HeaderSize;
+        const auto *header = std::launder(reinterpret_cast<Header *>(block));
+        const std::uint64_t now = TraceAlias::GetTimestamp();
+        TraceAlias::RecordDeallocation(now > header->Timestamp ? now - header->Timestamp : 0);
+        ByteTraitsAlias::deallocate(_upstream, block, HeaderSize + n * sizeof(T));
+    }
+
+    template <typename U, typename... Args> void construct(U *p, Args &&...args)
+    {
+        ::new ((void *)p) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U> void destroy(U *p)
+    {
+        p->~U();
+    }
+
+    [[nodiscard]] std::size_t max_size() const noexcept
+    {
+        return (ByteTraitsAlias::max_size(_upstream) - HeaderSize) / sizeof(T);
+    }
+
+    TracingAllocator select_on_container_copy_construction() const noexcept
+    {
+        return *this;
+    }
+
+    using is_always_equal = typename ByteTraitsAlias::is_always_equal;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U, typename UUpstream>
+    friend bool operator==(const TracingAllocator &lhs, const TracingAllocator<U, UUpstream, Tag> &rhs) noexcept
+    {
+        return lhs._upstream == rhs._upstream;
+    }
+
+    template <typename U, typename UUpstream>
+    friend bool operator!=(const TracingAllocator &lhs, const TracingAllocator<U, UUpstream, Tag> &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+} // namespace DSALibraries::Utilities
+#endif // DSA_LIBRARIES_UTILITIES_TRACING_ALLOCATOR_HPP
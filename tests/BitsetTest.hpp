@@ -0,0 +1,145 @@
+#ifndef DSA_LIBRARIES_BITSET_TEST_HPP
+#define DSA_LIBRARIES_BITSET_TEST_HPP
+
+#include "../include/Containers/Bitset/Bitset.hpp"
+#include "../include/Containers/Bitset/DynamicBitset.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+namespace DSALibraries::Test
+{
+class BitsetTest : public ::testing::Test
+{
+  protected:
+    Containers::Bitset<200> Bitset_0;
+    Containers::DynamicBitset<> DynamicBitset_0{1000};
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < 200; i += 3)
+        {
+            Bitset_0.Set(i);
+        }
+        for (std::size_t i = 0; i < 1000; i += 7)
+        {
+            DynamicBitset_0.Set(i);
+        }
+    }
+};
+
+TEST_F(BitsetTest, count_and_find)
+{
+    EXPECT_EQ(Bitset_0.Count(), 67);
+    EXPECT_EQ(Bitset_0.FindFirst(), 0);
+    EXPECT_EQ(Bitset_0.FindNext(0), 3);
+    EXPECT_EQ(Bitset_0.FindNext(197), 198);
+    EXPECT_EQ(Bitset_0.FindNext(198), Bitset_0.NotFound);
+    EXPECT_TRUE(Bitset_0.Test(198));
+    EXPECT_FALSE(Bitset_0.Test(199));
+    EXPECT_THROW(static_cast<void>(Bitset_0.Test(200)), Containers::BitsetOutOfBoundsException);
+
+    std::size_t visited = 0;
+    for (auto i = Bitset_0.FindFirst(); i != Bitset_0.NotFound; i = Bitset_0.FindNext(i))
+    {
+        EXPECT_EQ(i % 3, 0);
+        ++visited;
+    }
+    EXPECT_EQ(visited, Bitset_0.Count());
+}
+
+TEST_F(BitsetTest, flip_keeps_tail_clear)
+{
+    Containers::Bitset<70> bits;
+    bits.Flip();
+    EXPECT_TRUE(bits.All());
+    EXPECT_EQ(bits.Count(), 70);
+    EXPECT_EQ((~bits).Count(), 0);
+}
+
+TEST_F(BitsetTest, value_constructor_trims_past_the_width)
+{
+    const Containers::Bitset<0> empty(~std::uint64_t(0));
+    EXPECT_EQ(empty.GetData()[0], 0);
+    EXPECT_TRUE(empty.None());
+
+    const Containers::Bitset<40> narrow(~std::uint64_t(0));
+    EXPECT_EQ(narrow.GetData()[0], (std::uint64_t(1) << 40) - 1);
+    EXPECT_EQ(narrow.Count(), 40);
+    EXPECT_TRUE(narrow.All());
+
+    const Containers::Bitset<70> wide(~std::uint64_t(0));
+    EXPECT_EQ(wide.Count(), 64);
+    EXPECT_EQ(wide.GetData()[1], 0);
+}
+
+TEST_F(BitsetTest, bulk_operations)
+{
+    Containers::Bitset<200> evens;
+    for (std::size_t i = 0; i < 200; i += 2)
+    {
+        evens.Set(i);
+    }
+
+    EXPECT_EQ((Bitset_0 & evens).Count(), Bitset_0.IntersectionCount(evens));
+    EXPECT_EQ((Bitset_0 & evens).Count(), 34);
+    EXPECT_EQ((Bitset_0 | evens).Count(), 67 + 100 - 34);
+    EXPECT_EQ((Bitset_0 ^ evens).Count(), 67 + 100 - 2 * 34);
+
+    Containers::Bitset<200> odds = Bitset_0;
+    odds.AndNot(evens);
+    EXPECT_EQ(odds.Count(), 67 - 34);
+    EXPECT_EQ(odds.FindFirst(), 3);
+}
+
+TEST_F(BitsetTest, rank_and_select)
+{
+    EXPECT_EQ(Bitset_0.Rank(0), 0);
+    EXPECT_EQ(Bitset_0.Rank(7), 3);
+    EXPECT_EQ(Bitset_0.Select(2), 6);
+    EXPECT_EQ(Bitset_0.Select(67), Bitset_0.NotFound);
+
+    for (std::size_t k = 0; k < DynamicBitset_0.Count(); ++k)
+    {
+        ASSERT_EQ(DynamicBitset_0.Select(k), k * 7);
+    }
+    DynamicBitset_0.BuildRankIndex();
+    ASSERT_TRUE(DynamicBitset_0.HasRankIndex());
+    for (std::size_t position = 0; position <= 1000; ++position)
+    {
+        ASSERT_EQ(DynamicBitset_0.Rank(position), (position + 6) / 7);
+    }
+    for (std::size_t k = 0; k < DynamicBitset_0.Count(); ++k)
+    {
+        ASSERT_EQ(DynamicBitset_0.Select(k), k * 7);
+    }
+    EXPECT_EQ(DynamicBitset_0.Select(DynamicBitset_0.Count()), DynamicBitset_0.NotFound);
+
+    DynamicBitset_0.Reset(0);
+    EXPECT_FALSE(DynamicBitset_0.HasRankIndex());
+    EXPECT_EQ(DynamicBitset_0.Rank(8), 1);
+}
+
+TEST_F(BitsetTest, dynamic_resize_and_bulk_operations)
+{
+    Containers::DynamicBitset<> other(1000, true);
+    EXPECT_EQ(other.Count(), 1000);
+    EXPECT_EQ(DynamicBitset_0.IntersectionCount(other), DynamicBitset_0.Count());
+
+    other.AndNot(DynamicBitset_0);
+    EXPECT_EQ(other.Count(), 1000 - DynamicBitset_0.Count());
+    other ^= DynamicBitset_0;
+    EXPECT_TRUE(other.All());
+
+    other.Resize(1100, false);
+    EXPECT_EQ(other.Count(), 1000);
+    other.Resize(1300, true);
+    EXPECT_EQ(other.Count(), 1200);
+    other.Resize(10);
+    EXPECT_EQ(other.Count(), 10);
+    other.PushBack(true);
+    EXPECT_EQ(other.GetSize(), 11);
+    EXPECT_TRUE(other.Test(10));
+
+    Containers::DynamicBitset<> small(10);
+    EXPECT_THROW(small &= DynamicBitset_0, Containers::BitsetSizeMismatchException);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_BITSET_TEST_HPP
@@ -5,6 +5,7 @@
 #ifndef DSA_LIBRARIES_CLIST_TEST_H
 #define DSA_LIBRARIES_CLIST_TEST_H
 #include "../include/Containers/CList/CList.hpp"
+#include "../include/Utilities/CountingAllocator.hpp"
 #include <gtest/gtest.h>
 namespace DSALibraries::Test
 {
@@ -90,6 +91,21 @@ TEST_F(CListTest, insertion_sort)
     }
 }
 
+TEST_F(CListTest, insertion_sort_orders_ascending)
+{
+    CList_0.PushFront(5);
+    CList_0.PushFront(-1);
+    CList_0.DSASort(1, std::less<>());
+    const int expected[] = {-1, 0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9};
+    auto it = CList_0.GetBegin();
+    for (int value : expected)
+    {
+        ASSERT_EQ(*it, value);
+        ++it;
+    }
+    EXPECT_EQ(it, CList_0.GetEnd());
+}
+
 TEST_F(CListTest, selection_sort)
 {
     for (auto it = CList_0.GetBegin(); it != CList_0.GetEnd(); it++)
@@ -164,5 +180,84 @@ TEST_F(CListTest, merge_sort)
         it++;
     }
 }
+
+TEST_F(CListTest, compact_keeps_the_ring_closed)
+{
+    CList_0.Reverse();
+    CList_0.Compact();
+    EXPECT_EQ(CList_0.GetScatter(), 0.0);
+    CList_0.PushFront(-1);
+    int expected = -1;
+    for (auto it = CList_0.GetBegin(); it != CList_0.GetEnd(); ++it)
+    {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(expected, 10);
+}
+
+TEST_F(CListTest, bulk_inserts_link_contiguous_nodes)
+{
+    Containers::CList<int> list(std::size_t{5}, 7);
+    EXPECT_EQ(list.GetScatter(), 0.0);
+    const int values[] = {1, 2, 3};
+    list.InsertAfter(list.GetConstEnd(), values, values + 3);
+    list.InsertAfter(list.GetConstEnd(), std::size_t{2}, 0);
+    const int expected[] = {0, 0, 1, 2, 3, 7, 7, 7, 7, 7};
+    std::size_t index = 0;
+    for (auto it = list.GetBegin(); it != list.GetEnd(); ++it, ++index)
+    {
+        ASSERT_LT(index, 10u);
+        EXPECT_EQ(*it, expected[index]);
+    }
+    EXPECT_EQ(index, 10u);
+}
+
+TEST_F(CListTest, merge_all_keeps_the_ring_closed)
+{
+    Containers::CList<int> first{1, 4};
+    Containers::CList<int> second{0, 2, 5};
+    Containers::CList<int> third{3};
+    first.MergeAll(second, third);
+    EXPECT_TRUE(second.IsEmpty());
+    EXPECT_TRUE(third.IsEmpty());
+    int expected = 0;
+    for (auto it = first.GetBegin(); it != first.GetEnd(); ++it)
+    {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(expected, 6);
+}
+
+TEST_F(CListTest, reserved_nodes_are_recycled_without_allocator_calls)
+{
+    struct PoolTag
+    {
+    };
+    using CountedAlias = Utilities::Instrumentation<PoolTag>;
+    Containers::CList<int, Utilities::CountingAllocator<int, PoolTag>> queue;
+    queue.Reserve(32);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 32u);
+    const std::uint64_t reserved = CountedAlias::GetSnapshot().Allocations;
+
+    for (int round = 0; round < 50; ++round)
+    {
+        for (int i = 0; i < 32; ++i)
+        {
+            queue.PushFront(i);
+        }
+        while (!queue.IsEmpty())
+        {
+            queue.PopFront();
+        }
+    }
+    EXPECT_EQ(CountedAlias::GetSnapshot().Allocations, reserved);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 32u);
+
+    queue.SetNodeCacheLimit(8);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 8u);
+    queue.ShrinkToFit();
+    EXPECT_EQ(queue.GetCachedNodeCount(), 0u);
+    EXPECT_EQ(CountedAlias::GetSnapshot().LiveBytes, 0u);
+}
 } // namespace DSALibraries::Test
 #endif // DSA_LIBRARIES_CLIST_TEST_H
@@ -0,0 +1,147 @@
+#ifndef DSA_LIBRARIES_CACHE_TEST_HPP
+#define DSA_LIBRARIES_CACHE_TEST_HPP
+
+#include "../include/Containers/Cache/LruCache.hpp"
+#include "../include/Containers/Cache/ShardedCache.hpp"
+#include "../include/Containers/Cache/SieveCache.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+namespace DSALibraries::Test
+{
+class CacheTest : public ::testing::Test
+{
+  protected:
+    Containers::LruCache<int, std::string> LruCache_0{3};
+    Containers::SieveCache<int, std::string> SieveCache_0{3};
+};
+
+TEST_F(CacheTest, lru_evicts_least_recently_used)
+{
+    std::vector<int> evicted;
+    LruCache_0.SetEvictionCallback([&evicted](const int &key, std::string &) { evicted.push_back(key); });
+
+    EXPECT_TRUE(LruCache_0.Put(1, "one"));
+    EXPECT_TRUE(LruCache_0.Put(2, "two"));
+    EXPECT_TRUE(LruCache_0.Put(3, "three"));
+    ASSERT_NE(LruCache_0.Find(1), nullptr);
+    EXPECT_EQ(*LruCache_0.GetLeastRecent(), 2);
+
+    EXPECT_TRUE(LruCache_0.Put(4, "four"));
+    EXPECT_EQ(evicted, std::vector<int>{2});
+    EXPECT_EQ(LruCache_0.Find(2), nullptr);
+    EXPECT_FALSE(LruCache_0.Put(3, "THREE"));
+    EXPECT_EQ(*LruCache_0.Peek(3), "THREE");
+
+    EXPECT_TRUE(LruCache_0.Put(5, "five"));
+    EXPECT_EQ(evicted, (std::vector<int>{2, 1}));
+    EXPECT_EQ(LruCache_0.GetSize(), 3);
+
+    EXPECT_TRUE(LruCache_0.Erase(4));
+    EXPECT_FALSE(LruCache_0.Erase(4));
+    EXPECT_TRUE(LruCache_0.Put(6, "six"));
+    EXPECT_EQ(evicted.size(), 2);
+
+    LruCache_0.Clear();
+    EXPECT_TRUE(LruCache_0.IsEmpty());
+    EXPECT_FALSE(LruCache_0.Contains(5));
+    EXPECT_THROW((Containers::LruCache<int, int>(0)), Containers::CacheInvalidCapacityException);
+}
+
+TEST_F(CacheTest, sieve_keeps_visited_entries)
+{
+    std::vector<int> evicted;
+    SieveCache_0.SetEvictionCallback([&evicted](const int &key, std::string &) { evicted.push_back(key); });
+
+    SieveCache_0.Put(1, "one");
+    SieveCache_0.Put(2, "two");
+    SieveCache_0.Put(3, "three");
+    ASSERT_NE(SieveCache_0.Find(1), nullptr);
+
+    SieveCache_0.Put(4, "four");
+    EXPECT_EQ(evicted, std::vector<int>{2});
+    ASSERT_NE(SieveCache_0.Find(4), nullptr);
+
+    SieveCache_0.Put(5, "five");
+    EXPECT_EQ(evicted, (std::vector<int>{2, 3}));
+    SieveCache_0.Put(6, "six");
+    EXPECT_EQ(evicted, (std::vector<int>{2, 3, 5}));
+    EXPECT_TRUE(SieveCache_0.Contains(1));
+    EXPECT_TRUE(SieveCache_0.Contains(4));
+}
+
+TEST_F(CacheTest, lru_matches_reference_under_churn)
+{
+    Containers::LruCache<int, int> cache(64);
+    std::vector<int> order;
+    std::uint32_t state = 30;
+    for (int i = 0; i < 20000; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        const int key = static_cast<int>(state >> 24) % 200;
+        const auto found = std::find(order.begin(), order.end(), key);
+        if (state & 1)
+        {
+            const bool present = found != order.end();
+            ASSERT_EQ(cache.Find(key) != nullptr, present);
+            if (present)
+            {
+                order.erase(found);
+                order.insert(order.begin(), key);
+            }
+        }
+        else
+        {
+            ASSERT_EQ(cache.Put(key, i), found == order.end());
+            if (found != order.end())
+            {
+                order.erase(found);
+            }
+            else if (order.size() == 64)
+            {
+                order.pop_back();
+            }
+            order.insert(order.begin(), key);
+        }
+        ASSERT_EQ(cache.GetSize(), order.size());
+    }
+}
+
+TEST_F(CacheTest, sharded_cache_concurrent_access)
+{
+    Containers::ShardedLruCache<int, int> cache(1024, 8);
+    EXPECT_EQ(cache.GetShardCount(), 8);
+    EXPECT_EQ(cache.GetCapacity(), 1024);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < 5000; ++i)
+            {
+                const int key = (i * 7 + t) % 600;
+                int value = 0;
+                if (!cache.Find(key, value))
+                {
+                    cache.Put(key, key * 2);
+                }
+                else
+                {
+                    EXPECT_EQ(value, key * 2);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_LE(cache.GetSize(), 1024);
+    int value = 0;
+    EXPECT_TRUE(cache.Find(7, value) || !cache.Contains(7));
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_CACHE_TEST_HPP
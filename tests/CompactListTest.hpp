@@ -0,0 +1,107 @@
+#ifndef DSA_LIBRARIES_COMPACT_LIST_TEST_HPP
+#define DSA_LIBRARIES_COMPACT_LIST_TEST_HPP
+
+#include "../include/Containers/CompactList/CompactList.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+namespace DSALibraries::Test
+{
+class CompactListTest : public ::testing::Test
+{
+  protected:
+    template <typename TList> static std::vector<int> ToVector(const TList &list)
+    {
+        return std::vector<int>(list.begin(), list.end());
+    }
+};
+
+TEST_F(CompactListTest, matches_std_list_and_reuses_freed_nodes)
+{
+    static_assert(sizeof(Containers::CompactListNode<int, std::uint32_t>) == 12);
+    Containers::CompactList<int> list;
+    std::list<int> expected;
+    std::mt19937 random(7);
+    for (int step = 0; step < 20000; ++step)
+    {
+        const auto size = static_cast<int>(expected.size());
+        const int position = size == 0 ? 0 : static_cast<int>(random() % (size + 1));
+        auto it = std::next(list.begin(), position);
+        auto expectedIt = std::next(expected.begin(), position);
+        if (random() % 2 == 0 || position == size)
+        {
+            EXPECT_EQ(*list.InsertBefore(it, step), step);
+            expected.insert(expectedIt, step);
+        }
+        else
+        {
+            list.Erase(it);
+            expected.erase(expectedIt);
+        }
+    }
+    ASSERT_EQ(list.GetSize(), expected.size());
+    EXPECT_EQ(ToVector(list), std::vector<int>(expected.begin(), expected.end()));
+    // Erased nodes are handed out again, so the array never outgrows the peak size.
+    EXPECT_LE(list.GetNodes().GetSize(), 20001u);
+    std::vector<int> reversed;
+    for (auto it = list.GetEnd(); it != list.GetBegin();)
+    {
+        reversed.push_back(*--it);
+    }
+    EXPECT_EQ(reversed, std::vector<int>(expected.rbegin(), expected.rend()));
+}
+
+TEST_F(CompactListTest, compact_renumbers_nodes_in_traversal_order)
+{
+    Containers::CompactList<int> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.PushFront(i);
+    }
+    list.RemoveIf([](int value) { return value % 3 == 0; });
+    list.Compact();
+    const auto &nodes = list.GetNodes();
+    ASSERT_EQ(nodes.GetSize(), list.GetSize() + 1);
+    std::uint32_t index = 1;
+    for (auto it = list.GetConstBegin(); it != list.GetConstEnd(); ++it, ++index)
+    {
+        EXPECT_EQ(it.Position, index);
+        EXPECT_EQ(*nodes[index].GetData(), *it);
+    }
+    EXPECT_EQ(list.GetConstItemFront(), 98);
+    EXPECT_EQ(list.GetConstItemBack(), 1);
+    list.PushBack(-1);
+    EXPECT_EQ(list.GetItemBack(), -1);
+}
+
+TEST_F(CompactListTest, dlist_operations)
+{
+    Containers::CompactList<int, std::uint16_t> list{5, 1, 4, 2, 3};
+    list.Sort();
+    EXPECT_EQ(ToVector(list), (std::vector<int>{1, 2, 3, 4, 5}));
+    Containers::CompactList<int, std::uint16_t> other{0, 3, 6};
+    list.Merge(other);
+    EXPECT_TRUE(other.IsEmpty());
+    EXPECT_EQ(ToVector(list), (std::vector<int>{0, 1, 2, 3, 3, 4, 5, 6}));
+    list.Reverse();
+    EXPECT_EQ(ToVector(list), (std::vector<int>{6, 5, 4, 3, 3, 2, 1, 0}));
+    list.Remove(3);
+    list.EraseAfter(list.GetBegin(), std::next(list.GetBegin(), 3));
+    EXPECT_EQ(ToVector(list), (std::vector<int>{6, 2, 1, 0}));
+    list.SpliceAfter(list.GetBeginFromHead(), Containers::CompactList<int, std::uint16_t>{8, 7});
+    list.InsertAfter(std::prev(list.GetEnd()), 2, -1);
+    EXPECT_EQ(ToVector(list), (std::vector<int>{8, 7, 6, 2, 1, 0, -1, -1}));
+
+    Containers::CompactList<int, std::uint16_t> copy(list);
+    Containers::CompactList<int, std::uint16_t> moved(std::move(list));
+    EXPECT_TRUE(list.IsEmpty());
+    EXPECT_EQ(ToVector(copy), ToVector(moved));
+    moved.Clear();
+    EXPECT_THROW(moved.PopFront(), Containers::CompactListEmptyException);
+    EXPECT_EQ(moved.GetBegin(), moved.GetEnd());
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_COMPACT_LIST_TEST_HPP
@@ -0,0 +1,154 @@
+#ifndef DSA_LIBRARIES_CONCURRENT_SKIP_LIST_TEST_HPP
+#define DSA_LIBRARIES_CONCURRENT_SKIP_LIST_TEST_HPP
+
+#include "../include/Containers/SkipList/ConcurrentSkipList.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+namespace DSALibraries::Test
+{
+class ConcurrentSkipListTest : public ::testing::Test
+{
+  protected:
+    using GuardAlias = Utilities::EpochManager::Guard;
+
+    Containers::ConcurrentSkipList<int, std::string> SkipList_0;
+    void SetUp() override
+    {
+        for (int i = 9; i >= 0; --i)
+        {
+            SkipList_0.Insert(i, std::to_string(i));
+        }
+    }
+};
+
+TEST_F(ConcurrentSkipListTest, insert_keeps_keys_ordered_and_unique)
+{
+    EXPECT_FALSE(SkipList_0.Insert(5, "duplicate"));
+    EXPECT_EQ(SkipList_0.GetSize(), 10);
+
+    auto guard = SkipList_0.Pin();
+    int expected = 0;
+    for (auto it = SkipList_0.GetBegin(); it != SkipList_0.GetEnd(); ++it)
+    {
+        EXPECT_EQ(it.GetKey(), expected);
+        EXPECT_EQ(*it, std::to_string(expected));
+        ++expected;
+    }
+    EXPECT_EQ(expected, 10);
+}
+
+TEST_F(ConcurrentSkipListTest, find_and_erase)
+{
+    std::string value;
+    EXPECT_TRUE(SkipList_0.Find(3, value));
+    EXPECT_EQ(value, "3");
+    EXPECT_TRUE(SkipList_0.Erase(3));
+    EXPECT_FALSE(SkipList_0.Erase(3));
+    EXPECT_FALSE(SkipList_0.Contains(3));
+    EXPECT_FALSE(SkipList_0.Find(42, value));
+    EXPECT_EQ(SkipList_0.GetSize(), 9);
+
+    EXPECT_TRUE(SkipList_0.Insert(3, "three"));
+    EXPECT_TRUE(SkipList_0.Find(3, value));
+    EXPECT_EQ(value, "three");
+}
+
+TEST_F(ConcurrentSkipListTest, pin_throws_when_every_slot_is_taken)
+{
+    std::vector<GuardAlias> guards;
+    for (std::size_t i = 0; i < Utilities::EpochManager::MaxParticipants; ++i)
+    {
+        guards.push_back(SkipList_0.Pin());
+    }
+    EXPECT_THROW(static_cast<void>(SkipList_0.Pin()), Utilities::EpochParticipantsExhaustedException);
+
+    guards.pop_back();
+    auto guard = SkipList_0.Pin();
+    EXPECT_EQ(SkipList_0.GetBegin().GetKey(), 0);
+}
+
+TEST(ConcurrentSkipListStressTest, concurrent_insert_and_erase)
+{
+    Containers::ConcurrentSkipList<int, int> skipList;
+    constexpr int threadCount = 4;
+    constexpr int perThread = 5000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&skipList, t] {
+            for (int i = t; i < threadCount * perThread; i += threadCount)
+            {
+                skipList.Insert(i, i * 2);
+            }
+            for (int i = t; i < threadCount * perThread; i += threadCount)
+            {
+                if (i % 2 == 0)
+                {
+                    skipList.Erase(i);
+                }
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_EQ(skipList.GetSize(), threadCount * perThread / 2);
+    auto guard = skipList.Pin();
+    int expected = 1;
+    for (auto it = skipList.GetBegin(); it != skipList.GetEnd(); ++it)
+    {
+        EXPECT_EQ(it.GetKey(), expected);
+        EXPECT_EQ(*it, expected * 2);
+        expected += 2;
+    }
+    EXPECT_EQ(expected, threadCount * perThread + 1);
+}
+
+TEST(ConcurrentSkipListStressTest, contended_keys_stay_consistent)
+{
+    Containers::ConcurrentSkipList<int, int> skipList;
+    constexpr int threadCount = 4;
+    constexpr int keyRange = 64;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&skipList, t] {
+            for (int round = 0; round < 20000; ++round)
+            {
+                const int key = (round * 7 + t) % keyRange;
+                if ((round + t) % 3 == 0)
+                {
+                    skipList.Erase(key);
+                }
+                else
+                {
+                    skipList.Insert(key, key);
+                }
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    auto guard = skipList.Pin();
+    std::size_t count = 0;
+    int previous = -1;
+    for (auto it = skipList.GetBegin(); it != skipList.GetEnd(); ++it)
+    {
+        EXPECT_LT(previous, it.GetKey());
+        EXPECT_EQ(*it, it.GetKey());
+        previous = it.GetKey();
+        ++count;
+    }
+    EXPECT_EQ(count, skipList.GetSize());
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_CONCURRENT_SKIP_LIST_TEST_HPP
@@ -0,0 +1,128 @@
+#ifndef DSA_LIBRARIES_CSR_GRAPH_TEST_HPP
+#define DSA_LIBRARIES_CSR_GRAPH_TEST_HPP
+
+#include "../include/Containers/Graph/CsrGraph.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <queue>
+#include <random>
+#include <vector>
+namespace DSALibraries::Test
+{
+class CsrGraphTest : public ::testing::Test
+{
+  protected:
+    using GraphAlias = Containers::CsrGraph<>;
+
+    Containers::Vector<Containers::GraphEdge<>> Edges_0{{0, 1, 7}, {0, 2, 9}, {0, 5, 14}, {1, 2, 10}, {1, 3, 15},
+                                            {2, 3, 11}, {2, 5, 2},  {3, 4, 6},  {5, 4, 9}};
+    GraphAlias Graph_0{6, Edges_0};
+
+    static std::vector<std::uint32_t> ReferenceDistances(const GraphAlias &graph, std::uint32_t source)
+    {
+        std::vector<std::uint32_t> distances(graph.GetVertexCount(), GraphAlias::Unreached);
+        std::queue<std::uint32_t> queue;
+        distances[source] = 0;
+        queue.push(source);
+        while (!queue.empty())
+        {
+            const auto vertex = queue.front();
+            queue.pop();
+            for (auto it = graph.GetNeighborBegin(vertex); it != graph.GetNeighborEnd(vertex); ++it)
+            {
+                if (distances[*it] == GraphAlias::Unreached)
+                {
+                    distances[*it] = distances[vertex] + 1;
+                    queue.push(*it);
+                }
+            }
+        }
+        return distances;
+    }
+
+    static void ExpectSameDistances(const Containers::Vector<std::uint32_t> &actual, const std::vector<std::uint32_t> &expected)
+    {
+        ASSERT_EQ(actual.GetSize(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(actual[i], expected[i]) << "vertex " << i;
+        }
+    }
+};
+
+TEST_F(CsrGraphTest, build_from_edges)
+{
+    EXPECT_EQ(Graph_0.GetVertexCount(), 6);
+    EXPECT_EQ(Graph_0.GetEdgeCount(), 9);
+    EXPECT_EQ(Graph_0.GetDegree(0), 3);
+    EXPECT_EQ(Graph_0.GetDegree(4), 0);
+    EXPECT_EQ(*Graph_0.GetNeighborBegin(2), 3);
+    EXPECT_EQ(*Graph_0.GetWeightBegin(2), 11);
+    EXPECT_THROW(static_cast<void>(Graph_0.GetDegree(6)), Containers::GraphVertexOutOfBoundsException);
+
+    Containers::Vector<Containers::GraphEdge<>> badEdges{{0, 6}};
+    EXPECT_THROW(GraphAlias(6, badEdges), Containers::GraphVertexOutOfBoundsException);
+
+    GraphAlias undirected(6, Edges_0, false);
+    EXPECT_EQ(undirected.GetEdgeCount(), 18);
+    EXPECT_EQ(undirected.GetDegree(4), 2);
+}
+
+TEST_F(CsrGraphTest, traversals)
+{
+    const auto hops = Graph_0.BreadthFirstDistances(0);
+    ExpectSameDistances(hops, {0, 1, 1, 2, 2, 1});
+    ExpectSameDistances(Graph_0.ParallelBreadthFirstDistances(0, 3), {0, 1, 1, 2, 2, 1});
+    ExpectSameDistances(Graph_0.BreadthFirstDistances(3), {GraphAlias::Unreached, GraphAlias::Unreached,
+                                                          GraphAlias::Unreached, 0, 1, GraphAlias::Unreached});
+
+    const auto order = Graph_0.DepthFirstOrder(0);
+    ExpectSameDistances(order, {0, 1, 2, 3, 4, 5});
+
+    const auto distances = Graph_0.DijkstraDistances(0);
+    ExpectSameDistances(distances, {0, 7, 9, 20, 20, 11});
+    EXPECT_EQ(Graph_0.DijkstraDistances(4)[0], GraphAlias::Infinity);
+
+    Containers::Vector<Containers::GraphEdge<int>> negativeEdges{{0, 1, 2}, {1, 2, -1}};
+    Containers::CsrGraph<int> negative(3, negativeEdges);
+    EXPECT_THROW(static_cast<void>(negative.DijkstraDistances(0)), Containers::GraphNegativeWeightException);
+
+    // Paths whose length would pass the integer Infinity stay unreached instead of wrapping around.
+    Containers::Vector<Containers::GraphEdge<>> longEdges{{0, 1, GraphAlias::Infinity - 5}, {1, 2, 10}, {1, 3, 4}};
+    ExpectSameDistances(GraphAlias(4, longEdges).DijkstraDistances(0),
+                        {0, GraphAlias::Infinity - 5, GraphAlias::Infinity, GraphAlias::Infinity - 1});
+}
+
+TEST_F(CsrGraphTest, breadth_first_matches_reference)
+{
+    constexpr std::uint32_t vertexCount = 20000;
+    std::mt19937 random(29);
+    std::uniform_int_distribution<std::uint32_t> pick(0, vertexCount - 1);
+
+    // Dense random part switches the search to bottom-up, the long path back to top-down.
+    Containers::Vector<Containers::GraphEdge<>> edges;
+    for (int i = 0; i < 80000; ++i)
+    {
+        edges.PushBack({pick(random) % (vertexCount / 2), pick(random) % (vertexCount / 2)});
+    }
+    for (std::uint32_t vertex = vertexCount / 2; vertex + 1 < vertexCount; ++vertex)
+    {
+        edges.PushBack({vertex, vertex + 1});
+    }
+    edges.PushBack({0, vertexCount / 2});
+
+    for (bool isDirected : {true, false})
+    {
+        GraphAlias graph(vertexCount, edges, isDirected);
+        const auto expected = ReferenceDistances(graph, 0);
+        ExpectSameDistances(graph.BreadthFirstDistances(0), expected);
+        ExpectSameDistances(graph.ParallelBreadthFirstDistances(0, 4), expected);
+        EXPECT_EQ(graph.DepthFirstOrder(0).GetSize(),
+                  static_cast<std::size_t>(std::count_if(expected.begin(), expected.end(), [](std::uint32_t d) {
+                      return d != GraphAlias::Unreached;
+                  })));
+    }
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_CSR_GRAPH_TEST_HPP
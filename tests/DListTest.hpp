@@ -2,8 +2,11 @@
 #define DSA_LIBRARIES_DLIST_TEST_HPP
 
 #include "../../include/Containers/DList/DList.hpp"
+#include "../../include/Utilities/CountingAllocator.hpp"
 #include "DList/DListIterator.hpp"
 #include <gtest/gtest.h>
+#include <string>
+#include <utility>
 namespace DSALibraries::Test
 {
 class DListTest : public ::testing::Test
@@ -130,6 +133,21 @@ TEST_F(DListTest, insertion_sort)
     }
 }
 
+TEST_F(DListTest, insertion_sort_orders_ascending)
+{
+    DList_0.PushFront(5);
+    DList_0.PushFront(-1);
+    DList_0.DSASort(1, std::less<>());
+    const int expected[] = {-1, 0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9};
+    auto it = DList_0.GetBegin();
+    for (int value : expected)
+    {
+        ASSERT_EQ(*it, value);
+        ++it;
+    }
+    EXPECT_EQ(it, DList_0.GetEnd());
+}
+
 TEST_F(DListTest, selection_sort)
 {
     for (auto it = DList_0.GetBegin(); it != DList_0.GetEnd(); it++)
@@ -204,5 +222,208 @@ TEST_F(DListTest, merge_sort)
         it++;
     }
 }
+
+TEST_F(DListTest, compact_keeps_order_and_both_links)
+{
+    Containers::DList<std::string> list;
+    for (int i = 0; i < 64; ++i)
+    {
+        list.PushFront(std::to_string(i));
+        Containers::DList<std::string> gap(3, std::string(40, 'x'));
+    }
+    list.Reverse();
+    EXPECT_GT(list.GetScatter(), 0.0);
+    list.Compact();
+    EXPECT_EQ(list.GetScatter(), 0.0);
+    ASSERT_EQ(list.GetSize(), 64u);
+    int expected = 0;
+    for (const std::string& value : list)
+    {
+        EXPECT_EQ(value, std::to_string(expected++));
+    }
+    list.EraseAfter(list.GetConstBegin());
+    list.PushFront("front");
+    EXPECT_EQ(list.GetItemFront(), "front");
+    EXPECT_EQ(*std::next(list.GetBegin(), 2), "2");
+}
+
+TEST_F(DListTest, queue_operations_at_the_back_stay_consistent)
+{
+    auto expectLinks = [](Containers::DList<int>& list) {
+        const Containers::DListNodeBase* previous = list.GetBeginFromHead().NodeBase;
+        for (auto it = list.GetBegin(); it != list.GetEnd(); ++it)
+        {
+            EXPECT_EQ(it.NodeBase->PointerPrev, previous);
+            previous = it.NodeBase;
+        }
+        EXPECT_EQ(previous, list.GetBeforeEnd().NodeBase);
+    };
+    Containers::DList<int> queue;
+    for (int i = 0; i < 6; ++i)
+    {
+        queue.PushBack(i);
+        queue.EmplaceBack(10 + i);
+    }
+    queue.PopBack();
+    queue.PopFront();
+    EXPECT_EQ(queue.GetItemFront(), 10);
+    EXPECT_EQ(queue.GetItemBack(), 5);
+    expectLinks(queue);
+
+    queue.Reverse();
+    expectLinks(queue);
+    queue.Sort();
+    expectLinks(queue);
+    EXPECT_EQ(queue.GetItemBack(), 14);
+
+    DList_0.Sort();
+    queue.Merge(DList_0);
+    expectLinks(queue);
+    expectLinks(DList_0);
+    EXPECT_TRUE(DList_0.IsEmpty());
+    EXPECT_EQ(queue.GetItemBack(), 14);
+
+    Containers::DList<int> back{100, 101};
+    queue.SpliceBack(back);
+    expectLinks(queue);
+    expectLinks(back);
+    EXPECT_EQ(queue.GetItemBack(), 101);
+    using ConstIteratorAlias = Containers::DList<int>::ConstIteratorAlias;
+    back.SpliceAfter(back.GetConstBeginFromHead(), queue,
+                     ConstIteratorAlias(queue.GetBeforeEnd().NodeBase->PointerPrev));
+    back.SpliceAfter(back.GetConstBeginFromHead(), queue,
+                     ConstIteratorAlias(queue.GetBeforeEnd().NodeBase->PointerPrev), queue.GetConstEnd());
+    expectLinks(queue);
+    expectLinks(back);
+    EXPECT_EQ(queue.GetItemBack(), 14);
+    EXPECT_EQ(back.GetItemFront(), 100);
+    EXPECT_EQ(back.GetItemBack(), 101);
+
+    Containers::DList<int> moved(std::move(queue));
+    expectLinks(moved);
+    expectLinks(queue);
+    moved.Swap(back);
+    expectLinks(moved);
+    expectLinks(back);
+    EXPECT_EQ(back.GetItemBack(), 14);
+    while (!back.IsEmpty())
+    {
+        back.PopBack();
+    }
+    back.InsertBefore(back.GetConstEnd(), 7);
+    EXPECT_EQ(back.GetItemFront(), 7);
+    EXPECT_EQ(back.GetItemBack(), 7);
+}
+
+TEST_F(DListTest, bulk_inserts_keep_both_links_and_the_tail)
+{
+    const int values[] = {1, 2, 3, 4};
+    Containers::DList<int> list(values, values + 4);
+    EXPECT_EQ(list.GetScatter(), 0.0);
+    auto middle = list.InsertAfter(list.GetConstBegin(), std::size_t{3}, 0);
+    EXPECT_EQ(*middle, 0);
+    list.InsertAfter(list.GetConstBeforeEnd(), values, values + 2);
+    EXPECT_EQ(list.GetItemBack(), 2);
+
+    const int expected[] = {1, 0, 0, 0, 2, 3, 4, 1, 2};
+    std::size_t index = 0;
+    const Containers::DListNodeBase* previous = list.GetBeginFromHead().NodeBase;
+    for (auto it = list.GetBegin(); it != list.GetEnd(); ++it, ++index)
+    {
+        ASSERT_LT(index, 9u);
+        EXPECT_EQ(*it, expected[index]);
+        EXPECT_EQ(it.NodeBase->PointerPrev, previous);
+        previous = it.NodeBase;
+    }
+    EXPECT_EQ(index, 9u);
+    EXPECT_EQ(previous, list.GetBeforeEnd().NodeBase);
+}
+
+TEST_F(DListTest, merge_all_relinks_many_sorted_lists)
+{
+    Containers::DList<int> shards[4] = {{1, 5, 9}, {}, {0, 2, 2, 11}, {3, 4}};
+    Containers::DList<int> merged{2, 6};
+    merged.MergeAll(shards, 4);
+    merged.MergeAll(shards[0], merged);
+
+    const int expected[] = {0, 1, 2, 2, 2, 3, 4, 5, 6, 9, 11};
+    std::size_t index = 0;
+    const Containers::DListNodeBase* previous = merged.GetBeginFromHead().NodeBase;
+    for (auto it = merged.GetBegin(); it != merged.GetEnd(); ++it, ++index)
+    {
+        ASSERT_LT(index, 11u);
+        EXPECT_EQ(*it, expected[index]);
+        EXPECT_EQ(it.NodeBase->PointerPrev, previous);
+        previous = it.NodeBase;
+    }
+    EXPECT_EQ(index, 11u);
+    EXPECT_EQ(merged.GetItemBack(), 11);
+    for (const auto& shard : shards)
+    {
+        EXPECT_TRUE(shard.IsEmpty());
+    }
+
+    Containers::DList<int> descending{3, 1};
+    Containers::DList<int> other{4, 2, 0};
+    descending.MergeAll(std::greater<int>(), other);
+    EXPECT_EQ(descending.GetItemFront(), 4);
+    EXPECT_EQ(descending.GetItemBack(), 0);
+}
+
+TEST_F(DListTest, parallel_sort_is_stable_and_keeps_both_links)
+{
+    using Pair = std::pair<int, int>;
+    auto byKey = [](const Pair& lhs, const Pair& rhs) { return lhs.first > rhs.first; };
+    Containers::DList<Pair> list;
+    for (int i = 0; i < 30000; ++i)
+    {
+        list.PushBack({(i * 7919) % 1000, i});
+    }
+    list.ParallelSort(byKey, 3);
+    std::size_t count = 0;
+    Pair previous{1000, -1};
+    const Containers::DListNodeBase* previousNode = list.GetBeginFromHead().NodeBase;
+    for (auto it = list.GetBegin(); it != list.GetEnd(); ++it, ++count)
+    {
+        EXPECT_TRUE(previous.first > it->first || (previous.first == it->first && previous.second < it->second));
+        EXPECT_EQ(it.NodeBase->PointerPrev, previousNode);
+        previous = *it;
+        previousNode = it.NodeBase;
+    }
+    EXPECT_EQ(count, 30000u);
+    EXPECT_EQ(previousNode, list.GetBeforeEnd().NodeBase);
+}
+
+TEST_F(DListTest, reserved_nodes_are_recycled_without_allocator_calls)
+{
+    struct PoolTag
+    {
+    };
+    using CountedAlias = Utilities::Instrumentation<PoolTag>;
+    Containers::DList<int, Utilities::CountingAllocator<int, PoolTag>> queue;
+    queue.Reserve(32);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 32u);
+    const std::uint64_t reserved = CountedAlias::GetSnapshot().Allocations;
+
+    for (int round = 0; round < 50; ++round)
+    {
+        for (int i = 0; i < 32; ++i)
+        {
+            queue.PushBack(i);
+        }
+        while (!queue.IsEmpty())
+        {
+            queue.PopFront();
+        }
+    }
+    EXPECT_EQ(CountedAlias::GetSnapshot().Allocations, reserved);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 32u);
+
+    queue.SetNodeCacheLimit(8);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 8u);
+    queue.ShrinkToFit();
+    EXPECT_EQ(queue.GetCachedNodeCount(), 0u);
+    EXPECT_EQ(CountedAlias::GetSnapshot().LiveBytes, 0u);
+}
 } // namespace DSALibraries::Test
 #endif
\ No newline at end of file
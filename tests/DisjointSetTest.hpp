@@ -0,0 +1,74 @@
+#ifndef DSA_LIBRARIES_DISJOINT_SET_TEST_HPP
+#define DSA_LIBRARIES_DISJOINT_SET_TEST_HPP
+
+#include "../include/Containers/DisjointSet/ConcurrentDisjointSet.hpp"
+#include "../include/Containers/DisjointSet/DisjointSet.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <utility>
+#include <vector>
+namespace DSALibraries::Test
+{
+class DisjointSetTest : public ::testing::Test
+{
+  protected:
+    Containers::DisjointSet<> DisjointSet_0{10};
+};
+
+TEST_F(DisjointSetTest, unite_and_find)
+{
+    EXPECT_EQ(DisjointSet_0.GetSetCount(), 10);
+    EXPECT_TRUE(DisjointSet_0.Unite(0, 1));
+    EXPECT_TRUE(DisjointSet_0.Unite(2, 3));
+    EXPECT_TRUE(DisjointSet_0.Unite(1, 3));
+    EXPECT_FALSE(DisjointSet_0.Unite(0, 2));
+    EXPECT_TRUE(DisjointSet_0.IsSameSet(0, 3));
+    EXPECT_FALSE(DisjointSet_0.IsSameSet(0, 4));
+    EXPECT_EQ(DisjointSet_0.GetSetCount(), 7);
+    EXPECT_THROW(DisjointSet_0.Find(10), Containers::DisjointSetOutOfBoundsException);
+
+    const auto added = DisjointSet_0.PushBack();
+    EXPECT_EQ(added, 10);
+    EXPECT_EQ(DisjointSet_0.Find(added), added);
+    EXPECT_EQ(DisjointSet_0.GetSetCount(), 8);
+}
+
+TEST_F(DisjointSetTest, unite_many_and_flatten)
+{
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 2}, {2, 0}, {5, 6}, {7, 8}, {8, 9}, {9, 7}};
+    EXPECT_EQ(DisjointSet_0.UniteMany(edges.begin(), edges.end()), 5);
+    EXPECT_EQ(DisjointSet_0.GetSetCount(), 5);
+
+    DisjointSet_0.Flatten();
+    EXPECT_EQ(DisjointSet_0.Find(2), DisjointSet_0.Find(0));
+    EXPECT_TRUE(DisjointSet_0.IsSameSet(7, 9));
+    EXPECT_FALSE(DisjointSet_0.IsSameSet(4, 5));
+}
+
+TEST(ConcurrentDisjointSetTest, parallel_unions_build_one_chain)
+{
+    constexpr std::size_t size = 1 << 16;
+    constexpr int threadCount = 4;
+    Containers::ConcurrentDisjointSet<> disjointSet(size);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&disjointSet, t] {
+            for (std::size_t i = t; i + 1 < size; i += threadCount)
+            {
+                disjointSet.Unite(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i + 1));
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_EQ(disjointSet.GetSetCount(), 1);
+    EXPECT_TRUE(disjointSet.IsSameSet(0, size - 1));
+    EXPECT_FALSE(disjointSet.Unite(0, size - 1));
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_DISJOINT_SET_TEST_HPP
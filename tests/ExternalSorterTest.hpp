@@ -0,0 +1,129 @@
+#ifndef DSA_LIBRARIES_EXTERNAL_SORTER_TEST_HPP
+#define DSA_LIBRARIES_EXTERNAL_SORTER_TEST_HPP
+
+#include "../include/Containers/ExternalSort/ExternalSorter.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+namespace DSALibraries::Test
+{
+class ExternalSorterTest : public ::testing::Test
+{
+  protected:
+    std::filesystem::path _directory;
+
+    void SetUp() override
+    {
+        _directory = std::filesystem::temp_directory_path() /
+                     ("dsa-external-sorter-test-" + std::to_string(std::random_device()()));
+        std::filesystem::create_directories(_directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(_directory);
+    }
+
+    [[nodiscard]] bool IsDirectoryEmpty() const
+    {
+        return std::filesystem::is_empty(_directory);
+    }
+
+    static std::vector<int> MakeInput(std::size_t size)
+    {
+        std::vector<int> input(size);
+        std::mt19937 engine(7);
+        for (int &value : input)
+        {
+            value = static_cast<int>(engine() % 1000) - 500;
+        }
+        return input;
+    }
+
+    template <typename TSorter> static std::vector<int> Drain(TSorter &sorter)
+    {
+        std::vector<int> output;
+        sorter.Merge([&output](const int &value) { output.push_back(value); });
+        return output;
+    }
+};
+
+TEST_F(ExternalSorterTest, sorts_in_memory_without_runs)
+{
+    std::vector<int> input = MakeInput(100);
+    Containers::ExternalSorter<int> sorter(1024 * sizeof(int), _directory);
+    sorter.PushRange(input.begin(), input.end());
+    EXPECT_EQ(sorter.GetRunCount(), 0);
+
+    std::sort(input.begin(), input.end());
+    EXPECT_EQ(Drain(sorter), input);
+    EXPECT_EQ(sorter.GetSize(), 0);
+}
+
+TEST_F(ExternalSorterTest, merges_spilled_runs)
+{
+    std::vector<int> input = MakeInput(10000);
+    Containers::ExternalSorter<int, std::greater<>> sorter(256 * sizeof(int), _directory, std::greater<>());
+    sorter.PushRange(input.begin(), input.end());
+    EXPECT_EQ(sorter.GetSize(), 10000);
+    EXPECT_EQ(sorter.GetRunCount(), 39);
+
+    std::sort(input.begin(), input.end(), std::greater<>());
+    EXPECT_EQ(Drain(sorter), input);
+    EXPECT_EQ(sorter.GetRunCount(), 0);
+    EXPECT_TRUE(IsDirectoryEmpty());
+}
+
+TEST_F(ExternalSorterTest, merges_in_passes_beyond_fan_in)
+{
+    std::vector<int> input = MakeInput(5000);
+    Containers::ExternalSorter<int> sorter(64 * sizeof(int), _directory);
+    sorter.SetFanIn(4);
+    sorter.PushRange(input.begin(), input.end());
+    EXPECT_GT(sorter.GetRunCount(), 16);
+
+    std::sort(input.begin(), input.end());
+    EXPECT_EQ(Drain(sorter), input);
+    EXPECT_TRUE(IsDirectoryEmpty());
+}
+
+TEST_F(ExternalSorterTest, generates_runs_in_parallel)
+{
+    std::vector<int> input = MakeInput(20000);
+    Containers::ExternalSorter<int> sorter(1024 * sizeof(int), _directory, std::less<int>(), 4);
+    sorter.PushRange(input.begin(), input.end());
+    EXPECT_EQ(sorter.GetRunCount(), 78);
+
+    std::sort(input.begin(), input.end());
+    EXPECT_EQ(Drain(sorter), input);
+
+    // The sorter is reusable after a merge.
+    sorter.PushRange(input.rbegin(), input.rend());
+    EXPECT_EQ(Drain(sorter), input);
+    EXPECT_TRUE(IsDirectoryEmpty());
+}
+
+TEST_F(ExternalSorterTest, destructor_removes_runs)
+{
+    {
+        Containers::ExternalSorter<int> sorter(16 * sizeof(int), _directory, std::less<int>(), 2);
+        std::vector<int> input = MakeInput(100);
+        sorter.PushRange(input.begin(), input.end());
+        EXPECT_FALSE(IsDirectoryEmpty());
+    }
+    EXPECT_TRUE(IsDirectoryEmpty());
+}
+
+TEST_F(ExternalSorterTest, rejects_budget_below_two_records)
+{
+    EXPECT_THROW(Containers::ExternalSorter<int>(sizeof(int), _directory),
+                 Containers::ExternalSortInvalidBudgetException);
+    EXPECT_THROW(Containers::ExternalSorter<int>(4 * sizeof(int), _directory, std::less<int>(), 4),
+                 Containers::ExternalSortInvalidBudgetException);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_EXTERNAL_SORTER_TEST_HPP
@@ -0,0 +1,47 @@
+#ifndef DSA_LIBRARIES_HUGE_PAGE_ALLOCATOR_TEST_HPP
+#define DSA_LIBRARIES_HUGE_PAGE_ALLOCATOR_TEST_HPP
+
+#include "../include/Containers/Vector/Vector.hpp"
+#include "../include/Utilities/HugePageAllocator.hpp"
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+namespace DSALibraries::Test
+{
+class HugePageAllocatorTest : public ::testing::Test
+{
+};
+
+TEST_F(HugePageAllocatorTest, large_blocks_are_huge_page_aligned)
+{
+    Utilities::HugePageAllocator<double> allocator;
+    constexpr std::size_t count = 3 * Utilities::HugePageSize / sizeof(double) + 5;
+    ASSERT_TRUE(allocator.IsLarge(count));
+    double *block = allocator.allocate(count);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % Utilities::HugePageSize, 0);
+    block[0] = 1.0;
+    block[count - 1] = 2.0;
+    EXPECT_EQ(block[0] + block[count - 1], 3.0);
+    allocator.deallocate(block, count);
+
+    EXPECT_FALSE(allocator.IsLarge(16));
+    double *small = allocator.allocate(16);
+    small[15] = 4.0;
+    allocator.deallocate(small, 16);
+}
+
+TEST_F(HugePageAllocatorTest, backs_a_growing_vector)
+{
+    Containers::Vector<std::int32_t, Utilities::HugePageAllocator<std::int32_t>> values;
+    constexpr std::int32_t count = 1 << 20;
+    for (std::int32_t i = 0; i < count; ++i)
+    {
+        values.PushBack(count - i);
+    }
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.GetData()) % Utilities::HugePageSize, 0);
+    values.AdaptiveSort(std::less<std::int32_t>());
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[count - 1], count);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_HUGE_PAGE_ALLOCATOR_TEST_HPP
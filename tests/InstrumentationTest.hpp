@@ -0,0 +1,188 @@
+#ifndef DSA_LIBRARIES_INSTRUMENTATION_TEST_HPP
+#define DSA_LIBRARIES_INSTRUMENTATION_TEST_HPP
+
+#include "../include/Containers/CList/CList.hpp"
+#include "../include/Containers/DList/DList.hpp"
+#include "../include/Containers/SList/SList.hpp"
+#include "../include/Containers/Vector/Vector.hpp"
+#include "../include/Utilities/CountingAllocator.hpp"
+#include "../include/Utilities/Instrumentation.hpp"
+#include <functional>
+#include <gtest/gtest.h>
+namespace DSALibraries::Test
+{
+class InstrumentationTest : public ::testing::Test
+{
+  protected:
+    struct AllocatorTag
+    {
+    };
+
+    struct SlabTag
+    {
+    };
+
+    // A type of its own, so that no other test shares these counters.
+    struct Sample
+    {
+        long Value;
+
+        bool operator<(const Sample &other) const
+        {
+            return Value < other.Value;
+        }
+    };
+
+    using CountedVectorAlias = Containers::Vector<int, Utilities::CountingAllocator<int, AllocatorTag>>;
+    using VectorAlias = Containers::Vector<Sample>;
+    using SListAlias = Containers::SList<Sample>;
+    using DListAlias = Containers::DList<Sample>;
+    using CListAlias = Containers::CList<Sample>;
+};
+
+TEST_F(InstrumentationTest, counting_allocator_tracks_bytes)
+{
+    using CountersAlias = Utilities::Instrumentation<AllocatorTag>;
+    CountersAlias::Reset();
+    {
+        CountedVectorAlias vector;
+        for (int i = 0; i < 100; ++i)
+        {
+            vector.PushBack(i);
+        }
+        const auto snapshot = CountersAlias::GetSnapshot();
+        EXPECT_GE(snapshot.Allocations, 1);
+        EXPECT_EQ(snapshot.LiveBytes, vector.GetCapacity() * sizeof(int));
+        EXPECT_GE(snapshot.PeakBytes, snapshot.LiveBytes);
+        EXPECT_EQ(snapshot.Allocations - snapshot.Deallocations, 1);
+    }
+    const auto snapshot = CountersAlias::GetSnapshot();
+    EXPECT_EQ(snapshot.LiveBytes, 0);
+    EXPECT_EQ(snapshot.Allocations, snapshot.Deallocations);
+}
+
+TEST_F(InstrumentationTest, container_hooks)
+{
+    using VectorCountersAlias = Utilities::Instrumentation<VectorAlias>;
+    using SListCountersAlias = Utilities::Instrumentation<SListAlias>;
+    VectorCountersAlias::Reset();
+    SListCountersAlias::Reset();
+    {
+        VectorAlias vector;
+        SListAlias list;
+        for (long i = 0; i < 1000; ++i)
+        {
+            vector.PushBack(Sample{(i * 37) % 1000});
+            list.PushFront(Sample{(i * 37) % 1000});
+        }
+        vector.DSASort(4, std::less<>());
+        list.Sort(std::less<>());
+
+        const auto vectorSnapshot = VectorCountersAlias::GetSnapshot();
+        const auto listSnapshot = SListCountersAlias::GetSnapshot();
+        if constexpr (Utilities::IsInstrumentationEnabled)
+        {
+            EXPECT_GT(vectorSnapshot.Reallocations, 0);
+            EXPECT_GT(vectorSnapshot.ElementMoves, 0);
+            EXPECT_EQ(vectorSnapshot.LiveBytes, vector.GetCapacity() * sizeof(Sample));
+            EXPECT_GT(vectorSnapshot.Comparisons, 1000);
+            EXPECT_EQ(listSnapshot.Allocations, 1000);
+            EXPECT_GT(listSnapshot.NodeWalks, 1000);
+            EXPECT_GT(listSnapshot.Comparisons, 1000);
+        }
+        else
+        {
+            EXPECT_EQ(vectorSnapshot.Allocations, 0);
+            EXPECT_EQ(vectorSnapshot.Comparisons, 0);
+            EXPECT_EQ(listSnapshot.Allocations, 0);
+            EXPECT_EQ(listSnapshot.NodeWalks, 0);
+        }
+    }
+    EXPECT_EQ(VectorCountersAlias::GetSnapshot().LiveBytes, 0);
+    EXPECT_EQ(SListCountersAlias::GetSnapshot().LiveBytes, 0);
+    EXPECT_EQ(SListCountersAlias::GetSnapshot().Allocations, SListCountersAlias::GetSnapshot().Deallocations);
+}
+
+TEST_F(InstrumentationTest, list_dsa_sorts_count_comparisons_and_walks)
+{
+    using DListCountersAlias = Utilities::Instrumentation<DListAlias>;
+    using CListCountersAlias = Utilities::Instrumentation<CListAlias>;
+    for (unsigned choice : {0u, 5u})
+    {
+        DListCountersAlias::Reset();
+        CListCountersAlias::Reset();
+        {
+            DListAlias dlist;
+            CListAlias clist;
+            for (long i = 0; i < 200; ++i)
+            {
+                dlist.PushFront(Sample{(i * 37) % 200});
+                clist.PushFront(Sample{(i * 37) % 200});
+            }
+            dlist.DSASort(choice, std::less<>());
+            clist.DSASort(choice, std::less<>());
+        }
+
+        const auto dlistSnapshot = DListCountersAlias::GetSnapshot();
+        const auto clistSnapshot = CListCountersAlias::GetSnapshot();
+        if constexpr (Utilities::IsInstrumentationEnabled)
+        {
+            EXPECT_GT(dlistSnapshot.Comparisons, 200);
+            EXPECT_GT(dlistSnapshot.NodeWalks, 200);
+            EXPECT_GT(clistSnapshot.Comparisons, 200);
+            EXPECT_GT(clistSnapshot.NodeWalks, 200);
+        }
+        else
+        {
+            EXPECT_EQ(dlistSnapshot.Comparisons, 0);
+            EXPECT_EQ(clistSnapshot.NodeWalks, 0);
+        }
+    }
+}
+
+TEST_F(InstrumentationTest, bulk_built_lists_count_one_allocation_per_slab)
+{
+    using ListAlias = Containers::SList<Sample, Utilities::CountingAllocator<Sample, SlabTag>>;
+    using ListCountersAlias = Utilities::Instrumentation<ListAlias>;
+    using AllocatorCountersAlias = Utilities::Instrumentation<SlabTag>;
+    ListCountersAlias::Reset();
+    AllocatorCountersAlias::Reset();
+    {
+        ListAlias list(1000, Sample{7});
+        list.Reserve(16);
+        const auto listSnapshot = ListCountersAlias::GetSnapshot();
+        const auto allocatorSnapshot = AllocatorCountersAlias::GetSnapshot();
+        EXPECT_EQ(allocatorSnapshot.Allocations, 2);
+        if constexpr (Utilities::IsInstrumentationEnabled)
+        {
+            EXPECT_EQ(listSnapshot.Allocations, allocatorSnapshot.Allocations);
+            EXPECT_EQ(listSnapshot.AllocatedBytes, allocatorSnapshot.AllocatedBytes);
+        }
+        else
+        {
+            EXPECT_EQ(listSnapshot.Allocations, 0);
+        }
+
+        // A slab goes back to the allocator only with its last node.
+        for (int i = 0; i < 999; ++i)
+        {
+            list.PopFront();
+        }
+        EXPECT_EQ(AllocatorCountersAlias::GetSnapshot().Deallocations, 0);
+        EXPECT_EQ(ListCountersAlias::GetSnapshot().Deallocations, 0);
+        list.PopFront();
+        EXPECT_EQ(AllocatorCountersAlias::GetSnapshot().Deallocations, 1);
+        if constexpr (Utilities::IsInstrumentationEnabled)
+        {
+            EXPECT_EQ(ListCountersAlias::GetSnapshot().Deallocations, 1);
+        }
+    }
+    const auto listSnapshot = ListCountersAlias::GetSnapshot();
+    const auto allocatorSnapshot = AllocatorCountersAlias::GetSnapshot();
+    EXPECT_EQ(allocatorSnapshot.Deallocations, 2);
+    EXPECT_EQ(allocatorSnapshot.LiveBytes, 0);
+    EXPECT_EQ(listSnapshot.Allocations, listSnapshot.Deallocations);
+    EXPECT_EQ(listSnapshot.LiveBytes, 0);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_INSTRUMENTATION_TEST_HPP
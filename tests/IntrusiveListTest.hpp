@@ -0,0 +1,168 @@
+#ifndef DSA_LIBRARIES_INTRUSIVE_LIST_TEST_HPP
+#define DSA_LIBRARIES_INTRUSIVE_LIST_TEST_HPP
+
+#include "../include/Containers/Intrusive/IntrusiveDList.hpp"
+#include "../include/Containers/Intrusive/IntrusiveSList.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+namespace DSALibraries::Test
+{
+class IntrusiveListTest : public ::testing::Test
+{
+  protected:
+    struct Connection
+    {
+        int Id = 0;
+        int Priority = 0;
+        Containers::DListNodeBase StateHook;
+        Containers::IntrusiveDListAutoHook AllHook;
+        Containers::SListNodeBase PendingHook;
+
+        bool operator==(const Connection &other) const
+        {
+            return Id == other.Id;
+        }
+    };
+
+    using StateList = Containers::IntrusiveDList<Connection, &Connection::StateHook>;
+    using AllList = Containers::IntrusiveDList<Connection, &Connection::AllHook>;
+    using PendingList = Containers::IntrusiveSList<Connection, &Connection::PendingHook>;
+
+    std::vector<Connection> _pool = std::vector<Connection>(10);
+
+    void SetUp() override
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            _pool[i].Id = i;
+        }
+    }
+
+    template <typename TList> static std::vector<int> Ids(const TList &list)
+    {
+        std::vector<int> ids;
+        for (const auto &connection : list)
+        {
+            ids.push_back(connection.Id);
+        }
+        return ids;
+    }
+};
+
+TEST_F(IntrusiveListTest, objects_sit_in_several_lists_without_copies)
+{
+    StateList idle;
+    StateList busy;
+    PendingList pending;
+    for (auto &connection : _pool)
+    {
+        idle.PushBack(connection);
+        if (connection.Id % 2 == 0)
+        {
+            pending.PushFront(connection);
+        }
+    }
+    EXPECT_EQ(&idle.GetItemFront(), &_pool[0]);
+    EXPECT_EQ(Ids(pending), (std::vector<int>{8, 6, 4, 2, 0}));
+
+    // A state change is an O(1) unlink and relink of the same object.
+    StateList::Unlink(_pool[3]);
+    busy.PushBack(_pool[3]);
+    busy.Splice(busy.GetEnd(), idle, StateList::GetIterator(_pool[7]));
+    EXPECT_EQ(Ids(busy), (std::vector<int>{3, 7}));
+    EXPECT_EQ(idle.GetSize(), 8u);
+    EXPECT_THROW(busy.PushFront(_pool[0]), Containers::IntrusiveListLinkedException);
+
+    pending.EraseAfter(pending.GetBegin());
+    pending.Reverse();
+    EXPECT_EQ(Ids(pending), (std::vector<int>{0, 2, 4, 8}));
+    EXPECT_TRUE(PendingList::IsLinked(_pool[8]));
+    pending.Clear();
+    EXPECT_FALSE(PendingList::IsLinked(_pool[8]));
+
+    idle.Splice(idle.GetBegin(), busy);
+    EXPECT_TRUE(busy.IsEmpty());
+    EXPECT_EQ(Ids(idle), (std::vector<int>{3, 7, 0, 1, 2, 4, 5, 6, 8, 9}));
+    idle.Clear();
+}
+
+TEST_F(IntrusiveListTest, auto_hook_unlinks_on_destruction)
+{
+    AllList all;
+    auto first = std::make_unique<Connection>();
+    auto second = std::make_unique<Connection>();
+    first->Id = 1;
+    second->Id = 2;
+    all.PushBack(*first);
+    all.PushBack(*second);
+    all.PushBack(_pool[5]);
+    first.reset();
+    EXPECT_EQ(Ids(all), (std::vector<int>{2, 5}));
+    Containers::IntrusiveDListAutoHook copy(second->AllHook);
+    EXPECT_EQ(copy.PointerNext, nullptr);
+    second.reset();
+    EXPECT_EQ(Ids(all), std::vector<int>{5});
+}
+
+TEST_F(IntrusiveListTest, sort_and_merge_relink_stably)
+{
+    std::mt19937 random(3);
+    std::vector<Connection> connections(500);
+    StateList doubly;
+    PendingList singly;
+    for (int i = 0; i < 500; ++i)
+    {
+        connections[i].Id = i;
+        connections[i].Priority = static_cast<int>(random() % 20);
+        doubly.PushBack(connections[i]);
+        singly.PushFront(connections[i]);
+    }
+    auto byPriority = [](const Connection &lhs, const Connection &rhs) { return lhs.Priority < rhs.Priority; };
+    doubly.Sort(byPriority);
+    singly.Sort(byPriority);
+    std::vector<Connection *> expected;
+    for (auto &connection : connections)
+    {
+        expected.push_back(&connection);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](const Connection *lhs, const Connection *rhs) { return byPriority(*lhs, *rhs); });
+    std::size_t i = 0;
+    for (auto it = doubly.GetBegin(); it != doubly.GetEnd(); ++it, ++i)
+    {
+        ASSERT_EQ(&*it, expected[i]);
+    }
+    EXPECT_EQ(i, 500u);
+    EXPECT_EQ(&*--doubly.GetEnd(), expected.back());
+    // singly was filled in reverse, so stable order among equal priorities is reversed too.
+    int previousPriority = -1;
+    int previousId = 1000;
+    for (const auto &connection : singly)
+    {
+        ASSERT_TRUE(connection.Priority > previousPriority ||
+                    (connection.Priority == previousPriority && connection.Id < previousId));
+        previousPriority = connection.Priority;
+        previousId = connection.Id;
+    }
+
+    StateList evens;
+    StateList odds;
+    for (int j = 0; j < 10; j += 2)
+    {
+        StateList::Unlink(_pool[j]);
+        evens.PushBack(_pool[j]);
+        odds.PushBack(_pool[j + 1]);
+    }
+    auto byId = [](const Connection &lhs, const Connection &rhs) { return lhs.Id < rhs.Id; };
+    evens.Merge(odds, byId);
+    EXPECT_TRUE(odds.IsEmpty());
+    EXPECT_EQ(Ids(evens), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    evens.RemoveIf([](const Connection &connection) { return connection.Id > 4; });
+    evens.Reverse();
+    EXPECT_EQ(Ids(evens), (std::vector<int>{4, 3, 2, 1, 0}));
+    EXPECT_FALSE(StateList::IsLinked(_pool[9]));
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_INTRUSIVE_LIST_TEST_HPP
@@ -6,6 +6,8 @@
 #define DSA_LIBRARIES_LIST_TEST_H
 #include "../googletest/include/gtest/gtest.h"
 #include "../include/Containers/List/List.hpp"
+#include "../include/Utilities/CountingAllocator.hpp"
+#include <string>
 
 namespace DSALibraries::Test
 {
@@ -31,8 +33,8 @@ class ListTest : public ::testing::Test
         List_1.Clear();
     }
 
-    List<int> List_0;
-    List<int> List_1;
+    Containers::List<int> List_0;
+    Containers::List<int> List_1;
 };
 
 TEST_F(ListTest, PushBack)
@@ -105,5 +107,73 @@ TEST_F(ListTest, EmplaceBack)
     ASSERT_EQ(List_1.GetItemBack(), 10);
 }
 
+TEST_F(ListTest, reserved_nodes_are_recycled_without_allocator_calls)
+{
+    struct PoolTag
+    {
+    };
+    using CountedAlias = Utilities::Instrumentation<PoolTag>;
+    Containers::List<int, Utilities::CountingAllocator<int, PoolTag>> queue;
+    queue.Reserve(32);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 32u);
+    const std::uint64_t reserved = CountedAlias::GetSnapshot().Allocations;
+
+    for (int round = 0; round < 50; ++round)
+    {
+        for (int i = 0; i < 32; ++i)
+        {
+            queue.PushBack(i);
+        }
+        while (!queue.IsEmpty())
+        {
+            queue.PopFront();
+        }
+    }
+    EXPECT_EQ(CountedAlias::GetSnapshot().Allocations, reserved);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 32u);
+
+    queue.SetNodeCacheLimit(8);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 8u);
+    queue.ShrinkToFit();
+    EXPECT_EQ(queue.GetCachedNodeCount(), 0u);
+    EXPECT_EQ(CountedAlias::GetSnapshot().LiveBytes, 0u);
+}
+
+TEST_F(ListTest, compact_keeps_order_and_both_links)
+{
+    Containers::List<std::string> list;
+    for (int i = 0; i < 64; ++i)
+    {
+        list.PushFront(std::to_string(i));
+        Containers::List<std::string> gap(3, std::string(40, 'x'));
+    }
+    list.Reverse();
+    EXPECT_GT(list.GetScatter(), 0.0);
+    list.Compact();
+    EXPECT_EQ(list.GetScatter(), 0.0);
+    ASSERT_EQ(list.GetSize(), 64u);
+    int expected = 0;
+    for (auto it = list.GetBegin(); it != list.GetEnd(); ++it)
+    {
+        EXPECT_EQ(*it, std::to_string(expected++));
+    }
+    for (auto it = list.GetEnd(); it != list.GetBegin();)
+    {
+        --it;
+        EXPECT_EQ(*it, std::to_string(--expected));
+    }
+
+    Containers::List<std::string> other;
+    auto last = list.GetBegin();
+    for (int i = 0; i < 4; ++i)
+    {
+        ++last;
+    }
+    other.Splice(other.GetEnd(), list, list.GetBegin(), last);
+    list.Clear();
+    ASSERT_EQ(other.GetSize(), 4u);
+    EXPECT_EQ(other.GetItemBack(), "3");
+}
+
 }; // namespace DSALibraries::Test
 #endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+#ifndef DSA_LIBRARIES_LOSER_TREE_TEST_HPP
+#define DSA_LIBRARIES_LOSER_TREE_TEST_HPP
+
+#include "../include/Containers/LoserTree/LoserTree.hpp"
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+namespace DSALibraries::Test
+{
+class LoserTreeTest : public ::testing::Test
+{
+};
+
+TEST_F(LoserTreeTest, merges_sources_in_order)
+{
+    const std::vector<std::vector<int>> sources = {{1, 4, 9}, {}, {2, 3, 10, 11}, {0, 5}, {6, 7, 8}};
+    Containers::LoserTree<int> tree(sources.size());
+    std::vector<std::size_t> positions(sources.size(), 0);
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        if (!sources[i].empty())
+        {
+            tree.SetSource(i, sources[i][positions[i]++]);
+        }
+    }
+    tree.Build();
+    EXPECT_EQ(tree.GetActiveCount(), 4);
+
+    std::vector<int> merged;
+    while (!tree.IsEmpty())
+    {
+        const std::size_t winner = tree.GetWinner();
+        merged.push_back(tree.TakeTop());
+        if (positions[winner] < sources[winner].size())
+        {
+            tree.ReplaceTop(sources[winner][positions[winner]++]);
+        }
+        else
+        {
+            tree.PopTop();
+        }
+    }
+    EXPECT_EQ(merged, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}));
+}
+
+TEST_F(LoserTreeTest, ties_go_to_lower_source)
+{
+    using Pair = std::pair<int, int>;
+    auto byKey = [](const Pair &lhs, const Pair &rhs) { return lhs.first < rhs.first; };
+    Containers::LoserTree<Pair, decltype(byKey)> tree(3, byKey);
+    tree.SetSource(2, {1, 2});
+    tree.SetSource(0, {1, 0});
+    tree.SetSource(1, {1, 1});
+    tree.Build();
+
+    for (int expected = 0; expected < 3; ++expected)
+    {
+        EXPECT_EQ(tree.GetTop().second, expected);
+        tree.PopTop();
+    }
+    EXPECT_TRUE(tree.IsEmpty());
+}
+
+TEST_F(LoserTreeTest, throws_when_empty_or_out_of_bounds)
+{
+    Containers::LoserTree<int> tree(2);
+    EXPECT_THROW(tree.SetSource(2, 0), Containers::LoserTreeOutOfBoundsException);
+    tree.Build();
+    EXPECT_THROW(static_cast<void>(tree.GetTop()), Containers::LoserTreeEmptyException);
+    EXPECT_THROW(tree.PopTop(), Containers::LoserTreeEmptyException);
+}
+
+TEST_F(LoserTreeTest, merge_ranges_merges_vector_ranges_stably)
+{
+    using Pair = std::pair<int, int>;
+    using IteratorAlias = Containers::Vector<Pair>::ConstIteratorAlias;
+    Containers::Vector<Pair> first{{1, 0}, {3, 0}, {3, 1}};
+    Containers::Vector<Pair> second;
+    Containers::Vector<Pair> third{{0, 2}, {3, 2}, {7, 2}};
+    Containers::Vector<std::pair<IteratorAlias, IteratorAlias>> ranges;
+    ranges.PushBack({first.GetConstBegin(), first.GetConstEnd()});
+    ranges.PushBack({second.GetConstBegin(), second.GetConstEnd()});
+    ranges.PushBack({third.GetConstBegin(), third.GetConstEnd()});
+
+    std::vector<Pair> merged(6);
+    auto byKey = [](const Pair &lhs, const Pair &rhs) { return lhs.first < rhs.first; };
+    auto end = Containers::MergeRanges(ranges, merged.begin(), byKey);
+    EXPECT_EQ(end, merged.end());
+    EXPECT_EQ(merged, (std::vector<Pair>{{0, 2}, {1, 0}, {3, 0}, {3, 1}, {3, 2}, {7, 2}}));
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_LOSER_TREE_TEST_HPP
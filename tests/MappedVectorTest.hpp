@@ -0,0 +1,115 @@
+#ifndef DSA_LIBRARIES_MAPPED_VECTOR_TEST_HPP
+#define DSA_LIBRARIES_MAPPED_VECTOR_TEST_HPP
+
+#include "../include/Containers/Vector/MappedVector.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <utility>
+namespace DSALibraries::Test
+{
+class MappedVectorTest : public ::testing::Test
+{
+  protected:
+    struct Record
+    {
+        std::uint64_t Key;
+        double Value;
+    };
+
+    std::filesystem::path _path;
+
+    void SetUp() override
+    {
+        _path = std::filesystem::temp_directory_path() /
+                ("dsa-mapped-vector-test-" + std::to_string(std::random_device()()) + ".bin");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(_path);
+    }
+};
+
+TEST_F(MappedVectorTest, persists_records_across_reopen)
+{
+    constexpr std::uint64_t count = 10000;
+    {
+        Containers::MappedVector<Record> records(_path, Containers::MappedVectorMode::Truncate);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            records.PushBack({i, static_cast<double>(i) / 2});
+        }
+        EXPECT_GE(records.GetCapacity(), count);
+        records.Sync();
+    }
+    EXPECT_EQ(std::filesystem::file_size(_path), count * sizeof(Record));
+
+    Containers::MappedVector<Record> records(_path, Containers::MappedVectorMode::ReadOnly);
+    ASSERT_EQ(records.GetSize(), count);
+    EXPECT_TRUE(records.Advise(Containers::MappedAdvice::Sequential));
+    std::uint64_t expected = 0;
+    for (auto it = records.GetConstBegin(); it != records.GetConstEnd(); ++it, ++expected)
+    {
+        EXPECT_EQ(it->Key, expected);
+        EXPECT_EQ(it->Value, static_cast<double>(expected) / 2);
+    }
+    EXPECT_EQ(records.At(count - 1).Key, count - 1);
+    EXPECT_THROW(records.At(count), Containers::VectorOutOfBoundsException);
+}
+
+TEST_F(MappedVectorTest, resizes_and_shrinks_backing_file)
+{
+    Containers::MappedVector<int> values(_path);
+    EXPECT_TRUE(values.IsEmpty());
+    values.Resize(1000);
+    EXPECT_EQ(values[999], 0);
+    values[999] = 7;
+    values.Reverse(100000);
+    EXPECT_EQ(values[999], 7);
+    EXPECT_EQ(std::filesystem::file_size(_path), 100000 * sizeof(int));
+
+    values.Resize(10);
+    values.ShrinkToFit();
+    EXPECT_EQ(values.GetCapacity(), 10);
+    EXPECT_EQ(std::filesystem::file_size(_path), 10 * sizeof(int));
+    values.Resize(1000);
+    EXPECT_EQ(values[999], 0);
+
+    values.Clear();
+    values.ShrinkToFit();
+    EXPECT_EQ(values.GetData(), nullptr);
+    values.PushBack(3);
+    EXPECT_EQ(values[0], 3);
+}
+
+TEST_F(MappedVectorTest, read_only_rejects_writes)
+{
+    {
+        Containers::MappedVector<int> values(_path);
+        values.PushBack(1);
+    }
+    Containers::MappedVector<int> values(_path, Containers::MappedVectorMode::ReadOnly);
+    EXPECT_THROW(values.PushBack(2), Containers::MappedVectorReadOnlyException);
+    EXPECT_THROW(values.Resize(4), Containers::MappedVectorReadOnlyException);
+
+    Containers::MappedVector<int> moved(std::move(values));
+    EXPECT_FALSE(values.IsOpen());
+    EXPECT_EQ(moved[0], 1);
+}
+
+TEST_F(MappedVectorTest, rejects_partial_records)
+{
+    {
+        std::ofstream file(_path, std::ios::binary);
+        file.write("abc", 3);
+    }
+    EXPECT_THROW(Containers::MappedVector<int>{_path}, Containers::MappedVectorInvalidFileException);
+    EXPECT_THROW(Containers::MappedVector<int>(_path / "missing", Containers::MappedVectorMode::ReadOnly),
+                 Containers::MappedVectorIOException);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_MAPPED_VECTOR_TEST_HPP
@@ -0,0 +1,75 @@
+#ifndef DSA_LIBRARIES_PRIORITY_QUEUE_TEST_HPP
+#define DSA_LIBRARIES_PRIORITY_QUEUE_TEST_HPP
+
+#include "../include/Containers/PriorityQueue/PriorityQueue.hpp"
+#include "../include/Containers/PriorityQueue/TopK.hpp"
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+namespace DSALibraries::Test
+{
+class PriorityQueueTest : public ::testing::Test
+{
+  protected:
+    Containers::PriorityQueue<int> PriorityQueue_0;
+    Containers::PriorityQueue<std::string, std::greater<std::string>> PriorityQueue_1;
+};
+
+TEST_F(PriorityQueueTest, push_and_pop_in_order)
+{
+    EXPECT_TRUE(PriorityQueue_0.IsEmpty());
+    EXPECT_THROW(PriorityQueue_0.Pop(), Containers::PriorityQueueEmptyException);
+
+    for (int value : {5, 1, 9, 3, 7, 9, 0})
+    {
+        PriorityQueue_0.Push(value);
+    }
+    EXPECT_EQ(PriorityQueue_0.GetSize(), 7);
+    EXPECT_EQ(PriorityQueue_0.GetTop(), 9);
+
+    PriorityQueue_0.ReplaceTop(2);
+    int expected[] = {9, 7, 5, 3, 2, 1, 0};
+    for (int value : expected)
+    {
+        EXPECT_EQ(PriorityQueue_0.PopTop(), value);
+    }
+    EXPECT_TRUE(PriorityQueue_0.IsEmpty());
+}
+
+TEST_F(PriorityQueueTest, min_queue_of_strings)
+{
+    PriorityQueue_1.Emplace("pear");
+    PriorityQueue_1.Emplace("apple");
+    PriorityQueue_1.Push(std::string("fig"));
+    EXPECT_EQ(PriorityQueue_1.PopTop(), "apple");
+    EXPECT_EQ(PriorityQueue_1.PopTop(), "fig");
+
+    const auto released = PriorityQueue_1.Release();
+    EXPECT_EQ(released.GetSize(), 1);
+    EXPECT_TRUE(PriorityQueue_1.IsEmpty());
+}
+
+TEST_F(PriorityQueueTest, top_k_keeps_best_of_stream)
+{
+    Containers::TopK<int, std::greater<int>> best(3);
+    for (int value : {5, 1, 9, 3, 7, 9, 0, 8})
+    {
+        best.Push(value);
+    }
+    EXPECT_TRUE(best.IsFull());
+    EXPECT_EQ(best.GetThreshold(), 8);
+    EXPECT_FALSE(best.Push(8));
+    EXPECT_TRUE(best.Push(10));
+
+    Containers::Vector<int> sorted = best.TakeSorted();
+    ASSERT_EQ(sorted.GetSize(), 3);
+    EXPECT_EQ(sorted[0], 10);
+    EXPECT_EQ(sorted[1], 9);
+    EXPECT_EQ(sorted[2], 9);
+    EXPECT_EQ(best.GetSize(), 0);
+
+    Containers::TopK<int> none(0);
+    EXPECT_FALSE(none.Push(1));
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_PRIORITY_QUEUE_TEST_HPP
@@ -2,7 +2,11 @@
 #define DSA_LIBRARIES_SLIST_TEST_HPP
 #include "../googletest/include/gtest/gtest.h"
 #include "../include/Containers/SList/SList.hpp"
+#include "../include/Containers/Vector/Vector.hpp"
+#include "../include/Utilities/CountingAllocator.hpp"
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace DSALibraries::Test
 {
@@ -46,6 +50,21 @@ TEST_F(SListTest, insertion_sort)
     }
 }
 
+TEST_F(SListTest, insertion_sort_orders_ascending)
+{
+    SList_0.PushFront(5);
+    SList_0.PushFront(-1);
+    SList_0.DSASort(1, std::less<>());
+    const int expected[] = {-1, 0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9};
+    auto it = SList_0.GetBegin();
+    for (int value : expected)
+    {
+        ASSERT_EQ(*it, value);
+        ++it;
+    }
+    EXPECT_EQ(it, SList_0.GetEnd());
+}
+
 TEST_F(SListTest, selection_sort)
 {
     for (auto it = SList_0.GetBegin(); it != SList_0.GetEnd(); it++)
@@ -120,6 +139,262 @@ TEST_F(SListTest, merge_sort)
         it++;
     }
 }
+
+TEST_F(SListTest, compact_lays_nodes_out_in_order_and_survives_splicing)
+{
+    struct SlabTag
+    {
+    };
+    using CountedAlias = Utilities::Instrumentation<SlabTag>;
+    using ListAlias = Containers::SList<int, Utilities::CountingAllocator<int, SlabTag>>;
+    ListAlias list;
+    for (int i = 0; i < 20; ++i)
+    {
+        list.PushFront(i);
+    }
+    list.Remove(5);
+    ASSERT_EQ(list.GetSize(), 19u);
+    list.Compact();
+    EXPECT_EQ(list.GetScatter(), 0.0);
+    EXPECT_EQ(list.GetItemFront(), 19);
+    const Utilities::InstrumentationSnapshot compacted = CountedAlias::GetSnapshot();
+    EXPECT_EQ(compacted.Allocations - compacted.Deallocations, 1u);
+
+    // The spliced nodes outlive the list that allocated their slab, and free it with the last of them.
+    ListAlias other;
+    auto last = list.GetConstBegin();
+    for (int i = 0; i < 4; ++i)
+    {
+        ++last;
+    }
+    other.SpliceAfter(other.GetConstBeginFromHead(), list, list.GetConstBeginFromHead(), last);
+    EXPECT_EQ(other.GetSize(), 4u);
+    EXPECT_EQ(list.GetSize(), 15u);
+    list.Clear();
+    EXPECT_EQ(CountedAlias::GetSnapshot().Deallocations, compacted.Deallocations);
+    other.Clear();
+    EXPECT_EQ(CountedAlias::GetSnapshot().Deallocations, compacted.Deallocations + 1);
+    EXPECT_EQ(CountedAlias::GetSnapshot().LiveBytes, 0u);
+}
+
+TEST_F(SListTest, reserved_nodes_are_recycled_without_allocator_calls)
+{
+    struct PoolTag
+    {
+    };
+    using CountedAlias = Utilities::Instrumentation<PoolTag>;
+    Containers::SList<int, Utilities::CountingAllocator<int, PoolTag>> queue;
+    queue.Reserve(64);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 64u);
+    EXPECT_EQ(queue.GetNodeCacheLimit(), 64u);
+    const Utilities::InstrumentationSnapshot reserved = CountedAlias::GetSnapshot();
+    EXPECT_EQ(reserved.Allocations, 1u);
+
+    for (int round = 0; round < 100; ++round)
+    {
+        for (int i = 0; i < 64; ++i)
+        {
+            queue.PushFront(i);
+        }
+        while (!queue.IsEmpty())
+        {
+            queue.PopFront();
+        }
+    }
+    queue.PushFront(1);
+    queue.Clear();
+    EXPECT_EQ(CountedAlias::GetSnapshot().Allocations, 1u);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 64u);
+
+    queue.SetNodeCacheLimit(16);
+    EXPECT_EQ(queue.GetCachedNodeCount(), 16u);
+    queue.ShrinkToFit();
+    EXPECT_EQ(queue.GetCachedNodeCount(), 0u);
+    EXPECT_EQ(CountedAlias::GetSnapshot().Deallocations, 1u);
+    EXPECT_EQ(CountedAlias::GetSnapshot().LiveBytes, 0u);
+}
+
+TEST_F(SListTest, multi_element_inserts_take_one_allocation)
+{
+    struct BulkTag
+    {
+    };
+    struct ThrowingCopy
+    {
+        int Value;
+        ThrowingCopy(int value) : Value(value)
+        {
+        }
+        ThrowingCopy(const ThrowingCopy& other) : Value(other.Value)
+        {
+            if (Value == 3)
+            {
+                throw std::runtime_error("copy");
+            }
+        }
+    };
+    using CountedAlias = Utilities::Instrumentation<BulkTag>;
+    Containers::Vector<int> source;
+    for (int i = 0; i < 1000; ++i)
+    {
+        source.PushBack(i);
+    }
+    {
+        Containers::SList<int, Utilities::CountingAllocator<int, BulkTag>> list(source.GetBegin(), source.GetEnd());
+        EXPECT_EQ(CountedAlias::GetSnapshot().Allocations, 1u);
+        list.InsertAfter(list.GetConstBeginFromHead(), std::size_t{10}, -1);
+        list.InsertAfter(list.GetConstBeforeEnd(), source.GetBegin(), source.GetBegin() + 5);
+        EXPECT_EQ(CountedAlias::GetSnapshot().Allocations, 3u);
+        EXPECT_EQ(list.GetSize(), 1015u);
+        EXPECT_EQ(list.GetItemFront(), -1);
+        EXPECT_EQ(list.GetItemBack(), 4);
+
+        int expected = 0;
+        auto it = list.GetConstBegin();
+        for (int i = 0; i < 10; ++i)
+        {
+            ++it;
+        }
+        for (; expected < 1000; ++expected, ++it)
+        {
+            EXPECT_EQ(*it, expected);
+        }
+
+        // Slab nodes are still erased one at a time.
+        list.EraseAfter(list.GetConstBeginFromHead());
+        list.PopFront();
+        EXPECT_EQ(list.GetSize(), 1013u);
+    }
+    EXPECT_EQ(CountedAlias::GetSnapshot().LiveBytes, 0u);
+
+    const ThrowingCopy values[] = {1, 2, 3, 4};
+    Containers::SList<ThrowingCopy> copies{ThrowingCopy(7)};
+    EXPECT_THROW(copies.InsertAfter(copies.GetConstBeginFromHead(), values, values + 4), std::runtime_error);
+    EXPECT_EQ(copies.GetSize(), 1u);
+    EXPECT_EQ(copies.GetItemBack().Value, 7);
+}
+
+TEST_F(SListTest, merge_all_relinks_many_sorted_lists_stably)
+{
+    using Pair = std::pair<int, int>;
+    auto byKey = [](const Pair& lhs, const Pair& rhs) { return lhs.first < rhs.first; };
+    Containers::SList<Pair> merged{{1, 0}, {4, 0}, {9, 0}};
+    Containers::SList<Pair> second{{1, 1}, {2, 1}, {9, 1}};
+    Containers::SList<Pair> empty;
+    Containers::SList<Pair> third{{0, 3}, {1, 3}, {10, 3}};
+    merged.MergeAll(byKey, second, empty, third, second);
+    EXPECT_TRUE(second.IsEmpty());
+    EXPECT_TRUE(third.IsEmpty());
+
+    const Pair expected[] = {{0, 3}, {1, 0}, {1, 1}, {1, 3}, {2, 1}, {4, 0}, {9, 0}, {9, 1}, {10, 3}};
+    std::size_t index = 0;
+    for (auto it = merged.GetConstBegin(); it != merged.GetConstEnd(); ++it, ++index)
+    {
+        ASSERT_LT(index, 9u);
+        EXPECT_EQ(*it, expected[index]);
+    }
+    EXPECT_EQ(index, 9u);
+    EXPECT_EQ(merged.GetItemBack(), Pair(10, 3));
+
+    Containers::SList<int> shards[3] = {{5, 6}, {0, 7}, {}};
+    Containers::SList<int> all{3};
+    all.MergeAll(shards, 3);
+    all.PushBack(8);
+    int value = 0;
+    for (auto it = all.GetConstBegin(); it != all.GetConstEnd(); ++it)
+    {
+        EXPECT_LE(value, *it);
+        value = *it;
+    }
+    EXPECT_EQ(all.GetSize(), 6u);
+}
+
+TEST_F(SListTest, parallel_sort_is_stable_and_keeps_the_tail)
+{
+    using Pair = std::pair<int, int>;
+    auto byKey = [](const Pair& lhs, const Pair& rhs) { return lhs.first < rhs.first; };
+    Containers::SList<Pair> list;
+    for (int i = 0; i < 40000; ++i)
+    {
+        list.PushBack({(i * 7919) % 1000, i});
+    }
+    list.ParallelSort(byKey, 4);
+    EXPECT_EQ(list.GetSize(), 40000u);
+    Pair previous{-1, -1};
+    for (auto it = list.GetConstBegin(); it != list.GetConstEnd(); ++it)
+    {
+        EXPECT_TRUE(previous.first < it->first || (previous.first == it->first && previous.second < it->second));
+        previous = *it;
+    }
+    EXPECT_EQ(list.GetItemBack(), previous);
+    list.PushBack({1000, 0});
+    EXPECT_EQ(list.GetItemBack().first, 1000);
+
+    Containers::SList<int> small{3, 1, 2};
+    small.ParallelSort();
+    EXPECT_EQ(small.GetItemFront(), 1);
+    EXPECT_EQ(small.GetItemBack(), 3);
+}
+
+TEST_F(SListTest, tail_tracks_back_through_relinking_operations)
+{
+    auto expectBack = [](Containers::SList<int>& list) {
+        const int* last = nullptr;
+        for (auto it = list.GetBegin(); it != list.GetEnd(); ++it)
+        {
+            last = &*it;
+        }
+        EXPECT_EQ(last, list.IsEmpty() ? nullptr : &list.GetItemBack());
+    };
+    Containers::SList<int> queue;
+    for (int i = 0; i < 8; ++i)
+    {
+        queue.PushBack(i);
+        queue.EmplaceBack(i + 100);
+    }
+    queue.PopFront();
+    EXPECT_EQ(queue.GetItemFront(), 100);
+    EXPECT_EQ(queue.GetItemBack(), 107);
+    queue.Reverse();
+    expectBack(queue);
+    queue.Sort(std::less<>());
+    expectBack(queue);
+    EXPECT_EQ(queue.GetItemBack(), 107);
+
+    queue.SpliceBack(SList_0);
+    EXPECT_TRUE(SList_0.IsEmpty());
+    expectBack(queue);
+    EXPECT_EQ(queue.GetItemBack(), 0);
+    SList_0.PushBack(-1);
+    EXPECT_EQ(SList_0.GetItemBack(), -1);
+
+    Containers::SList<int> sorted{1, 200};
+    queue.Sort(std::less<>());
+    queue.Merge(sorted);
+    expectBack(queue);
+    EXPECT_EQ(queue.GetItemBack(), 200);
+    expectBack(sorted);
+
+    auto beforeLast = queue.GetConstBegin();
+    while (beforeLast.PointerNext() != queue.GetConstBeforeEnd())
+    {
+        ++beforeLast;
+    }
+    sorted.SpliceAfter(sorted.GetConstBeginFromHead(), queue, beforeLast, queue.GetConstEnd());
+    expectBack(queue);
+    EXPECT_EQ(sorted.GetItemBack(), 200);
+    queue.SpliceAfter(queue.GetConstBeforeEnd(), sorted);
+    expectBack(queue);
+    EXPECT_EQ(queue.GetItemBack(), 200);
+    for (int value : {5, 6, 7})
+    {
+        queue.Remove(value);
+    }
+    queue.EraseAfter(queue.GetConstBeginFromHead(), queue.GetConstEnd());
+    EXPECT_TRUE(queue.IsEmpty());
+    queue.PushBack(3);
+    EXPECT_EQ(queue.GetItemFront(), 3);
+}
 } // namespace DSALibraries::Test
 
 #endif
\ No newline at end of file
@@ -0,0 +1,151 @@
+#ifndef DSA_LIBRARIES_SERIALIZATION_TEST_HPP
+#define DSA_LIBRARIES_SERIALIZATION_TEST_HPP
+
+#include "../include/Containers/Serialization/Serialization.hpp"
+#include "../include/Containers/Vector/MappedVector.hpp"
+#include <cstdint>
+#include <fcntl.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <unistd.h>
+namespace DSALibraries::Test
+{
+class SerializationTest : public ::testing::Test
+{
+  protected:
+    struct Record
+    {
+        std::uint32_t Key;
+        float Value;
+    };
+
+    std::filesystem::path _path;
+
+    void SetUp() override
+    {
+        _path = std::filesystem::temp_directory_path() /
+                ("dsa-serialization-test-" + std::to_string(std::random_device()()) + ".bin");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(_path);
+    }
+
+    [[nodiscard]] int OpenForWrite() const
+    {
+        return ::open(_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+
+    [[nodiscard]] int OpenForRead() const
+    {
+        return ::open(_path.c_str(), O_RDONLY);
+    }
+};
+
+TEST_F(SerializationTest, vector_round_trips_and_maps_in_place)
+{
+    Containers::Vector<Record> records;
+    for (std::uint32_t i = 0; i < 50000; ++i)
+    {
+        records.PushBack({i, static_cast<float>(i) * 0.5f});
+    }
+    int file = OpenForWrite();
+    ASSERT_GE(file, 0);
+    Containers::Serialize(file, records);
+    ::close(file);
+    EXPECT_EQ(std::filesystem::file_size(_path), sizeof(Containers::SerializationHeader) + 50000 * sizeof(Record));
+
+    Containers::Vector<Record> loaded(3);
+    file = OpenForRead();
+    Containers::Deserialize(file, loaded);
+    ::close(file);
+    ASSERT_EQ(loaded.GetSize(), records.GetSize());
+    EXPECT_EQ(loaded[49999].Key, 49999u);
+    EXPECT_EQ(loaded[100].Value, 50.0f);
+
+    Containers::MappedVector<unsigned char> mapping(_path, Containers::MappedVectorMode::ReadOnly);
+    Containers::SerializedView<Record> view(mapping.GetData(), mapping.GetSize());
+    ASSERT_EQ(view.GetSize(), 50000);
+    EXPECT_EQ(view.GetData(), reinterpret_cast<const Record *>(mapping.GetData() + 32));
+    EXPECT_EQ(view[12345].Key, 12345u);
+    EXPECT_THROW(view.At(50000), Containers::VectorOutOfBoundsException);
+}
+
+TEST_F(SerializationTest, lists_stream_in_order)
+{
+    Containers::SList<int> source;
+    for (int i = 99999; i >= 0; --i)
+    {
+        source.PushFront(i);
+    }
+    int file = OpenForWrite();
+    Containers::Serialize(file, source);
+    ::close(file);
+
+    Containers::DList<int> doubly;
+    doubly.PushFront(-1);
+    file = OpenForRead();
+    Containers::Deserialize(file, doubly);
+    ::close(file);
+    int expected = 0;
+    for (auto it = doubly.GetConstBegin(); it != doubly.GetConstEnd(); ++it, ++expected)
+    {
+        ASSERT_EQ(*it, expected);
+    }
+    EXPECT_EQ(expected, 100000);
+
+    Containers::List<int> list;
+    file = OpenForRead();
+    Containers::Deserialize(file, list);
+    ::close(file);
+    EXPECT_EQ(list.GetSize(), 100000);
+    EXPECT_EQ(list.GetItemBack(), 99999);
+
+    Containers::CompactList<int> compact;
+    file = OpenForRead();
+    Containers::Deserialize(file, compact);
+    ::close(file);
+    EXPECT_EQ(compact.GetSize(), 100000);
+    EXPECT_EQ(compact.GetItemBack(), 99999);
+
+    // A list snapshot reads back into a Vector, and an empty list still writes a header.
+    Containers::Vector<int> vector;
+    file = OpenForRead();
+    Containers::Deserialize(file, vector);
+    ::close(file);
+    EXPECT_EQ(vector.GetSize(), 100000);
+    EXPECT_EQ(vector[4242], 4242);
+
+    file = OpenForWrite();
+    Containers::Serialize(file, Containers::SList<int>());
+    ::close(file);
+    EXPECT_EQ(std::filesystem::file_size(_path), sizeof(Containers::SerializationHeader));
+}
+
+TEST_F(SerializationTest, rejects_mismatched_or_truncated_snapshots)
+{
+    Containers::Vector<int> values(10, 7);
+    int file = OpenForWrite();
+    Containers::Serialize(file, values);
+    ::close(file);
+
+    Containers::Vector<double> doubles;
+    file = OpenForRead();
+    EXPECT_THROW(Containers::Deserialize(file, doubles), Containers::SerializationFormatException);
+    ::close(file);
+
+    std::filesystem::resize_file(_path, sizeof(Containers::SerializationHeader) + 5 * sizeof(int));
+    file = OpenForRead();
+    EXPECT_THROW(Containers::Deserialize(file, values), Containers::SerializationFormatException);
+    ::close(file);
+
+    Containers::MappedVector<unsigned char> mapping(_path, Containers::MappedVectorMode::ReadOnly);
+    EXPECT_THROW(Containers::SerializedView<int>(mapping.GetData(), mapping.GetSize()),
+                 Containers::SerializationFormatException);
+    EXPECT_THROW(Containers::SerializedView<int>(mapping.GetData(), 8), Containers::SerializationFormatException);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_SERIALIZATION_TEST_HPP
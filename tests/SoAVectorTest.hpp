@@ -0,0 +1,197 @@
+#ifndef DSA_LIBRARIES_SOA_VECTOR_TEST_HPP
+#define DSA_LIBRARIES_SOA_VECTOR_TEST_HPP
+
+#include "../include/Containers/Vector/SoAVector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+namespace DSALibraries::Test
+{
+class SoAVectorTest : public ::testing::Test
+{
+  protected:
+    using RecordsAlias = Containers::SoAVector<std::int32_t, double, std::string>;
+
+    static RecordsAlias MakeRecords(std::int32_t size)
+    {
+        std::vector<std::int32_t> keys(static_cast<std::size_t>(size));
+        std::iota(keys.begin(), keys.end(), 0);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(11));
+        RecordsAlias records;
+        for (std::int32_t key : keys)
+        {
+            records.PushBack(key, key * 0.5, std::to_string(key));
+        }
+        return records;
+    }
+
+    // Counts live instances and throws from a copy or default construction once Budget runs out.
+    struct Fragile
+    {
+        static inline int Live = 0;
+        static inline int Budget = 0;
+
+        Fragile()
+        {
+            TakeBudget();
+            ++Live;
+        }
+
+        Fragile(const Fragile &)
+        {
+            TakeBudget();
+            ++Live;
+        }
+
+        Fragile(Fragile &&) noexcept
+        {
+            ++Live;
+        }
+
+        ~Fragile()
+        {
+            --Live;
+        }
+
+        static void TakeBudget()
+        {
+            if (Budget-- <= 0)
+            {
+                throw std::runtime_error("Fragile");
+            }
+        }
+    };
+
+    static void ExpectRowsIntact(const RecordsAlias &records)
+    {
+        for (std::size_t i = 0; i < records.GetSize(); ++i)
+        {
+            const std::int32_t key = Containers::GetField<0>(records[i]);
+            EXPECT_EQ(Containers::GetField<1>(records[i]), key * 0.5);
+            EXPECT_EQ(Containers::GetField<2>(records[i]), std::to_string(key));
+        }
+    }
+};
+
+TEST_F(SoAVectorTest, columns_are_contiguous_and_aligned)
+{
+    RecordsAlias records = MakeRecords(100);
+    EXPECT_EQ(records.GetSize(), 100);
+    EXPECT_GE(records.GetCapacity(), 100);
+
+    Containers::Span<double> values = records.GetColumn<1>();
+    ASSERT_EQ(values.GetSize(), 100);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.GetColumn<0>().GetData()) % RecordsAlias::ColumnAlignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.GetData()) % RecordsAlias::ColumnAlignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.GetColumn<2>().GetData()) % RecordsAlias::ColumnAlignment, 0);
+
+    double sum = 0;
+    for (double value : values)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 99 * 100 / 2 * 0.5);
+    ExpectRowsIntact(records);
+}
+
+TEST_F(SoAVectorTest, sorts_all_columns_by_key)
+{
+    RecordsAlias records = MakeRecords(1000);
+    records.SortByColumn<0>();
+    for (std::int32_t i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(records.GetColumn<0>()[static_cast<std::size_t>(i)], i);
+    }
+    ExpectRowsIntact(records);
+
+    records.SortByColumn<1>(std::greater<>());
+    EXPECT_EQ(Containers::GetField<0>(records[0]), 999);
+    ExpectRowsIntact(records);
+}
+
+TEST_F(SoAVectorTest, every_sort_strategy_moves_rows_together)
+{
+    auto byName = [](const auto &lhs, const auto &rhs) {
+        return Containers::GetField<2>(lhs) < Containers::GetField<2>(rhs);
+    };
+    for (unsigned choice = 0; choice <= 6; ++choice)
+    {
+        RecordsAlias records = MakeRecords(300);
+        records.DSASort(choice, byName);
+        EXPECT_TRUE(std::is_sorted(records.GetColumn<2>().GetBegin(), records.GetColumn<2>().GetEnd()))
+            << "choice " << choice;
+        ExpectRowsIntact(records);
+    }
+
+    RecordsAlias records = MakeRecords(500);
+    records.NthElement(250, Containers::SoAColumnCompare<0>());
+    EXPECT_EQ(Containers::GetField<0>(records[250]), 250);
+    ExpectRowsIntact(records);
+}
+
+TEST_F(SoAVectorTest, copies_resizes_and_pops)
+{
+    RecordsAlias records = MakeRecords(20);
+    RecordsAlias copy = records;
+    records.Clear();
+    EXPECT_TRUE(records.IsEmpty());
+    EXPECT_EQ(copy.GetSize(), 20);
+    ExpectRowsIntact(copy);
+
+    copy.Resize(25);
+    EXPECT_EQ(Containers::GetField<2>(copy[24]), "");
+    copy.Resize(10);
+    copy.PopBack();
+    copy.ShrinkToFit();
+    EXPECT_EQ(copy.GetCapacity(), 9);
+    ExpectRowsIntact(copy);
+
+    // A row of the vector itself may be pushed while it grows.
+    copy.PushBack(Containers::GetField<0>(copy[0]), Containers::GetField<1>(copy[0]), Containers::GetField<2>(copy[0]));
+    EXPECT_EQ(Containers::GetField<2>(copy[9]), Containers::GetField<2>(copy[0]));
+    EXPECT_THROW(copy.At(10), Containers::VectorOutOfBoundsException);
+
+    copy.Clear();
+    EXPECT_THROW(copy.PopBack(), Containers::VectorEmptyException);
+}
+
+TEST_F(SoAVectorTest, field_that_throws_leaves_no_partial_row)
+{
+    using FragileAlias = Containers::SoAVector<std::string, Fragile, Fragile>;
+    Fragile::Budget = 1000;
+    {
+        FragileAlias records(3);
+        ASSERT_EQ(Fragile::Live, 6);
+
+        // The second Fragile column throws after the first was built.
+        records.Reverse(8);
+        const Fragile field;
+        Fragile::Budget = 1;
+        EXPECT_THROW(records.PushBack(std::string("row"), field, field), std::runtime_error);
+        EXPECT_EQ(records.GetSize(), 3);
+        EXPECT_EQ(Fragile::Live, 7);
+
+        Fragile::Budget = 3;
+        EXPECT_THROW(records.Resize(6), std::runtime_error);
+        EXPECT_EQ(records.GetSize(), 3);
+        EXPECT_EQ(Fragile::Live, 7);
+
+        Fragile::Budget = 4;
+        EXPECT_THROW(FragileAlias copy(records), std::runtime_error);
+        EXPECT_EQ(Fragile::Live, 7);
+
+        Fragile::Budget = 1000;
+        FragileAlias copy(records);
+        EXPECT_EQ(copy.GetSize(), 3);
+        EXPECT_EQ(Fragile::Live, 13);
+    }
+    EXPECT_EQ(Fragile::Live, 0);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_SOA_VECTOR_TEST_HPP
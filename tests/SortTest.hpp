@@ -0,0 +1,253 @@
+#ifndef DSA_LIBRARIES_SORT_TEST_HPP
+#define DSA_LIBRARIES_SORT_TEST_HPP
+
+#include "../include/Containers/DList/DList.hpp"
+#include "../include/Containers/List/List.hpp"
+#include "../include/Containers/SList/SList.hpp"
+#include "../include/Containers/Vector/Vector.hpp"
+#include "../include/Utilities/Sort.hpp"
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <utility>
+namespace DSALibraries::Test
+{
+class SortTest : public ::testing::Test
+{
+  protected:
+    std::mt19937 Engine{7};
+
+    Containers::Vector<int> MakeRandom(std::size_t size, int range)
+    {
+        Containers::Vector<int> values;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values.PushBack(static_cast<int>(Engine() % static_cast<unsigned>(range)) - range / 2);
+        }
+        return values;
+    }
+
+    template <typename TContainer, typename TCompare> static bool IsSorted(TContainer &container, TCompare compare)
+    {
+        return std::is_sorted(container.GetBegin(), container.GetEnd(), compare);
+    }
+};
+
+TEST_F(SortTest, picks_insertion_for_tiny_input)
+{
+    Containers::Vector<int> values = MakeRandom(10, 100);
+    EXPECT_EQ(values.AdaptiveSort(std::less<>()), Utilities::SortStrategy::Insertion);
+    EXPECT_TRUE(IsSorted(values, std::less<>()));
+}
+
+TEST_F(SortTest, picks_run_merge_for_presorted_input)
+{
+    Containers::Vector<int> values;
+    for (int i = 0; i < 5000; ++i)
+    {
+        values.PushBack(i % 1000 < 500 ? i : 10000 - i);
+    }
+    EXPECT_EQ(values.AdaptiveSort(std::less<>()), Utilities::SortStrategy::RunMerge);
+    EXPECT_TRUE(IsSorted(values, std::less<>()));
+}
+
+TEST_F(SortTest, picks_radix_for_integral_keys)
+{
+    Containers::Vector<int> ascending = MakeRandom(5000, 1 << 20);
+    Containers::Vector<int> descending = ascending;
+    EXPECT_EQ(ascending.AdaptiveSort(std::less<int>()), Utilities::SortStrategy::Radix);
+    EXPECT_TRUE(IsSorted(ascending, std::less<>()));
+    EXPECT_EQ(descending.AdaptiveSort(std::greater<>()), Utilities::SortStrategy::Radix);
+    EXPECT_TRUE(IsSorted(descending, std::greater<>()));
+}
+
+TEST_F(SortTest, picks_introsort_otherwise)
+{
+    Containers::Vector<int> values = MakeRandom(5000, 1 << 20);
+    auto byLastDigit = [](int lhs, int rhs) { return lhs % 10 < rhs % 10 || (lhs % 10 == rhs % 10 && lhs < rhs); };
+    EXPECT_EQ(values.AdaptiveSort(byLastDigit), Utilities::SortStrategy::IntroSort);
+    EXPECT_TRUE(IsSorted(values, byLastDigit));
+
+    Containers::Vector<std::string> words;
+    for (int i = 0; i < 2000; ++i)
+    {
+        words.PushBack(std::to_string(Engine() % 16));
+    }
+    EXPECT_EQ(words.AdaptiveSort(std::less<>()), Utilities::SortStrategy::IntroSort);
+    EXPECT_TRUE(IsSorted(words, std::less<>()));
+}
+
+TEST_F(SortTest, kernels_sort_adversarial_inputs)
+{
+    for (std::size_t size : {0, 1, 2, 3, 31, 33, 200, 4096})
+    {
+        Containers::Vector<int> random = MakeRandom(size, 1000);
+        Containers::Vector<int> few = MakeRandom(size, 3);
+        Containers::Vector<int> organPipe;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            organPipe.PushBack(static_cast<int>(i < size / 2 ? i : size - i));
+        }
+
+        for (Containers::Vector<int> *input : {&random, &few, &organPipe})
+        {
+            Containers::Vector<int> intro = *input;
+            Containers::Vector<int> threeWay = *input;
+            Containers::Vector<int> heap = *input;
+            Containers::Vector<int> runs = *input;
+            Containers::Vector<int> radix = *input;
+            Utilities::IntroSortRange(intro.GetBegin(), intro.GetEnd(), std::less<>());
+            Utilities::IntroSortRange(threeWay.GetBegin(), threeWay.GetEnd(), std::less<>(), true);
+            Utilities::HeapSortRange(heap.GetBegin(), heap.GetEnd(), std::less<>());
+            Utilities::RunMergeSortRange(runs.GetBegin(), runs.GetEnd(), std::less<>());
+            Utilities::RadixSortRange(radix.GetBegin(), radix.GetEnd());
+            EXPECT_TRUE(IsSorted(intro, std::less<>()));
+            EXPECT_TRUE(IsSorted(threeWay, std::less<>()));
+            EXPECT_TRUE(IsSorted(heap, std::less<>()));
+            EXPECT_TRUE(IsSorted(runs, std::less<>()));
+            EXPECT_TRUE(intro == threeWay && intro == heap && intro == runs && intro == radix);
+        }
+    }
+}
+
+TEST_F(SortTest, run_merge_is_stable)
+{
+    Containers::Vector<std::pair<int, int>> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.PushBack({(i % 100 < 50 ? i % 100 : 100 - i % 100) / 4, i});
+    }
+    auto byKey = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+    Utilities::RunMergeSortRange(values.GetBegin(), values.GetEnd(), byKey);
+    for (std::size_t i = 1; i < values.GetSize(); ++i)
+    {
+        ASSERT_TRUE(values[i - 1].first < values[i].first ||
+                    (values[i - 1].first == values[i].first && values[i - 1].second < values[i].second));
+    }
+}
+
+TEST_F(SortTest, lists_sort_through_buffer)
+{
+    Containers::Vector<int> values = MakeRandom(3000, 1 << 16);
+    Containers::SList<int> slist;
+    Containers::DList<int> dlist;
+    Containers::List<int> list;
+    for (std::size_t i = 0; i < values.GetSize(); ++i)
+    {
+        slist.PushFront(values[i]);
+        dlist.PushFront(values[i]);
+        list.PushFront(values[i]);
+    }
+    EXPECT_EQ(slist.AdaptiveSort(std::less<>()), Utilities::SortStrategy::Radix);
+    EXPECT_EQ(dlist.AdaptiveSort(std::less<>()), Utilities::SortStrategy::Radix);
+    EXPECT_EQ(list.AdaptiveSort(std::less<>()), Utilities::SortStrategy::Radix);
+    EXPECT_TRUE(IsSorted(slist, std::less<>()));
+    EXPECT_TRUE(IsSorted(dlist, std::less<>()));
+    EXPECT_TRUE(IsSorted(list, std::less<>()));
+    EXPECT_EQ(slist.GetSize(), values.GetSize());
+    EXPECT_EQ(list.GetSize(), values.GetSize());
+    EXPECT_EQ(slist.AdaptiveSort(std::less<>()), Utilities::SortStrategy::AlreadySorted);
+    EXPECT_EQ(list.AdaptiveSort(std::less<>()), Utilities::SortStrategy::AlreadySorted);
+}
+
+TEST_F(SortTest, list_relinking_sorts_are_stable)
+{
+    using Pair = std::pair<int, int>;
+    auto byKey = [](const Pair &lhs, const Pair &rhs) { return lhs.first < rhs.first; };
+    auto isStable = [](const Containers::List<Pair> &list) {
+        Pair previous{-1, -1};
+        for (auto it = list.GetConstBegin(); it != list.GetConstEnd(); ++it)
+        {
+            if (previous.first > it->first || (previous.first == it->first && previous.second > it->second))
+            {
+                return false;
+            }
+            previous = *it;
+        }
+        return previous == list.GetConstItemBack();
+    };
+    for (unsigned choice : {0u, 1u, 6u})
+    {
+        Containers::List<Pair> list;
+        for (int i = 0; i < 500; ++i)
+        {
+            list.PushBack({(i * 7919) % 37, i});
+        }
+        list.DSASort(choice, byKey);
+        EXPECT_EQ(list.GetSize(), 500u);
+        if (choice != 6)
+        {
+            EXPECT_TRUE(isStable(list));
+        }
+        else
+        {
+            EXPECT_TRUE(std::is_sorted(list.GetBegin(), list.GetEnd(), byKey));
+        }
+    }
+}
+
+TEST_F(SortTest, nth_element_and_partial_sort)
+{
+    for (std::size_t size : {1, 17, 100, 5000})
+    {
+        for (int range : {3, 1 << 20})
+        {
+            Containers::Vector<int> values = MakeRandom(size, range);
+            Containers::Vector<int> reference = values;
+            reference.AdaptiveSort(std::less<>());
+
+            for (std::size_t index : {std::size_t(0), size / 3, size - 1})
+            {
+                Containers::Vector<int> nth = values;
+                nth.NthElement(index, std::less<>());
+                EXPECT_EQ(nth[index], reference[index]);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    ASSERT_TRUE(i < index ? nth[i] <= nth[index] : nth[i] >= nth[index]);
+                }
+
+                Containers::Vector<int> medians = values;
+                Utilities::SelectRange(medians.GetBegin(), medians.GetBegin() + index, medians.GetEnd(), std::less<>(),
+                                       true);
+                EXPECT_EQ(medians[index], reference[index]);
+
+                Containers::Vector<int> partial = values;
+                partial.PartialSort(index, std::less<>());
+                for (std::size_t i = 0; i < index; ++i)
+                {
+                    ASSERT_EQ(partial[i], reference[i]);
+                }
+            }
+
+            Containers::Vector<int> whole = values;
+            whole.PartialSort(size, std::less<>());
+            EXPECT_EQ(whole, reference);
+        }
+    }
+
+    Containers::Vector<int> descending{5, 4, 3, 2, 1};
+    descending.PartialSort(5, std::less<>());
+    EXPECT_EQ(descending, (Containers::Vector<int>{1, 2, 3, 4, 5}));
+
+    Containers::Vector<int> values = MakeRandom(10, 10);
+    EXPECT_THROW(values.NthElement(10, std::less<>()), Containers::VectorOutOfBoundsException);
+    EXPECT_THROW(values.PartialSort(11, std::less<>()), Containers::VectorOutOfBoundsException);
+}
+
+TEST_F(SortTest, select_survives_median_of_three_killer)
+{
+    // Organ pipes defeat median-of-three pivots; the median-of-medians fallback keeps selection linear.
+    Containers::Vector<int> values;
+    for (int i = 0; i < 100000; ++i)
+    {
+        values.PushBack(i < 50000 ? i : 100000 - i);
+    }
+    Utilities::Instrumentation<Containers::Vector<int>>::Reset();
+    values.NthElement(25000, std::less<>());
+    EXPECT_EQ(values[25000], 12500);
+    EXPECT_LT(Utilities::Instrumentation<Containers::Vector<int>>::GetSnapshot().Comparisons, 2000000);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_SORT_TEST_HPP
@@ -0,0 +1,149 @@
+#ifndef DSA_LIBRARIES_SPAN_TEST_HPP
+#define DSA_LIBRARIES_SPAN_TEST_HPP
+
+#include "../include/Containers/Vector/Span.hpp"
+#include "../include/Containers/Vector/Vector.hpp"
+#include "../include/Utilities/Instrumentation.hpp"
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+#include <random>
+namespace DSALibraries::Test
+{
+class SpanTest : public ::testing::Test
+{
+  protected:
+    static Containers::Vector<int> MakeShuffled(int size)
+    {
+        Containers::Vector<int> values;
+        for (int i = 0; i < size; ++i)
+        {
+            values.PushBack(i);
+        }
+        std::shuffle(values.GetBegin(), values.GetEnd(), std::mt19937(3));
+        return values;
+    }
+};
+
+TEST_F(SpanTest, slices_share_vector_storage)
+{
+    Containers::Vector<int> values = MakeShuffled(100);
+    Containers::Span span(values);
+    EXPECT_EQ(span.GetSize(), 100);
+    EXPECT_EQ(span.GetData(), values.GetData());
+
+    Containers::Span<int> middle = span.Slice(10, 20);
+    middle[0] = -1;
+    EXPECT_EQ(values[10], -1);
+    EXPECT_EQ(span.GetFirst(5).GetData(), values.GetData());
+    EXPECT_EQ(span.GetLast(5).GetItemBack(), values[99]);
+    EXPECT_EQ(span.Slice(100).GetSize(), 0);
+    EXPECT_THROW((void)span.Slice(90, 11), Containers::VectorOutOfBoundsException);
+    EXPECT_THROW(middle.At(20), Containers::VectorOutOfBoundsException);
+
+    const Containers::Vector<int> &constant = values;
+    Containers::Span<const int> view(constant);
+    Containers::Span<const int> converted = middle;
+    EXPECT_EQ(view[10], converted[0]);
+}
+
+TEST_F(SpanTest, sorts_a_sub_range_in_place)
+{
+    for (unsigned choice = 0; choice <= 6; ++choice)
+    {
+        Containers::Vector<int> values = MakeShuffled(300);
+        Containers::Vector<int> expected = values;
+        Containers::Span<int>(values).Slice(50, 200).DSASort(choice, std::less<int>());
+        std::sort(expected.GetBegin() + 50, expected.GetBegin() + 250);
+        EXPECT_TRUE(values == expected) << "choice " << choice;
+    }
+
+    Containers::Vector<int> values = MakeShuffled(1000);
+    Containers::Span<int> span(values);
+    span.NthElement(500, std::less<int>());
+    EXPECT_EQ(values[500], 500);
+    span.Slice(0, 500).PartialSort(10, std::greater<int>());
+    EXPECT_EQ(values[0], 499);
+    EXPECT_EQ(values[9], 490);
+}
+
+TEST_F(SpanTest, dsa_sort_matches_vector_for_every_choice)
+{
+    // Repeated keys tagged with their position, so an algorithm that orders ties differently shows up.
+    struct Tagged
+    {
+        int Key;
+        int Position;
+
+        bool operator==(const Tagged &) const = default;
+    };
+    using CountersAlias = Utilities::Instrumentation<Containers::Span<Tagged>>;
+    const auto byKey = [](const Tagged &lhs, const Tagged &rhs) { return lhs.Key < rhs.Key; };
+    Containers::Vector<int> order = MakeShuffled(400);
+    for (unsigned choice = 0; choice <= 6; ++choice)
+    {
+        Containers::Vector<Tagged> expected;
+        for (int i = 0; i < 400; ++i)
+        {
+            expected.PushBack(Tagged{order[i] % 23, i});
+        }
+        Containers::Vector<Tagged> values = expected;
+        CountersAlias::Reset();
+        expected.DSASort(choice, byKey);
+        Containers::Span<Tagged>(values).DSASort(choice, byKey);
+        EXPECT_TRUE(values == expected) << "choice " << choice;
+        if constexpr (Utilities::IsInstrumentationEnabled)
+        {
+            EXPECT_GT(CountersAlias::GetSnapshot().Comparisons, 0) << "choice " << choice;
+        }
+    }
+}
+
+TEST_F(SpanTest, strided_view_visits_every_nth_element)
+{
+    Containers::Vector<int> matrix = MakeShuffled(12); // 4 rows of 3 columns
+    Containers::StridedSpan<int> column = Containers::Span<int>(matrix).Strided(3, 1);
+    ASSERT_EQ(column.GetSize(), 4);
+    EXPECT_EQ(column[2], matrix[7]);
+    EXPECT_EQ(column.GetEnd() - column.GetBegin(), 4);
+
+    const Containers::Vector<int> before = matrix;
+    column.AdaptiveSort(std::less<int>());
+    EXPECT_TRUE(std::is_sorted(column.GetBegin(), column.GetEnd()));
+    for (int i = 0; i < 12; ++i)
+    {
+        if (i % 3 != 1)
+        {
+            EXPECT_EQ(matrix[i], before[i]);
+        }
+    }
+    int sum = 0;
+    for (int value : column)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(sum, matrix[1] + matrix[4] + matrix[7] + matrix[10]);
+
+    EXPECT_EQ(Containers::Span<int>(matrix).Strided(5, 2).GetSize(), 2);
+    EXPECT_THROW((void)Containers::Span<int>(matrix).Strided(0), Containers::SpanInvalidStepException);
+}
+
+TEST_F(SpanTest, chunks_cover_the_span)
+{
+    Containers::Vector<int> values = MakeShuffled(10);
+    Containers::SpanChunks<int> chunks = Containers::Span<int>(values).Chunks(4);
+    ASSERT_EQ(chunks.GetSize(), 3);
+    EXPECT_EQ(chunks[2].GetSize(), 2);
+
+    int total = 0;
+    for (Containers::Span<int> chunk : chunks)
+    {
+        chunk.AdaptiveSort(std::less<int>());
+        EXPECT_TRUE(std::is_sorted(chunk.GetBegin(), chunk.GetEnd()));
+        total += static_cast<int>(chunk.GetSize());
+    }
+    EXPECT_EQ(total, 10);
+    EXPECT_THROW((void)Containers::Span<int>(values).Chunks(0), Containers::SpanInvalidStepException);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_SPAN_TEST_HPP
@@ -0,0 +1,152 @@
+#ifndef DSA_LIBRARIES_TRACING_ALLOCATOR_TEST_HPP
+#define DSA_LIBRARIES_TRACING_ALLOCATOR_TEST_HPP
+
+#include "../include/Containers/DList/DList.hpp"
+#include "../include/Containers/Vector/Vector.hpp"
+#include "../include/Utilities/TracingAllocator.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+namespace DSALibraries::Test
+{
+class TracingAllocatorTest : public ::testing::Test
+{
+  protected:
+    struct TraceTag
+    {
+    };
+
+    using TraceAlias = Utilities::AllocationTrace<TraceTag>;
+    template <typename T> using AllocatorAlias = Utilities::TracingAllocator<T, Utilities::Allocator<T>, TraceTag>;
+
+    static constexpr const char *VectorSite = "vector";
+    static constexpr const char *ListSite = "list";
+
+    void SetUp() override
+    {
+        TraceAlias::Reset();
+    }
+
+    static const Utilities::AllocationTraceSnapshot::SiteRecord *FindSite(
+        const Utilities::AllocationTraceSnapshot &snapshot, const char *site)
+    {
+        for (std::size_t i = 0; i < snapshot.SiteCount; ++i)
+        {
+            if (std::strcmp(snapshot.Sites[i].Site, site) == 0)
+            {
+                return &snapshot.Sites[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(TracingAllocatorTest, records_sizes_and_lifetimes)
+{
+    AllocatorAlias<int> allocator(VectorSite);
+    int *small = allocator.allocate(1);
+    int *large = allocator.allocate(1000);
+    small[0] = 1;
+    large[999] = 2;
+    allocator.deallocate(small, 1);
+    allocator.deallocate(large, 1000);
+
+    const Utilities::AllocationTraceSnapshot snapshot = TraceAlias::GetSnapshot();
+    EXPECT_EQ(snapshot.Allocations, 2);
+    EXPECT_EQ(snapshot.Deallocations, 2);
+    EXPECT_EQ(snapshot.Bytes, 4 + 4000);
+    EXPECT_EQ(snapshot.SizeHistogram[3], 1); // 4 bytes: [4, 8)
+    EXPECT_EQ(snapshot.SizeHistogram[12], 1); // 4000 bytes: [2048, 4096)
+
+    std::uint64_t lifetimes = 0;
+    for (std::uint64_t count : snapshot.LifetimeHistogram)
+    {
+        lifetimes += count;
+    }
+    EXPECT_EQ(lifetimes, 2);
+}
+
+TEST_F(TracingAllocatorTest, clamps_widest_values_to_last_bucket)
+{
+    TraceAlias::RecordDeallocation(0);
+    TraceAlias::RecordDeallocation(~std::uint64_t{0});
+
+    const Utilities::AllocationTraceSnapshot snapshot = TraceAlias::GetSnapshot();
+    EXPECT_EQ(snapshot.LifetimeHistogram[0], 1);
+    EXPECT_EQ(snapshot.LifetimeHistogram[Utilities::AllocationTraceSnapshot::BucketCount - 1], 1);
+}
+
+TEST_F(TracingAllocatorTest, site_survives_rebind)
+{
+    {
+        Containers::DList<int, AllocatorAlias<int>> list(AllocatorAlias<int>{ListSite});
+        for (int i = 0; i < 10; ++i)
+        {
+            list.PushFront(i);
+        }
+        Containers::Vector<int, AllocatorAlias<int>> vector(AllocatorAlias<int>{VectorSite});
+        vector.PushBack(1);
+    }
+
+    const Utilities::AllocationTraceSnapshot snapshot = TraceAlias::GetSnapshot();
+    const auto *list = FindSite(snapshot, ListSite);
+    const auto *vector = FindSite(snapshot, VectorSite);
+    ASSERT_NE(list, nullptr);
+    ASSERT_NE(vector, nullptr);
+    EXPECT_GE(list->Allocations, 10);
+    EXPECT_GE(vector->Allocations, 1);
+    EXPECT_EQ(snapshot.Allocations, snapshot.Deallocations);
+}
+
+TEST_F(TracingAllocatorTest, merges_thread_buffers)
+{
+    constexpr int threadCount = 4;
+    constexpr int allocationsPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([] {
+            AllocatorAlias<double> allocator(VectorSite);
+            for (int i = 0; i < allocationsPerThread; ++i)
+            {
+                allocator.deallocate(allocator.allocate(2), 2);
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    const Utilities::AllocationTraceSnapshot snapshot = TraceAlias::GetSnapshot();
+    EXPECT_EQ(snapshot.Allocations, threadCount * allocationsPerThread);
+    EXPECT_EQ(snapshot.Deallocations, threadCount * allocationsPerThread);
+    EXPECT_EQ(snapshot.SizeHistogram[5], threadCount * allocationsPerThread); // 16 bytes: [16, 32)
+    const auto *site = FindSite(snapshot, VectorSite);
+    ASSERT_NE(site, nullptr);
+    EXPECT_EQ(site->Bytes, threadCount * allocationsPerThread * 16);
+}
+
+TEST_F(TracingAllocatorTest, writes_json_and_csv)
+{
+    AllocatorAlias<char> allocator;
+    allocator.deallocate(allocator.allocate(100), 100);
+
+    std::ostringstream json;
+    TraceAlias::WriteJson(json);
+    EXPECT_EQ(json.str().front(), '{');
+    EXPECT_EQ(json.str().back(), '}');
+    EXPECT_NE(json.str().find("\"allocations\":1"), std::string::npos);
+    EXPECT_NE(json.str().find("\"site\":\"(untagged)\""), std::string::npos);
+
+    std::ostringstream csv;
+    TraceAlias::WriteCsv(csv);
+    EXPECT_EQ(csv.str().rfind("kind,key,count,bytes\n", 0), 0);
+    EXPECT_NE(csv.str().find("size_log2,7,1,\n"), std::string::npos);
+    EXPECT_NE(csv.str().find("site,\"(untagged)\",1,100\n"), std::string::npos);
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_TRACING_ALLOCATOR_TEST_HPP
@@ -0,0 +1,135 @@
+#ifndef DSA_LIBRARIES_UNROLLED_LIST_TEST_HPP
+#define DSA_LIBRARIES_UNROLLED_LIST_TEST_HPP
+
+#include "../include/Containers/UnrolledList/UnrolledList.hpp"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+namespace DSALibraries::Test
+{
+class UnrolledListTest : public ::testing::Test
+{
+  protected:
+    // Eight ints per node keeps splits and merges frequent in small tests.
+    using SmallList = Containers::UnrolledList<int, sizeof(Containers::UnrolledListNodeBase) + 8 * sizeof(int)>;
+
+    template <typename TList> static std::vector<int> ToVector(const TList &list)
+    {
+        return std::vector<int>(list.begin(), list.end());
+    }
+};
+
+TEST_F(UnrolledListTest, matches_std_list_under_random_inserts_and_erases)
+{
+    static_assert(SmallList::ElementsPerNode == 8);
+    SmallList list;
+    std::list<int> expected;
+    std::mt19937 random(42);
+    for (int step = 0; step < 20000; ++step)
+    {
+        const auto size = static_cast<int>(expected.size());
+        const int position = size == 0 ? 0 : static_cast<int>(random() % (size + 1));
+        auto it = std::next(list.begin(), position);
+        auto expectedIt = std::next(expected.begin(), position);
+        if (random() % 5 < 3 || position == size)
+        {
+            auto inserted = list.Insert(it, step);
+            expected.insert(expectedIt, step);
+            EXPECT_EQ(*inserted, step);
+        }
+        else
+        {
+            auto next = list.Erase(it);
+            auto expectedNext = expected.erase(expectedIt);
+            EXPECT_EQ(next == list.end(), expectedNext == expected.end());
+            if (expectedNext != expected.end())
+            {
+                EXPECT_EQ(*next, *expectedNext);
+            }
+        }
+    }
+    ASSERT_EQ(list.GetSize(), expected.size());
+    EXPECT_EQ(ToVector(list), std::vector<int>(expected.begin(), expected.end()));
+    EXPECT_TRUE(std::equal(list.GetConstBegin(), list.GetConstEnd(), expected.begin()));
+}
+
+TEST_F(UnrolledListTest, push_and_pop_at_both_ends)
+{
+    Containers::UnrolledList<std::string> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.PushBack(std::to_string(i));
+        list.PushFront(std::to_string(-i));
+    }
+    EXPECT_EQ(list.GetSize(), 200u);
+    EXPECT_EQ(list.GetItemFront(), "-99");
+    EXPECT_EQ(list.GetItemBack(), "99");
+    std::vector<std::string> reversed;
+    for (auto it = list.end(); it != list.begin();)
+    {
+        reversed.push_back(*--it);
+    }
+    EXPECT_EQ(reversed.front(), "99");
+    EXPECT_EQ(reversed.back(), "-99");
+    while (!list.IsEmpty())
+    {
+        list.PopBack();
+        if (!list.IsEmpty())
+        {
+            list.PopFront();
+        }
+    }
+    EXPECT_EQ(list.GetNodeCount(), 0u);
+    EXPECT_THROW(list.PopBack(), Containers::UnrolledListEmptyException);
+    EXPECT_THROW(list.GetItemFront(), Containers::UnrolledListEmptyException);
+}
+
+TEST_F(UnrolledListTest, appends_fill_nodes_and_erases_merge_them)
+{
+    SmallList list;
+    for (int i = 0; i < 800; ++i)
+    {
+        list.PushBack(i);
+    }
+    EXPECT_EQ(list.GetNodeCount(), 100u);
+    for (auto it = list.begin(); it != list.end();)
+    {
+        it = *it % 4 == 0 ? std::next(it) : list.Erase(it);
+    }
+    EXPECT_EQ(list.GetSize(), 200u);
+    EXPECT_LE(list.GetNodeCount(), 50u);
+    for (int i = 0; i < 200; ++i)
+    {
+        EXPECT_EQ(*std::next(list.begin(), i), i * 4);
+    }
+}
+
+TEST_F(UnrolledListTest, splice_moves_every_node_into_place)
+{
+    SmallList list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    SmallList other{100, 101, 102};
+    list.Splice(std::next(list.begin(), 3), other);
+    EXPECT_TRUE(other.IsEmpty());
+    EXPECT_EQ(ToVector(list), (std::vector<int>{0, 1, 2, 100, 101, 102, 3, 4, 5, 6, 7, 8, 9}));
+
+    list.SpliceAfter(list.GetBeginFromHead(), SmallList{-2, -1});
+    list.SpliceAfter(std::prev(list.end()), SmallList{10});
+    EXPECT_EQ(list.GetSize(), 16u);
+    EXPECT_EQ(list.GetItemFront(), -2);
+    EXPECT_EQ(list.GetItemBack(), 10);
+
+    SmallList copy(list);
+    SmallList moved(std::move(list));
+    EXPECT_TRUE(list.IsEmpty());
+    EXPECT_EQ(ToVector(copy), ToVector(moved));
+    copy.Erase(copy.begin(), std::next(copy.begin(), 15));
+    EXPECT_EQ(ToVector(copy), std::vector<int>{10});
+    copy.Swap(moved);
+    EXPECT_EQ(copy.GetSize(), 16u);
+    EXPECT_EQ(ToVector(moved), std::vector<int>{10});
+}
+} // namespace DSALibraries::Test
+#endif // DSA_LIBRARIES_UNROLLED_LIST_TEST_HPP
@@ -1,9 +1,29 @@
 #ifndef TEST_DEFAULTS_CPP
 #define TEST_DEFAULTS_CPP
 #include "../googletest/include/gtest/gtest.h"
+#include "BitsetTest.hpp"
+#include "CacheTest.hpp"
 #include "CListTest.hpp"
+#include "CompactListTest.hpp"
+#include "ConcurrentSkipListTest.hpp"
+#include "CsrGraphTest.hpp"
 #include "DListTest.hpp"
+#include "DisjointSetTest.hpp"
+#include "ExternalSorterTest.hpp"
+#include "HugePageAllocatorTest.hpp"
+#include "InstrumentationTest.hpp"
+#include "IntrusiveListTest.hpp"
+#include "ListTest.hpp"
+#include "LoserTreeTest.hpp"
+#include "MappedVectorTest.hpp"
+#include "PriorityQueueTest.hpp"
 #include "SListTest.hpp"
+#include "SerializationTest.hpp"
+#include "SoAVectorTest.hpp"
+#include "SortTest.hpp"
+#include "SpanTest.hpp"
+#include "TracingAllocatorTest.hpp"
+#include "UnrolledListTest.hpp"
 #include "VectorTest.hpp"
 int main(int argc, char **argv)
 {